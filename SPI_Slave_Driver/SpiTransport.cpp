@@ -5,12 +5,13 @@ LOG_MODULE_REGISTER(spi_transport, LOG_LEVEL_INF);
 
 #define SPI_SLAVE_NODE DT_NODELABEL(spi1)
 
-SpiTransport::SpiTransport() : 
+SpiTransport::SpiTransport() :
     spi_dev(DEVICE_DT_GET(SPI_SLAVE_NODE)),
     handshake_gpio(GPIO_DT_SPEC_GET(SPI_SLAVE_NODE, handshake_gpios)) {
-    
-    // SPI Mode 0, 8-bit, Slave Mode
-    spi_cfg.operation = SPI_WORD_SET(8) | SPI_OP_MODE_SLAVE;
+
+    // SPI Mode 0, 8-bit, Slave Mode. LOCK_ON keeps the bus owned between
+    // transfers, so the rearm work item can arm the next one.
+    spi_cfg.operation = SPI_WORD_SET(8) | SPI_OP_MODE_SLAVE | SPI_LOCK_ON;
     spi_cfg.frequency = 0; // External clock from Pi
     spi_cfg.slave = 0;
 }
@@ -26,37 +27,146 @@ int SpiTransport::init() {
         return -ENODEV;
     }
 
+    k_sem_init(&ready, 0, RING_SLOTS);
+    k_work_init_delayable(&rearm_work, rearm_handler);
     gpio_pin_configure_dt(&handshake_gpio, GPIO_OUTPUT_INACTIVE);
     return 0;
 }
 
-void SpiTransport::swap_buffers() {
-    processed_idx = active_idx;
-    active_idx = (active_idx == 0) ? 1 : 0;
+int SpiTransport::start() {
+    stalled = false;
+    int ret = arm();
+
+    if (ret < 0) {
+        stalled = true;
+        k_work_schedule(&rearm_work, K_MSEC(REARM_RETRY_MS));
+    }
+    return ret;
 }
 
-int SpiTransport::transfer_sync() {
-    struct spi_buf rx_buf = {
-        .buf = buffers[active_idx],
-        .len = PACKET_SIZE
-    };
-    const struct spi_buf_set rx_bufs = { .buffers = &rx_buf, .count = 1 };
+// Starts the async read into fill_idx and grants the Pi its credit.
+// Called by start(), the rearm work item and the completion callback;
+// only ever with nothing else armed.
+int SpiTransport::arm() {
+    rx_buf.buf = buffers[fill_idx];
+    rx_buf.len = PACKET_SIZE;
+    rx_bufs.buffers = &rx_buf;
+    rx_bufs.count = 1;
+
+    int ret = spi_transceive_cb(spi_dev, &spi_cfg, NULL, &rx_bufs, spi_done, this);
 
-    // Signal Pi: "I am ready and listening"
+    if (ret < 0) {
+        arm_failures++;
+        LOG_ERR("SPI arm failed: %d", ret);
+        gpio_pin_set_dt(&handshake_gpio, 0);
+        return ret;
+    }
+
+    // Signal Pi: "a slot is listening"
     gpio_pin_set_dt(&handshake_gpio, 1);
+    return 0;
+}
+
+void SpiTransport::spi_done(const struct device *dev, int result, void *data) {
+    ARG_UNUSED(dev);
+    static_cast<SpiTransport *>(data)->on_complete(result);
+}
+
+// Arms the next free slot unless one is already armed or none is free:
+// after a release() into a full ring, or to retry a failed arm.
+void SpiTransport::rearm() {
+    unsigned int key = irq_lock();
+
+    if (!stalled || used == RING_SLOTS) {
+        irq_unlock(key);
+        return;
+    }
+    // Nothing is armed, so the callback cannot run until arm() succeeds.
+    stalled = false;
+    irq_unlock(key);
+
+    if (arm() < 0) {
+        stalled = true;
+        k_work_schedule(&rearm_work, K_MSEC(REARM_RETRY_MS));
+    }
+}
 
-    // This blocks until the Pi drives the clock for exactly PACKET_SIZE bytes
-    // and the NSS pin is toggled.
-    int ret = spi_read(spi_dev, &spi_cfg, &rx_bufs);
+void SpiTransport::rearm_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 
-    // Signal Pi: "I am busy/processing"
-    gpio_pin_set_dt(&handshake_gpio, 0);
+    CONTAINER_OF(dwork, SpiTransport, rearm_work)->rearm();
+}
 
-    if (ret == 0) {
-        swap_buffers();
+// SPI completion, ISR context. Arms the next free slot before the frame
+// is handed over, so the Pi keeps its credit while free slots remain.
+// The driver calls back as the last step of a transfer and SPI_LOCK_ON
+// keeps the bus owned, so starting the next one here does not wait.
+void SpiTransport::on_complete(int result) {
+    bool delivered = false;
+
+    if (result < 0) {
+        // Same slot again; the Pi resends on its own timeout.
+        errors++;
     } else {
-        LOG_ERR("SPI Transfer failed: %d", ret);
+        // A slave reports the frames received; 0 means the full request.
+        lens[fill_idx] = (result > 0) ? MIN((size_t)result, PACKET_SIZE) : PACKET_SIZE;
+        seqs[fill_idx] = next_seq++;
+        fill_idx = (fill_idx + 1) % RING_SLOTS;
+        used++;
+        delivered = true;
     }
 
-    return ret;
+    if (used == RING_SLOTS) {
+        // Out of credit: release() reschedules the work.
+        stalled = true;
+        gpio_pin_set_dt(&handshake_gpio, 0);
+    } else if (arm() < 0) {
+        stalled = true;
+        k_work_schedule(&rearm_work, K_MSEC(REARM_RETRY_MS));
+    }
+
+    if (delivered) {
+        k_sem_give(&ready);
+    }
+}
+
+int SpiTransport::borrow(Frame &frame, k_timeout_t timeout) {
+    if (k_sem_take(&ready, timeout) != 0) {
+        return -EAGAIN;
+    }
+
+    unsigned int key = irq_lock();
+    uint8_t slot = borrow_idx;
+
+    borrow_idx = (borrow_idx + 1) % RING_SLOTS;
+    borrowed++;
+    irq_unlock(key);
+
+    frame.data = buffers[slot];
+    frame.len = lens[slot];
+    frame.seq = seqs[slot];
+    frame.slot = slot;
+    return 0;
+}
+
+int SpiTransport::release(const Frame &frame) {
+    unsigned int key = irq_lock();
+
+    if (borrowed == 0 || frame.slot != tail) {
+        irq_unlock(key);
+        return -EINVAL;
+    }
+    tail = (tail + 1) % RING_SLOTS;
+    borrowed--;
+    used--;
+
+    // A pending retry keeps its delay; otherwise this arms right away.
+    bool restart = stalled;
+
+    irq_unlock(key);
+
+    if (restart) {
+        k_work_schedule(&rearm_work, K_NO_WAIT);
+    }
+    return 0;
 }
@@ -5,34 +5,109 @@
 #include <zephyr/drivers/spi.h>
 #include <zephyr/drivers/gpio.h>
 
+/**
+ * Continuous SPI slave receive into a ring of RING_SLOTS packet buffers.
+ *
+ * One async (DMA) read is armed on the next free slot. When it completes,
+ * the completion callback arms the following free slot straight away and
+ * only then stamps the finished slot with a sequence number and queues it
+ * for the consumer, so the peripheral keeps listening while a frame is
+ * delivered. This relies on SPI_LOCK_ON: the bus stays owned between
+ * transfers, so a transfer started from the callback does not wait for the
+ * lock. When the ring is full, or an arm fails, a work item on the system
+ * workqueue arms the next slot instead: after release() frees one, or
+ * every REARM_RETRY_MS until the arm succeeds.
+ *
+ * The handshake GPIO is the Pi's credit: it is high while a slot is armed,
+ * which is whenever a slot is free and arming has not failed. It only
+ * drops once every slot is queued or borrowed, and rises again when the
+ * work item arms the slot release() frees. The Pi must only clock a frame
+ * while it is high.
+ *
+ * Consumers borrow() the oldest completed frame and release() it when done.
+ * A borrowed slot is never re-armed, so its data cannot change underneath
+ * the reader. There is a single consumer, and frames are released in the
+ * order they were borrowed.
+ *
+ * Needs CONFIG_SPI_ASYNC (and CONFIG_SPI_STM32_DMA for DMA transfers).
+ */
 class SpiTransport {
 public:
     static constexpr size_t PACKET_SIZE = 256;
+    static constexpr size_t RING_SLOTS = 4;
+    static constexpr int32_t REARM_RETRY_MS = 10;
+
+    /** @brief A completed frame on loan to the consumer. */
+    struct Frame {
+        const uint8_t *data;
+        size_t len;      // bytes received (PACKET_SIZE unless CS ended early)
+        uint32_t seq;    // increments by one per completed frame
+        uint8_t slot;
+    };
 
     SpiTransport();
     int init();
 
     /**
-     * @brief Pulls handshake high and waits for the Pi to send 256 bytes.
-     * @return 0 on success, negative error code on failure.
+     * @brief Arms the first slot and raises the handshake line.
+     * @return 0 on success, negative error code on failure (the arm is
+     *         then retried in the background).
      */
-    int transfer_sync();
+    int start();
 
     /**
-     * @brief Returns a pointer to the buffer containing the most recent data.
+     * @brief Waits for the oldest completed frame and lends it out.
+     * @return 0 on success, -EAGAIN on timeout.
      */
-    uint8_t* get_latest_data() { return buffers[processed_idx]; }
+    int borrow(Frame &frame, k_timeout_t timeout);
+
+    /**
+     * @brief Hands a borrowed frame's slot back to the ring.
+     * @return 0, or -EINVAL if frame is not the oldest borrowed one.
+     */
+    int release(const Frame &frame);
+
+    /** @brief Transfers that failed and were re-armed on the same slot. */
+    uint32_t error_count() const { return errors; }
+
+    /** @brief Failed attempts to arm a transfer (each one is retried). */
+    uint32_t arm_failure_count() const { return arm_failures; }
 
 private:
     const struct device *spi_dev;
     struct spi_config spi_cfg;
     struct gpio_dt_spec handshake_gpio;
 
-    uint8_t buffers[2][PACKET_SIZE];
-    uint8_t active_idx = 0;    // Buffer currently being filled by SPI
-    uint8_t processed_idx = 1; // Buffer available for the app to read
-    
-    void swap_buffers();
+    uint8_t buffers[RING_SLOTS][PACKET_SIZE];
+    size_t lens[RING_SLOTS];
+    uint32_t seqs[RING_SLOTS];
+
+    // Slots cycle fill -> queued -> borrowed -> free, always in ring order:
+    // [tail, borrow_idx) borrowed, [borrow_idx, fill_idx) queued, fill_idx
+    // armed unless stalled. Written under irq_lock or in the SPI callback;
+    // arm() runs only with nothing armed (start(), the callback, the work).
+    uint8_t tail = 0;
+    uint8_t borrow_idx = 0;
+    uint8_t fill_idx = 0;
+    uint8_t used = 0;          // queued + borrowed slots
+    uint8_t borrowed = 0;
+    bool stalled = true;       // no transfer armed
+    uint32_t next_seq = 0;
+    uint32_t errors = 0;
+    uint32_t arm_failures = 0;
+
+    struct k_sem ready;        // counts queued frames
+    struct k_work_delayable rearm_work;
+
+    // Descriptors of the armed transfer; must outlive the async call.
+    struct spi_buf rx_buf;
+    struct spi_buf_set rx_bufs;
+
+    int arm();
+    void rearm();
+    void on_complete(int result);
+    static void spi_done(const struct device *dev, int result, void *data);
+    static void rearm_handler(struct k_work *work);
 };
 
 #endif
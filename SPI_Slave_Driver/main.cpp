@@ -0,0 +1,47 @@
+#include "SpiTransport.hpp"
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(spi_slave_app, LOG_LEVEL_INF);
+
+static constexpr uint32_t REPORT_FRAMES = 1000;
+
+static SpiTransport transport;
+
+// Drains frames as they arrive and reports sequence gaps, which the ring
+// must never produce, and short frames (CS released early).
+int main() {
+    if (transport.init() < 0) {
+        return 0;
+    }
+    if (transport.start() < 0) {
+        LOG_WRN("First arm failed; retrying in the background");
+    }
+
+    uint32_t frames = 0, gaps = 0, short_frames = 0;
+    uint32_t expect = 0;
+
+    for (;;) {
+        SpiTransport::Frame frame;
+
+        if (transport.borrow(frame, K_SECONDS(1)) < 0) {
+            LOG_INF("No frame for 1 s (%u transfer errors, %u failed arms)",
+                    transport.error_count(), transport.arm_failure_count());
+            continue;
+        }
+        if (frame.seq != expect) {
+            gaps++;
+        }
+        expect = frame.seq + 1;
+        if (frame.len < SpiTransport::PACKET_SIZE) {
+            short_frames++;
+        }
+        transport.release(frame);
+
+        if (++frames % REPORT_FRAMES == 0) {
+            LOG_INF("%u frames, %u seq gaps, %u short, %u transfer errors, %u failed arms",
+                    frames, gaps, short_frames, transport.error_count(),
+                    transport.arm_failure_count());
+        }
+    }
+    return 0;
+}
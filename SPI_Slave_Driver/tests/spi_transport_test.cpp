@@ -0,0 +1,171 @@
+// SpiTransport on the host, against stubbed SPI, GPIO and kernel calls
+// (stubs/). The stub master clocks a frame only into an armed transfer
+// and completes it the way the driver does, from its callback.
+//
+// Covered:
+//   - the next slot is armed, and the handshake stays high, while a
+//     completed frame is delivered and while free slots remain
+//   - a full ring drops the handshake and arms nothing until release()
+//   - frames come out in order with consecutive sequence numbers and
+//     their data intact, and a borrowed slot is never the armed one
+//   - out-of-order release is rejected
+//   - a failed transfer re-arms the same slot; a failed arm drops the
+//     handshake and is retried from the work item
+//
+//   cmake -S SPI_Slave_Driver/tests -B build && cmake --build build &&
+//   ctest --test-dir build
+
+#include "SpiTransport.hpp"
+#include "fake_zephyr.h"
+#include <cstdio>
+#include <cstring>
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                      \
+        }                                                                    \
+    } while (0)
+
+namespace {
+
+constexpr size_t N = SpiTransport::RING_SLOTS;
+
+void reset() {
+    fake_spi = FakeSpi{};
+    fake_work = nullptr;
+}
+
+// Frame k is filled with k, so data and sequence can be checked together.
+bool send(uint32_t k) {
+    uint8_t frame[SpiTransport::PACKET_SIZE];
+    std::memset(frame, int(k & 0xFF), sizeof(frame));
+    return fake_spi_frame(frame, sizeof(frame));
+}
+
+bool intact(const SpiTransport::Frame &f) {
+    for (size_t i = 0; i < f.len; i++) {
+        if (f.data[i] != uint8_t(f.seq & 0xFF)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+static void streamsWithoutGaps() {
+    reset();
+    SpiTransport t;
+    CHECK(t.init() == 0);
+    CHECK(fake_handshake() == 0);
+    CHECK(t.start() == 0);
+    CHECK(fake_spi.armed && fake_handshake() == 1);
+
+    // Frames back to back: each completion arms the next slot itself, so
+    // the handshake never drops and no work item is needed.
+    for (uint32_t k = 0; k + 1 < N; k++) {
+        CHECK(send(k));
+        CHECK(fake_spi.armed);
+        CHECK(fake_handshake() == 1);
+        CHECK(!fake_run_work());
+    }
+
+    // The last free slot fills: out of credit.
+    CHECK(send(N - 1));
+    CHECK(!fake_spi.armed);
+    CHECK(fake_handshake() == 0);
+    CHECK(!send(N));                 // nothing listening
+
+    SpiTransport::Frame f[N];
+    for (uint32_t k = 0; k < N; k++) {
+        CHECK(t.borrow(f[k], K_NO_WAIT) == 0);
+        CHECK(f[k].seq == k && f[k].len == SpiTransport::PACKET_SIZE && intact(f[k]));
+    }
+    CHECK(t.borrow(f[0], K_NO_WAIT) == -EAGAIN);
+
+    // Out of order is rejected; the oldest frees a slot and re-arms it.
+    CHECK(t.release(f[1]) == -EINVAL);
+    CHECK(t.release(f[0]) == 0);
+    CHECK(!fake_spi.armed);
+    CHECK(fake_run_work());
+    CHECK(fake_spi.armed && fake_handshake() == 1);
+    CHECK(fake_spi.buf == f[0].data);
+    CHECK(t.release(f[1]) == 0 && t.release(f[2]) == 0 && t.release(f[3]) == 0);
+
+    // A steady consumer: borrowed frames stay untouched while the ring
+    // keeps receiving into the other slots.
+    uint32_t sent = N, next = N;
+    while (sent < 50) {
+        CHECK(send(sent++));
+        SpiTransport::Frame g;
+        CHECK(t.borrow(g, K_NO_WAIT) == 0);
+        CHECK(g.seq == next++ && intact(g));
+        CHECK(fake_spi.armed && fake_spi.buf != g.data);
+        CHECK(send(sent++));         // lands while g is borrowed
+        CHECK(intact(g));
+        CHECK(t.release(g) == 0);
+        SpiTransport::Frame h;
+        CHECK(t.borrow(h, K_NO_WAIT) == 0);
+        CHECK(h.seq == next++ && intact(h));
+        CHECK(t.release(h) == 0);
+        CHECK(!fake_run_work());     // never ran out of credit
+    }
+    CHECK(fake_handshake() == 1);
+    CHECK(fake_spi.double_arms == 0);
+    CHECK(t.error_count() == 0 && t.arm_failure_count() == 0);
+}
+
+static void errorsAndRetries() {
+    reset();
+    SpiTransport t;
+    CHECK(t.init() == 0);
+    CHECK(t.start() == 0);
+
+    // A failed transfer is re-armed on the same slot, nothing is queued.
+    uint8_t *slot = fake_spi.buf;
+    CHECK(fake_spi_error(-EIO));
+    CHECK(fake_spi.armed && fake_spi.buf == slot);
+    CHECK(fake_handshake() == 1);
+    CHECK(t.error_count() == 1);
+    SpiTransport::Frame f;
+    CHECK(t.borrow(f, K_NO_WAIT) == -EAGAIN);
+
+    // A failed arm after a good frame: handshake down, retried later.
+    fake_spi.fail_arms = 2;
+    CHECK(send(0));
+    CHECK(!fake_spi.armed && fake_handshake() == 0);
+    CHECK(fake_work != nullptr && fake_work->delay_ms == SpiTransport::REARM_RETRY_MS);
+    CHECK(fake_run_work());
+    CHECK(!fake_spi.armed && fake_handshake() == 0);
+    CHECK(fake_run_work());
+    CHECK(fake_spi.armed && fake_handshake() == 1);
+    CHECK(t.arm_failure_count() == 2);
+
+    CHECK(t.borrow(f, K_NO_WAIT) == 0 && f.seq == 0 && intact(f));
+    CHECK(t.release(f) == 0);
+    CHECK(send(1));
+    CHECK(t.borrow(f, K_NO_WAIT) == 0 && f.seq == 1);
+
+    // start() that cannot arm retries in the background too.
+    reset();
+    SpiTransport u;
+    CHECK(u.init() == 0);
+    fake_spi.fail_arms = 1;
+    CHECK(u.start() < 0);
+    CHECK(fake_handshake() == 0);
+    CHECK(fake_run_work());
+    CHECK(fake_spi.armed && fake_handshake() == 1);
+    CHECK(fake_spi.double_arms == 0);
+}
+
+int main() {
+    streamsWithoutGaps();
+    errorsAndRetries();
+
+    std::printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+    return failures ? 1 : 0;
+}
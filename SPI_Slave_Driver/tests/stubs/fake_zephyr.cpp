@@ -0,0 +1,112 @@
+#include "fake_zephyr.h"
+#include <cstring>
+
+struct device fake_dt_spi1 = {"spi1"};
+int fake_gpio_handshake_gpios = -1;
+FakeSpi fake_spi;
+struct k_work_delayable *fake_work = nullptr;
+
+void k_sem_init(struct k_sem *sem, unsigned initial, unsigned limit) {
+    sem->count = initial;
+    sem->limit = limit;
+}
+
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout) {
+    ARG_UNUSED(timeout);
+    if (sem->count == 0) {
+        return -EAGAIN;
+    }
+    sem->count--;
+    return 0;
+}
+
+void k_sem_give(struct k_sem *sem) {
+    if (sem->count < sem->limit) {
+        sem->count++;
+    }
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler) {
+    dwork->work.handler = handler;
+    dwork->pending = false;
+    dwork->delay_ms = 0;
+}
+
+// Like Zephyr: a pending item keeps the delay it was scheduled with.
+int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay) {
+    if (dwork->pending) {
+        return 0;
+    }
+    dwork->pending = true;
+    dwork->delay_ms = delay.ms;
+    fake_work = dwork;
+    return 1;
+}
+
+struct k_work_delayable *k_work_delayable_from_work(struct k_work *work) {
+    return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+unsigned int irq_lock() { return 0; }
+void irq_unlock(unsigned int key) { ARG_UNUSED(key); }
+
+bool device_is_ready(const struct device *dev) { return dev != nullptr; }
+
+int spi_transceive_cb(const struct device *dev, const struct spi_config *config,
+                      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+                      spi_callback_t callback, void *userdata) {
+    ARG_UNUSED(dev);
+    ARG_UNUSED(config);
+    ARG_UNUSED(tx_bufs);
+    if (fake_spi.fail_arms > 0) {
+        fake_spi.fail_arms--;
+        return -EBUSY;
+    }
+    fake_spi.double_arms += fake_spi.armed;
+    fake_spi.arms++;
+    fake_spi.armed = true;
+    fake_spi.buf = static_cast<uint8_t *>(rx_bufs->buffers[0].buf);
+    fake_spi.len = rx_bufs->buffers[0].len;
+    fake_spi.cb = callback;
+    fake_spi.userdata = userdata;
+    return 0;
+}
+
+static bool complete(int result) {
+    if (!fake_spi.armed) {
+        return false;
+    }
+    fake_spi.armed = false;
+    fake_spi.cb(&fake_dt_spi1, result, fake_spi.userdata);
+    return true;
+}
+
+bool fake_spi_frame(const uint8_t *data, size_t len) {
+    if (fake_spi.armed) {
+        std::memcpy(fake_spi.buf, data, MIN(len, fake_spi.len));
+    }
+    return complete((int)MIN(len, fake_spi.len));
+}
+
+bool fake_spi_error(int err) { return complete(err); }
+
+bool fake_run_work() {
+    if (fake_work == nullptr || !fake_work->pending) {
+        return false;
+    }
+    fake_work->pending = false;
+    fake_work->work.handler(&fake_work->work);
+    return true;
+}
+
+bool gpio_is_ready_dt(const struct gpio_dt_spec *spec) { return spec->level != nullptr; }
+
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, int flags) {
+    *spec->level = flags;
+    return 0;
+}
+
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value) {
+    *spec->level = value;
+    return 0;
+}
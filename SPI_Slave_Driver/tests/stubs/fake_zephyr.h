@@ -0,0 +1,34 @@
+// Test side of the stubs: the one SPI transfer the driver has armed, the
+// handshake level, and the pending rearm work.
+#ifndef FAKE_ZEPHYR_H
+#define FAKE_ZEPHYR_H
+
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/spi.h>
+
+struct FakeSpi {
+    bool armed = false;
+    uint8_t *buf = nullptr;
+    size_t len = 0;
+    spi_callback_t cb = nullptr;
+    void *userdata = nullptr;
+    int fail_arms = 0;        // next arms fail with -EBUSY
+    unsigned arms = 0;
+    unsigned double_arms = 0; // arms while a transfer was already armed
+};
+
+extern FakeSpi fake_spi;
+extern struct k_work_delayable *fake_work;
+
+/** Master clocks one frame into the armed buffer and completes it. */
+bool fake_spi_frame(const uint8_t *data, size_t len);
+
+/** Completes the armed transfer with an error. */
+bool fake_spi_error(int err);
+
+/** Runs the scheduled work item, if any; returns whether it ran. */
+bool fake_run_work();
+
+inline int fake_handshake() { return fake_gpio_handshake_gpios; }
+
+#endif
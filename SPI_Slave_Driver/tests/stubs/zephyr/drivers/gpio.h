@@ -0,0 +1,19 @@
+#ifndef FAKE_ZEPHYR_DRIVERS_GPIO_H
+#define FAKE_ZEPHYR_DRIVERS_GPIO_H
+
+#include <zephyr/kernel.h>
+
+struct gpio_dt_spec {
+    int *level;
+};
+
+#define GPIO_DT_SPEC_GET(node, prop) (gpio_dt_spec{&fake_gpio_##prop})
+extern int fake_gpio_handshake_gpios;
+
+#define GPIO_OUTPUT_INACTIVE 0
+
+bool gpio_is_ready_dt(const struct gpio_dt_spec *spec);
+int gpio_pin_configure_dt(const struct gpio_dt_spec *spec, int flags);
+int gpio_pin_set_dt(const struct gpio_dt_spec *spec, int value);
+
+#endif
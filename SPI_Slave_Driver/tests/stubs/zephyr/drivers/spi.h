@@ -0,0 +1,42 @@
+#ifndef FAKE_ZEPHYR_DRIVERS_SPI_H
+#define FAKE_ZEPHYR_DRIVERS_SPI_H
+
+#include <zephyr/kernel.h>
+
+struct device {
+    const char *name;
+};
+
+#define DT_NODELABEL(label) fake_dt_##label
+#define DEVICE_DT_GET(node) (&node)
+extern struct device fake_dt_spi1;
+
+bool device_is_ready(const struct device *dev);
+
+#define SPI_WORD_SET(n) ((uint32_t)(n) << 5)
+#define SPI_OP_MODE_SLAVE (1U << 0)
+#define SPI_LOCK_ON (1U << 14)
+
+struct spi_config {
+    uint32_t frequency;
+    uint32_t operation;
+    uint16_t slave;
+};
+
+struct spi_buf {
+    void *buf;
+    size_t len;
+};
+
+struct spi_buf_set {
+    const struct spi_buf *buffers;
+    size_t count;
+};
+
+typedef void (*spi_callback_t)(const struct device *dev, int result, void *data);
+
+int spi_transceive_cb(const struct device *dev, const struct spi_config *config,
+                      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+                      spi_callback_t callback, void *userdata);
+
+#endif
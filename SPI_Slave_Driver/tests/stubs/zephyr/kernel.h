@@ -0,0 +1,49 @@
+// Host stand-in for the slice of the Zephyr kernel API SpiTransport uses.
+// Single-threaded: k_sem_take() never blocks, and delayed work only runs
+// when the test calls fake_run_work().
+#ifndef FAKE_ZEPHYR_KERNEL_H
+#define FAKE_ZEPHYR_KERNEL_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#define ARG_UNUSED(x) (void)(x)
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define CONTAINER_OF(ptr, type, field) \
+    ((type *)(((char *)(ptr)) - offsetof(type, field)))
+
+struct k_timeout_t {
+    int64_t ms;
+};
+#define K_NO_WAIT (k_timeout_t{0})
+#define K_FOREVER (k_timeout_t{-1})
+#define K_MSEC(n) (k_timeout_t{(n)})
+#define K_SECONDS(n) (k_timeout_t{(n) * 1000})
+
+struct k_sem {
+    unsigned count;
+    unsigned limit;
+};
+void k_sem_init(struct k_sem *sem, unsigned initial, unsigned limit);
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
+void k_sem_give(struct k_sem *sem);
+
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+struct k_work {
+    k_work_handler_t handler;
+};
+struct k_work_delayable {
+    struct k_work work;
+    bool pending;
+    int64_t delay_ms;
+};
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay);
+struct k_work_delayable *k_work_delayable_from_work(struct k_work *work);
+
+unsigned int irq_lock();
+void irq_unlock(unsigned int key);
+
+#endif
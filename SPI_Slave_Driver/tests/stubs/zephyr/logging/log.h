@@ -0,0 +1,12 @@
+#ifndef FAKE_ZEPHYR_LOGGING_LOG_H
+#define FAKE_ZEPHYR_LOGGING_LOG_H
+
+#include <cstdio>
+
+#define LOG_LEVEL_INF 3
+#define LOG_MODULE_REGISTER(name, level)
+#define LOG_ERR(...) (std::printf("<err> " __VA_ARGS__), std::printf("\n"))
+#define LOG_WRN(...) (std::printf("<wrn> " __VA_ARGS__), std::printf("\n"))
+#define LOG_INF(...) (std::printf("<inf> " __VA_ARGS__), std::printf("\n"))
+
+#endif
@@ -2,10 +2,23 @@
 #include <iostream>
 #include <string>
 #include "mesh.cpp"
+#include <shm_bus.hpp>
 #include <cmath>
 #include <algorithm>
 
-int main()
+// Pixels per metre of sim position; the mesh arms are 100 px, i.e. 1 m.
+const float PX_PER_M = 100;
+
+// Rotates v by the sim's attitude quaternion (x, y, z, w).
+sf::Vector3f rotate(const double q[4], sf::Vector3f v) {
+  sf::Vector3f u = {(float)q[0], (float)q[1], (float)q[2]};
+  float w = (float)q[3];
+  sf::Vector3f t = 2.f * u.cross(v);
+  return v + w * t + u.cross(t);
+}
+
+// Usage: main [bus]   follows `flight_sim --shm <bus>` (default /flight_sim)
+int main(int argc, char **argv)
 {
   auto window = sf::RenderWindow(sf::VideoMode::getDesktopMode(), "CMake SFML Project", sf::State::Fullscreen);
   // window.setFramerateLimit(60);
@@ -36,6 +49,13 @@ int main()
   // Create mesh with drone points/indices
   Mesh mesh = Mesh(drone, drone_inds);
 
+  // Live drone state from the sim's shared-memory bus. The sim may start
+  // after us, so keep trying to map it until it is there.
+  ShmBusReader bus(argc > 1 ? argv[1] : "/flight_sim");
+  bool connected = false;
+  ShmSimFrame state{};
+  state.orientation[3] = 1;
+
   while (window.isOpen())
   {
     // get deltaTime to account for framerate differences when moving camera
@@ -110,6 +130,25 @@ int main()
       camera.zoom = 2;
     }
 
+    // Catch up with the sim: keep only the newest frame. An overrun has
+    // already moved the cursor on, so just read again.
+    if (!connected) {
+      connected = bus.init();
+    }
+    ShmSimFrame frame;
+    ShmBusReader::Result r;
+    while (connected && (r = bus.read(frame)) != ShmBusReader::Result::Empty) {
+      if (r == ShmBusReader::Result::Ok) {
+        state = frame;
+      }
+    }
+
+    // Place the drone mesh at the sim's pose
+    for (size_t i = 0; i < drone.size(); i++) {
+      sf::Vector3f offset = {(float)state.position[0], (float)state.position[1], (float)state.position[2]};
+      mesh.vertices[i] = rotate(state.orientation, drone[i]) + offset * PX_PER_M;
+    }
+
     // Draw sequence
     window.clear(sf::Color(0xaaccffff));
 
@@ -117,6 +156,10 @@ int main()
     // Display fps and camera controls
     drawText("FPS: " + std::to_string(fps) + "\nControls:\nPan: WASD\nRotate: Arrow Keys or "
                     + "Mouse Scroll/Trackpad\nZoom: PgUp/PgDn\nReset Camera: 0\n", {0, 0}, 18, window);
+    drawText(connected ? "Sim t = " + std::to_string(state.simTimeNs / 1e9) + " s  step "
+                             + std::to_string(state.step) + "  dropped " + std::to_string(bus.getDropped())
+                       : std::string("Waiting for the sim's shared-memory bus"),
+             {0, (float)window.getSize().y - 30}, 18, window);
 
     renderMesh(mesh, window, camera);
     window.display();
@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include "rigid_body.hpp"
+#include <memory>
 #include <vector>
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
@@ -12,34 +13,30 @@ class Drone : public RigidBody {
 public:
     Drone();
     Drone(
-        RigidBody* body,
-        RigidBody* m1,
-        RigidBody* m2,
-        RigidBody* m3,
-        RigidBody* m4
+        std::unique_ptr<RigidBody> body,
+        std::unique_ptr<RigidBody> m1,
+        std::unique_ptr<RigidBody> m2,
+        std::unique_ptr<RigidBody> m3,
+        std::unique_ptr<RigidBody> m4
     );
 
-    ~Drone() {
-        delete body;
-        delete m1;
-        delete m2;
-        delete m3;
-        delete m4;
-    }
-
     void applyForce(const Eigen::Vector3d& force) override;
     void update(double dt) override;
 
-    Eigen::Vector3d getPosition() const;
-    Eigen::Vector3d getVelocity() const;
+    Eigen::Vector3d getPosition() const override;
+    Eigen::Vector3d getVelocity() const override;
     Eigen::Vector3d calculateNetTorque();
 
+    // Saves the drone itself followed by body, m1..m4.
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
 private:
-    RigidBody* body;
-    RigidBody* m1;
-    RigidBody* m2;
-    RigidBody* m3;
-    RigidBody* m4;
+    std::unique_ptr<RigidBody> body;
+    std::unique_ptr<RigidBody> m1;
+    std::unique_ptr<RigidBody> m2;
+    std::unique_ptr<RigidBody> m3;
+    std::unique_ptr<RigidBody> m4;
 
     double calculateMass();
     Eigen::Vector3d calculateNetForce();
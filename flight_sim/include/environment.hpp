@@ -0,0 +1,97 @@
+// Atmosphere around the simulated bodies: mean wind, turbulence, drag and
+// ground effect. The Simulation owns the mean wind; this module turns it
+// into per-body forces every physics step.
+//
+// Bodies are registered once up front. step() walks the registered batch
+// and only touches fixed-size Eigen types, so it never allocates.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "physics_body.hpp"
+#include <Eigen/Dense>
+
+class StateWriter;
+class StateReader;
+
+struct EnvironmentConfig {
+    // Turbulence intensity (1-sigma gust speed, m/s). 0 disables turbulence.
+    double turbulenceHorizontal = 0.0;
+    double turbulenceVertical = 0.0;
+
+    // Dryden scale lengths (m). Gust correlation time is L / airspeed.
+    double lengthScaleHorizontal = 200.0;
+    double lengthScaleVertical = 50.0;
+
+    // Floor on the airspeed used for the correlation time, so a hovering
+    // body in still air still sees gusts change (m/s).
+    double minAirspeed = 1.0;
+
+    double airDensity = 1.225; // kg/m^3
+    double groundHeight = 0.0; // world z of the ground plane (m)
+
+    uint64_t seed = 1;
+};
+
+// Per-body aerodynamic parameters.
+struct AeroParams {
+    double dragArea = 0.0;    // Cd * A (m^2); 0 disables drag
+    double rotorRadius = 0.0; // m; 0 disables ground effect
+};
+
+class Environment {
+public:
+    explicit Environment(const EnvironmentConfig& config = EnvironmentConfig());
+
+    // Registers a body and returns its index. Call before the run starts;
+    // this is the only place that allocates.
+    size_t addBody(PhysicsBody& body, const AeroParams& params);
+    void reserve(size_t count) { bodies.reserve(count); }
+
+    // Upward thrust the body is producing this step, before ground effect.
+    // Only the +z component is boosted.
+    void setThrust(size_t index, const Eigen::Vector3d& thrust) { bodies[index].thrust = thrust; }
+
+    // Advances turbulence by dt and applies drag and ground effect to every
+    // registered body. meanWind is world-frame air velocity (m/s).
+    void step(double dt, const Eigen::Vector3d& meanWind);
+
+    // Air velocity seen by a body on the last step (mean + gust).
+    Eigen::Vector3d getWind(size_t index) const { return bodies[index].wind; }
+    Eigen::Vector3d getGust(size_t index) const { return bodies[index].gust; }
+    Eigen::Vector3d getDragForce(size_t index) const { return bodies[index].drag; }
+    size_t getBodyCount() const { return bodies.size(); }
+
+    // T_ige / T_oge from Cheeseman & Bennett, capped at half a rotor radius.
+    static double groundEffectFactor(double height, double rotorRadius);
+
+    // Counter-based noise: sample n is a pure function of (seed, n), so
+    // restoring the counter replays the exact same gust sequence.
+    uint64_t getNoiseCounter() const { return noiseCounter; }
+    void setNoiseCounter(uint64_t counter) { noiseCounter = counter; }
+
+    const EnvironmentConfig& getConfig() const { return config; }
+
+    // Noise counter and per-body gust state, for Simulation checkpoints.
+    // Restoring expects the same bodies registered in the same order.
+    void saveState(StateWriter& out) const;
+    void restoreState(StateReader& in);
+
+private:
+    struct AeroBody {
+        PhysicsBody* body;
+        AeroParams params;
+        Eigen::Vector3d gust;
+        Eigen::Vector3d thrust;
+        Eigen::Vector3d wind;
+        Eigen::Vector3d drag;
+    };
+
+    EnvironmentConfig config;
+    std::vector<AeroBody> bodies;
+    uint64_t noiseCounter = 0;
+
+    double uniform();
+    double gaussian();
+};
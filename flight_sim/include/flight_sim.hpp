@@ -12,13 +12,20 @@
 #include <PIDcalculator.hpp>
 #include <collection.hpp>
 #include <drone.hpp>
+#include <environment.hpp>
 #include <imu_generation.hpp>
 #include <joint.hpp>
+#include <lockstep_transport.hpp>
+#include <node_clock.hpp>
+#include <node_status.hpp>
 #include <json.hpp>
 #include <physics_body.hpp>
 #include <positionController.hpp>
 #include <rigid_body.hpp>
+#include <sim_state.hpp>
+#include <shm_bus.hpp>
 #include <simulation.hpp>
+#include <sim_components.hpp>
 #include <spi_interface.hpp>
 #include <rc_parser.hpp>
 #include <spi_new_test.hpp>
@@ -10,6 +10,9 @@
 #include <stdint.h>
 #include <Eigen/Dense>
 
+class StateWriter;
+class StateReader;
+
 // --- IMU hardware struct definitions ---
 typedef struct {
     int8_t lsb;
@@ -39,6 +42,10 @@ public:
                       const Eigen::Vector3f& torque,
                       float dt);
 
+    // Integrated rates and angles, for Simulation checkpoints.
+    void saveState(StateWriter& out) const;
+    void restoreState(StateReader& in);
+
 private:
     float m_;
     float I_;
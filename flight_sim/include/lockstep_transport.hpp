@@ -0,0 +1,102 @@
+// Lockstep co-simulation link. In lockstep mode the sim sends one frame per
+// step and does not advance until the consumer acknowledges that frame, so
+// runs are reproducible and go as fast as both sides allow.
+//
+// Every frame is a LockstepHeader followed by payloadLen bytes. The
+// consumer answers with a LockstepAck carrying the same seq.
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "node_status.hpp"
+#include "spi_interface.hpp"
+
+constexpr uint32_t LOCKSTEP_FRAME_MAGIC = 0x4C4B5354; // "LKST"
+constexpr uint32_t LOCKSTEP_ACK_MAGIC   = 0x4C4B4143; // "LKAC"
+
+#pragma pack(push, 1)
+struct LockstepHeader {
+    uint32_t magic;
+    uint32_t seq;        // step number, starts at 0
+    int64_t  simTimeNs;  // sim time the payload was sampled at
+    uint32_t payloadLen;
+};
+
+struct LockstepAck {
+    uint32_t magic;
+    uint32_t seq;        // seq of the frame being acknowledged
+};
+#pragma pack(pop)
+
+// Pure virtual interface for the lockstep link (mirrors SpiInterface)
+class LockstepTransport {
+public:
+    virtual ~LockstepTransport() = default;
+    virtual bool init() = 0;
+    // Sends one complete frame (header + payload).
+    virtual bool send(const uint8_t* data, size_t len) = 0;
+    // Blocks until the ack for seq arrives. False on timeout or a dead peer.
+    virtual bool waitAck(uint32_t seq) = 0;
+};
+
+// Acknowledges every frame immediately, in process. Useful for reproducible
+// headless runs and for checking the sim side on its own.
+class LoopbackTransport : public LockstepTransport {
+public:
+    bool init() override { return true; }
+    bool send(const uint8_t* data, size_t len) override { sent++; return true; }
+    bool waitAck(uint32_t seq) override { return true; }
+
+    uint64_t getSent() const { return sent; }
+
+private:
+    uint64_t sent = 0;
+};
+
+// SOCK_SEQPACKET Unix socket. The sim listens on path and waits for one
+// consumer (e.g. a host build of the test_node scheduler) to connect.
+class UnixSocketTransport : public LockstepTransport {
+public:
+    explicit UnixSocketTransport(std::string path, int ackTimeoutMs = 1000);
+    ~UnixSocketTransport() override;
+
+    bool init() override;
+    bool send(const uint8_t* data, size_t len) override;
+    bool waitAck(uint32_t seq) override;
+
+private:
+    std::string path;
+    int ackTimeoutMs;
+    int listenFd = -1;
+    int fd = -1;
+};
+
+// Lockstep with the test_node itself over SPI. Each frame goes out in one
+// full node transfer behind the clock-sync marker, so the node answers it
+// with its MISO status but never injects it. The ack is the node's own
+// transfer count: NodeStatus.seq of a later transfer has to show the node
+// completed the one that carried the frame. waitAck() polls with further
+// sync transfers until it does, or gives up after maxPolls.
+class SpiLockstepTransport : public LockstepTransport {
+public:
+    explicit SpiLockstepTransport(SpiInterface& spi, int maxPolls = 100);
+
+    // One sync transfer; fails if the node does not answer with a status.
+    bool init() override;
+    bool send(const uint8_t* data, size_t len) override;
+    bool waitAck(uint32_t seq) override;
+
+    uint64_t getPolls() const { return polls; }
+
+private:
+    bool exchange(NodeStatus& status);
+
+    SpiInterface& spi;
+    int maxPolls;
+    std::array<uint8_t, NODE_FRAME_SIZE> tx{};
+    std::array<uint8_t, NODE_FRAME_SIZE> rx{};
+    uint32_t ackAt = 0;  // node transfer count once our last frame is done
+    uint64_t polls = 0;  // ack polls beyond the first, for diagnostics
+};
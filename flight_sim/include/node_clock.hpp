@@ -0,0 +1,101 @@
+// Tracks the test_node's µs clock against ours, continuously, from the
+// timestamps in its MISO status (node_status.hpp). There is no handshake:
+// every status carries the node time at which the previous transfer ended,
+// and we know our own time for that transfer, so each pair of consecutive
+// statuses is one observation of the two clocks.
+//
+// The model is node = nodeRef + (1 + skew) * (pi - piRef). Each observation's
+// error against it drives a second-order loop, as in a PLL: the proportional
+// term pulls the offset in and the integral term learns the skew, so a
+// steady crystal drift is followed with no standing error. The loop starts
+// wide to acquire quickly and narrows to tauMaxS to average the timestamp
+// jitter out. Observations far off the model compared with the recent spread
+// (a preempted ioctl, a late node thread) are dropped; a long run of them
+// widens the gate again, and if even the widest gate keeps failing, or the
+// node reboots, acquisition restarts from the next observation.
+//
+// Everything is 64-bit µs. SensorPacket.timestamp_us is the low 32 bits of
+// the node time; the node compares it modulo 2^32, so its 71.6 min counter
+// wrap needs no special handling here.
+
+#pragma once
+
+#include <cstdint>
+#include "node_status.hpp"
+
+struct NodeClockConfig {
+    double tauMinS = 0.5;         // loop time constant while acquiring
+    double tauMaxS = 8.0;         // loop time constant once settled
+    double gateUs = 20;           // narrowest drop threshold on the model error
+    double acquireGateUs = 2000;  // widest, used right after locking
+    uint32_t maxRejects = 50;     // consecutive drops before widening / re-acquiring
+    // Our end-of-transfer timestamp minus the node's, for the same transfer.
+    // Not observable from the pairs themselves; calibrate it once per setup
+    // (scope on NSS and an injection GPIO). Its error is a constant
+    // injection bias, everything else is filtered.
+    double latencyUs = 0;
+};
+
+class NodeClock {
+public:
+    explicit NodeClock(NodeClockConfig config = {}) : config(config) {}
+
+    // Feed every status that decoded, with our time right after the
+    // transfer that carried it returned. Pairs it with the previous one
+    // when the node completed exactly one transfer in between.
+    void onStatus(const NodeStatus& status, uint64_t piUs);
+
+    // Forget the model, e.g. after the link was reopened.
+    void reset();
+
+    bool locked() const { return haveModel; }
+    bool settled() const { return haveModel && tauS() >= config.tauMaxS; }
+
+    // Node time at our time piUs, and back. Only meaningful once locked.
+    uint64_t toNode(uint64_t piUs) const;
+    uint64_t toPi(uint64_t nodeUs) const;
+
+    // SensorPacket.timestamp_us for something due at our time piUs.
+    uint32_t packetTimestamp(uint64_t piUs) const { return uint32_t(toNode(piUs)); }
+
+    // The 64-bit node time nearest ref with these low 32 bits, for raw
+    // counter values such as MotorSample::tsUs.
+    static uint64_t unwrap(uint32_t nodeUs, uint64_t ref);
+
+    double skewPpm() const { return skew * 1e6; }
+    double lastErrorUs() const { return lastError; }
+    double gateNowUs() const;
+    uint64_t getObservations() const { return observations; }
+    uint64_t getRejects() const { return rejects; }
+    uint32_t getRelocks() const { return relocks; }
+
+private:
+    NodeClockConfig config;
+
+    // Model
+    bool haveModel = false;
+    uint64_t piRef = 0;
+    double nodeRef = 0;           // node µs at piRef, fractional
+    double skew = 0;              // node µs per our µs, minus one
+    double spread = 0;            // running mean |error| of accepted observations
+    uint64_t lockPi = 0;          // piRef when acquisition (re)started
+
+    // Pairing
+    bool haveLast = false;
+    uint32_t lastSeq = 0;
+    uint64_t lastPiUs = 0;
+
+    // Stats
+    double lastError = 0;
+    uint32_t rejectRun = 0;
+    uint64_t observations = 0;
+    uint64_t rejects = 0;
+    uint32_t relocks = 0;
+
+    double tauS() const;
+    void observe(uint64_t nodeUs, uint64_t piUs);
+    void lock(uint64_t nodeUs, uint64_t piUs);
+};
+
+// Our clock: monotonic µs, the time base NodeClock's pi side is in.
+uint64_t piNowUs();
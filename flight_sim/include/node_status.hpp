@@ -0,0 +1,63 @@
+// Status the test_node sends back on MISO in every SPI transfer: captured
+// motor PWM duties, DUT I2C activity, node health counters and node
+// timestamps. The node fills its half of the same transfer that carries our
+// SensorPacket, so reading it costs no extra bus time.
+//
+// Wire format is defined in test_node/lib/hil_core/include/hil_core/miso.h
+// (version 3); decodeNodeStatus() must track it.
+//
+// Node times are µs in the node's injection counter epoch, the same one
+// SensorPacket timestamps are in. rxDoneUs and fillUs are 64-bit and never
+// wrap; sample tsUs is the raw 32-bit counter (see NodeClock::unwrap).
+// rxDoneUs is when the node finished the transfer that carried status
+// seq - 1; together with our own end time for that transfer it is one
+// observation of the two clocks, which NodeClock tracks.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr size_t NODE_FRAME_SIZE = 256;       // every transfer, both directions
+constexpr uint8_t NODE_STATUS_MAGIC = 0xD3;
+constexpr uint8_t NODE_STATUS_VERSION = 3;
+
+// One time-aligned motor command sample, all four ESC outputs of one update.
+struct MotorSample {
+    uint32_t tsUs = 0;                    // node time of the completing capture, wraps
+    std::array<uint16_t, 4> duty{};       // Q0.16, 0xFFFF = 100 %
+    uint16_t periodUs = 0;
+    uint8_t fresh = 0;                    // bit ch set: duty[ch] is from this update
+
+    double dutyFraction(size_t ch) const { return duty[ch] / 65535.0; }
+};
+
+// Running totals since node boot, in wire order.
+struct NodeCounters {
+    uint32_t spiRx = 0;
+    uint32_t decodeFail = 0;
+    uint32_t spiErr = 0;
+    uint32_t inject = 0;
+    uint32_t schedEvict = 0;
+    uint32_t superseded = 0;
+    uint32_t rcDrop = 0;
+    uint32_t imuRead = 0;                 // DUT I2C reads of the IMU
+    uint32_t lidarRead = 0;               // DUT I2C reads of the LiDAR
+};
+
+struct NodeStatus {
+    uint32_t seq = 0;                     // transfers the node completed before this one
+    uint64_t rxDoneUs = 0;                // node time transfer seq - 1 completed
+    uint64_t fillUs = 0;                  // node time this status was filled
+    uint32_t lost = 0;                    // motor samples the node dropped so far
+    NodeCounters counters;
+    bool hasLatest = false;
+    MotorSample latest;                   // newest sample, repeated until replaced
+    std::vector<MotorSample> samples;     // samples not sent before, oldest first
+};
+
+// Decodes the MISO half of one transfer. False if it holds no status
+// (node not running, not yet armed, or a different wire version).
+bool decodeNodeStatus(const uint8_t* frame, size_t len, NodeStatus& out);
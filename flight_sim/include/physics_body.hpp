@@ -37,8 +37,9 @@ public:
     virtual ~PhysicsBody() = default;
 
     double getMass() const { return mass; }
-    Eigen::Vector3d getPosition() const { return position; }
-    Eigen::Vector3d getVelocity() const { return velocity; }
+    // Virtual so composites (e.g. Drone) can report the state of their parts.
+    virtual Eigen::Vector3d getPosition() const { return position; }
+    virtual Eigen::Vector3d getVelocity() const { return velocity; }
     Eigen::Vector3d getAcceleration() const { return acceleration; }
     Eigen::Vector3d getNetForce() const { return total_force; }
     Eigen::Quaterniond getOrientation() const { return orientation; }
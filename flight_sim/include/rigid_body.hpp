@@ -5,6 +5,9 @@
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
+class StateWriter;
+class StateReader;
+
 struct RigidBodyDerivative {
     Eigen::Vector3d dPosition;
     Eigen::Vector3d dVelocity;
@@ -25,8 +28,8 @@ public:
     void clearAccumulators();
     void update(double dt) override;
 
-    Eigen::Vector3d getPosition() const;
-    Eigen::Vector3d getVelocity() const;
+    Eigen::Vector3d getPosition() const override;
+    Eigen::Vector3d getVelocity() const override;
     Eigen::Vector3d getAngularVelocity() const { return angularVelocity; }
     void setAngularVelocity(const Eigen::Vector3d& w) { angularVelocity = w; }
     void setAccelerationWorld(const Eigen::Vector3d& a) { acceleration = a; }
@@ -40,6 +43,10 @@ public:
     void setBounds(double x, double y, double z) { x_bound = x; y_bound = y; z_bound = z; }
     Eigen::Vector3d getGravityVector() const { return GRAV; }
 
+    // Full dynamic state, for Simulation checkpoints.
+    virtual void saveState(StateWriter& out) const;
+    virtual void restoreState(StateReader& in);
+
     bool isColliding(RigidBody* col_body);
     void applyGravity(RigidBody* body, RigidBody* ground);
     void goToXWall(RigidBody* body, RigidBody* x_wall);
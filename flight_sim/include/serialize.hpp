@@ -1,4 +1,22 @@
-#include <flight_sim.hpp>
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <imu_generation.hpp>
 
 // Method to serialize data
-extern uint8_t* serialize(const imu_data_t& data, uint8_t *buffer);
\ No newline at end of file
+extern uint8_t* serialize(const imu_data_t& data, uint8_t *buffer);
+
+// Fills a whole NODE_FRAME_SIZE node frame with one SensorPacket:
+// [LEN_LO][LEN_HI][protobuf payload][zero pad] (shared/proto/sensor_data.proto).
+// timestampUs is the node time the sample is due at (NodeClock::packetTimestamp).
+// Returns the payload length, or 0 if it does not fit the frame.
+size_t serializeSensorFrame(const imu_data_t& imu, uint32_t timestampUs, uint8_t* frame);
+
+// Bytes of a sync frame the marker takes; the node ignores everything after it.
+constexpr size_t NODE_SYNC_HDR_SIZE = 6;
+
+// Fills a whole node frame with the clock-sync marker. The node counts and
+// ignores it but still answers with its MISO status, so it keeps the link
+// and the clock servo going while there is no node time to stamp packets with.
+void serializeSyncFrame(uint8_t* frame);
@@ -0,0 +1,135 @@
+// Shared-memory sensor bus. flight_sim publishes one ShmSimFrame per step
+// into a POSIX shared-memory ring; any number of local processes (SPI
+// bridge, visualizer, logger, dashboard bridge) map it read-only and keep
+// their own cursor.
+//
+// Each slot is a seqlock: the writer never waits for readers, and a reader
+// that falls more than SLOT_COUNT frames behind sees the overrun and skips
+// ahead instead of slowing the sim down.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+constexpr uint32_t SHM_BUS_MAGIC   = 0x53484D42; // "SHMB"
+constexpr uint32_t SHM_BUS_VERSION = 1;
+
+// One step of sim output. Plain fixed-width fields so non-C++ readers
+// (e.g. Python struct) can decode it straight from the mapping.
+struct ShmSimFrame {
+    uint64_t step;              // publisher step counter
+    int64_t  simTimeNs;
+    double   position[3];       // world frame (m)
+    double   velocity[3];       // world frame (m/s)
+    double   orientation[4];    // quaternion x, y, z, w
+    double   angularVelocity[3];// body frame (rad/s)
+    double   commandForce[3];   // controller output (N)
+    double   wind[3];           // air velocity at the drone, mean + gust (m/s)
+    double   imuTime;           // sim time of the IMU sample (s)
+    uint8_t  imu[36];           // packed register image, as serialize() writes it
+    uint8_t  reserved[4];
+};
+static_assert(std::is_trivially_copyable_v<ShmSimFrame>);
+static_assert(sizeof(ShmSimFrame) == 216);
+
+class ShmBus {
+public:
+    static constexpr uint32_t SLOT_COUNT = 256; // power of two
+
+    struct Slot {
+        // 2n+1 while frame n is being written, 2n+2 once it is complete.
+        std::atomic<uint64_t> seq;
+        ShmSimFrame frame;
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t slotCount;
+        uint32_t frameSize;
+        std::atomic<uint64_t> published; // frames completed so far
+    };
+
+    struct Layout {
+        Header header;
+        alignas(64) Slot slots[SLOT_COUNT];
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "seqlock needs lock-free 64-bit atomics across processes");
+};
+
+// Owns the shared-memory object. Created by flight_sim.
+class ShmBusWriter {
+public:
+    explicit ShmBusWriter(std::string name);
+    ~ShmBusWriter();
+
+    bool init();
+    void publish(const ShmSimFrame& frame);
+
+    uint64_t getPublished() const;
+
+private:
+    std::string name;
+    ShmBus::Layout* bus = nullptr;
+};
+
+// Read-only view for consumers. Each reader has its own cursor.
+class ShmBusReader {
+public:
+    enum class Result { Ok, Empty, Overrun };
+
+    explicit ShmBusReader(std::string name);
+    ~ShmBusReader();
+
+    // Maps an existing bus. Starts at the newest frame unless fromOldest.
+    bool init(bool fromOldest = false);
+
+    // Copies the next frame into out and advances the cursor. Overrun means
+    // the writer lapped this reader; the cursor has been moved to the oldest
+    // frame still in the ring and the caller should read again.
+    Result read(ShmSimFrame& out);
+
+    // Zero-copy variant: calls fn(const ShmSimFrame&) on the mapped slot and
+    // only advances if the slot was not overwritten meanwhile. fn must not
+    // keep the reference.
+    template <typename Fn>
+    Result visit(Fn&& fn);
+
+    uint64_t getCursor() const { return cursor; }
+    uint64_t getDropped() const { return dropped; }
+
+private:
+    std::string name;
+    const ShmBus::Layout* bus = nullptr;
+    uint64_t cursor = 0;
+    uint64_t dropped = 0;
+
+    Result check(uint64_t& published);
+};
+
+template <typename Fn>
+ShmBusReader::Result ShmBusReader::visit(Fn&& fn) {
+    uint64_t published;
+    Result r = check(published);
+    if (r != Result::Ok) {
+        return r;
+    }
+
+    const ShmBus::Slot& slot = bus->slots[cursor % ShmBus::SLOT_COUNT];
+    const uint64_t expect = 2 * cursor + 2;
+    if (slot.seq.load(std::memory_order_acquire) != expect) {
+        return Result::Overrun;
+    }
+    fn(slot.frame);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) != expect) {
+        return Result::Overrun;
+    }
+    cursor++;
+    return Result::Ok;
+}
@@ -0,0 +1,238 @@
+// Stock components for the Simulation kernel (see simulation.hpp).
+// Each one wraps a piece of what main() used to do inline every loop
+// iteration, and runs only when its declared rate says it is due.
+//
+// Components do not own the objects they drive; main() owns the drone,
+// controllers and IMU model and hands references in.
+
+#pragma once
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "simulation.hpp"
+#include "drone.hpp"
+#include "environment.hpp"
+#include "imu_generation.hpp"
+#include "lockstep_transport.hpp"
+#include "node_clock.hpp"
+#include "node_status.hpp"
+#include "positionController.hpp"
+#include "shm_bus.hpp"
+#include "spi_interface.hpp"
+#include "velocityController.hpp"
+#include <Eigen/Dense>
+
+struct Waypoint {
+    double time;
+    Eigen::Vector3d position;
+};
+
+// Latest values passed between components. Written by one component,
+// read by the ones that run after it.
+struct SimBus {
+    Eigen::Vector3d commandForce = Eigen::Vector3d::Zero(); // controller output, world frame (N)
+    imu_data_t imu{};                                       // latest IMU sample
+    double imuTime = 0.0;                                   // sim time of that sample (s)
+    Eigen::Vector3d wind = Eigen::Vector3d::Zero();         // air velocity at the drone, mean + gust (m/s)
+    NodeStatus node;                                        // latest status from the test_node
+    bool nodeValid = false;                                 // node has answered at least once
+    NodeClock nodeClock;                                    // node time model, fed by SpiEmitComponent
+};
+
+// Switches the position setpoint when each waypoint's time is reached.
+// Aperiodic: it is due exactly at the next waypoint's timestamp.
+class WaypointComponent : public SimComponent {
+public:
+    WaypointComponent(std::vector<Waypoint> path, positionController& control);
+
+    const char* name() const override { return "waypoint"; }
+    void step(Simulation& sim, double dt) override;
+    SimTimeNs nextDue() const override;
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
+    size_t getCursor() const { return cursor; }
+
+private:
+    std::vector<Waypoint> path;
+    positionController& control;
+    size_t cursor = 0;
+};
+
+// Position -> velocity -> force cascade. Publishes the commanded force.
+class ControllerComponent : public SimComponent {
+public:
+    ControllerComponent(Drone& drone, positionController& position,
+                        velocityController& velocity, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "controller"; }
+    void step(Simulation& sim, double dt) override;
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
+private:
+    Drone& drone;
+    positionController& position;
+    velocityController& velocity;
+    SimBus& bus;
+};
+
+// ESC pulse range and thrust of one motor, for turning captured PWM into force.
+struct MotorParams {
+    double minPulseUs = 1000.0;   // pulse for zero throttle
+    double maxPulseUs = 2000.0;   // pulse for full throttle
+    double maxThrustN = 15.0;     // per motor at full throttle
+};
+
+// Closes the HIL loop: once the test_node reports motor samples in its MISO
+// status, the DUT's four PWM outputs replace the sim controller's force.
+// Each duty becomes a pulse width and a throttle, thrust is linear in
+// throttle, and the sum acts along the drone's body z axis. The sim has no
+// attitude dynamics yet, so differential thrust is not modelled. Until the
+// first sample arrives the controller's force stands. Runs in the controller
+// phase, after ControllerComponent.
+class MotorComponent : public SimComponent {
+public:
+    MotorComponent(Drone& drone, const MotorParams& params, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "motors"; }
+    void step(Simulation& sim, double dt) override;
+
+    // Thrust of motor ch in sample s (N).
+    static double thrust(const MotorSample& s, size_t ch, const MotorParams& params);
+
+private:
+    Drone& drone;
+    MotorParams params;
+    SimBus& bus;
+};
+
+// Evaluates the Environment for the drone: gusts on top of the Simulation's
+// mean wind, quadratic drag and ground effect on the commanded thrust.
+// Runs after the controller and before physics integrates the forces, and
+// publishes the resulting air velocity as bus.wind.
+class EnvironmentComponent : public SimComponent {
+public:
+    EnvironmentComponent(Drone& drone, Environment& env, const AeroParams& params,
+                         SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "environment"; }
+    void step(Simulation& sim, double dt) override;
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
+private:
+    Environment& env;
+    SimBus& bus;
+    size_t droneIndex;
+};
+
+// Applies gravity and the latest commanded force, then integrates.
+class PhysicsComponent : public SimComponent {
+public:
+    PhysicsComponent(Drone& drone, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "physics"; }
+    void step(Simulation& sim, double dt) override;
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
+private:
+    Drone& drone;
+    SimBus& bus;
+};
+
+// Samples the IMU model and publishes the packed register image.
+class ImuComponent : public SimComponent {
+public:
+    ImuComponent(Drone& drone, ImuSimulator& imu, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "imu"; }
+    void step(Simulation& sim, double dt) override;
+    void saveState(StateWriter& out) const override;
+    void restoreState(StateReader& in) override;
+
+private:
+    Drone& drone;
+    ImuSimulator& imu;
+    SimBus& bus;
+};
+
+// Console trace + pid_tuning.csv, same columns as before.
+class LoggerComponent : public SimComponent {
+public:
+    LoggerComponent(Drone& drone, positionController& position, SimBus& bus,
+                    const std::string& csvPath, uint32_t rateHz);
+
+    const char* name() const override { return "logger"; }
+    void step(Simulation& sim, double dt) override;
+
+private:
+    Drone& drone;
+    positionController& position;
+    SimBus& bus;
+    std::ofstream logFile;
+};
+
+// Sends the latest IMU sample to the test_node as a framed SensorPacket.
+// The transfer is a full node frame, so the node's MISO status comes back in
+// it and is published as bus.node, and its timestamps keep bus.nodeClock in
+// step. Once the clock is locked, each packet is stamped with the node time
+// leadUs after the transfer starts, which is when the node injects it; until
+// then only sync frames go out, which the node answers but never injects.
+class SpiEmitComponent : public SimComponent {
+public:
+    SpiEmitComponent(SpiInterface& spi, SimBus& bus, uint32_t rateHz,
+                     uint32_t leadUs = 2000);
+
+    const char* name() const override { return "spi_emit"; }
+    void step(Simulation& sim, double dt) override;
+
+    // timestamp_us of the last SensorPacket sent (none while unlocked).
+    uint32_t getLastTimestamp() const { return lastTimestamp; }
+    uint64_t getPacketsSent() const { return packetsSent; }
+
+private:
+    SpiInterface& spi;
+    SimBus& bus;
+    uint32_t leadUs;
+    uint32_t lastTimestamp = 0;
+    uint64_t packetsSent = 0;
+    std::array<uint8_t, NODE_FRAME_SIZE> frame{};
+    std::array<uint8_t, NODE_FRAME_SIZE> rx{};
+};
+
+// Lockstep with an external consumer: sends the latest IMU sample each step
+// and blocks until the consumer acks it. Stops the Simulation if the link
+// fails. Run the Simulation with runUntil(); the consumer sets the pace.
+class LockstepComponent : public SimComponent {
+public:
+    static constexpr size_t PAYLOAD_SIZE = 36; // bytes written by serialize()
+
+    LockstepComponent(LockstepTransport& link, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "lockstep"; }
+    void step(Simulation& sim, double dt) override;
+
+private:
+    LockstepTransport& link;
+    SimBus& bus;
+    std::array<uint8_t, sizeof(LockstepHeader) + PAYLOAD_SIZE> frame{};
+};
+
+// Publishes the drone state and latest IMU sample to the shared-memory bus
+// every step. Never blocks on readers.
+class ShmPublishComponent : public SimComponent {
+public:
+    ShmPublishComponent(ShmBusWriter& shm, Drone& drone, SimBus& bus, uint32_t rateHz);
+
+    const char* name() const override { return "shm_publish"; }
+    void step(Simulation& sim, double dt) override;
+
+private:
+    ShmBusWriter& shm;
+    Drone& drone;
+    SimBus& bus;
+};
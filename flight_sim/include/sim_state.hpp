@@ -0,0 +1,95 @@
+// Binary state blob used for Simulation checkpoints.
+//
+// Values are written raw in host byte order: a blob is meant to be restored
+// by the same build on the same machine (forking runs of a sweep), not
+// archived or sent across the wire.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+class StateWriter {
+public:
+    // Appends to out. Reusing the same vector across checkpoints keeps its
+    // capacity, so steady-state snapshots do not allocate.
+    explicit StateWriter(std::vector<uint8_t>& out) : out(out) {}
+
+    template <typename T>
+    void put(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "put() needs a trivially copyable type");
+        putBytes(&value, sizeof(T));
+    }
+
+    void put(const Eigen::Vector3d& v) { putBytes(v.data(), sizeof(double) * 3); }
+    void put(const Eigen::Matrix3d& m) { putBytes(m.data(), sizeof(double) * 9); }
+    void put(const Eigen::Quaterniond& q) { putBytes(q.coeffs().data(), sizeof(double) * 4); }
+
+    void putBytes(const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        out.insert(out.end(), p, p + size);
+    }
+
+    // Reserve a u32 now and fill it in later (e.g. a length prefix).
+    size_t reserveU32() {
+        size_t at = out.size();
+        put<uint32_t>(0);
+        return at;
+    }
+    void patchU32(size_t at, uint32_t value) { std::memcpy(out.data() + at, &value, sizeof(value)); }
+
+    size_t size() const { return out.size(); }
+
+private:
+    std::vector<uint8_t>& out;
+};
+
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : cur(data), end(data + size) {}
+
+    // On underrun the reader latches !ok() and leaves the value untouched.
+    template <typename T>
+    void get(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "get() needs a trivially copyable type");
+        getBytes(&value, sizeof(T));
+    }
+
+    void get(Eigen::Vector3d& v) { getBytes(v.data(), sizeof(double) * 3); }
+    void get(Eigen::Matrix3d& m) { getBytes(m.data(), sizeof(double) * 9); }
+    void get(Eigen::Quaterniond& q) { getBytes(q.coeffs().data(), sizeof(double) * 4); }
+
+    void getBytes(void* data, size_t size) {
+        if (!valid || (size_t)(end - cur) < size) {
+            valid = false;
+            return;
+        }
+        std::memcpy(data, cur, size);
+        cur += size;
+    }
+
+    bool skip(size_t size) {
+        if (!valid || (size_t)(end - cur) < size) {
+            valid = false;
+            return false;
+        }
+        cur += size;
+        return true;
+    }
+
+    // Marks the blob as unusable (e.g. a layout mismatch the caller detected).
+    void fail() { valid = false; }
+
+    const uint8_t* position() const { return cur; }
+    size_t remaining() const { return (size_t)(end - cur); }
+    bool ok() const { return valid; }
+
+private:
+    const uint8_t* cur;
+    const uint8_t* end;
+    bool valid = true;
+};
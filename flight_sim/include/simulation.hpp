@@ -1,28 +1,168 @@
-// Orchestrator for simluation
-// Put stuff in here and test stuff in here accordingly
+// Orchestrator for simulation
+// Event-driven kernel: components declare when they are due and the
+// Simulation runs each one exactly at that time, in timestamp order.
 
 #pragma once
 
-#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <vector>
 #include "physics_body.hpp"
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
+class Simulation;
+class StateWriter;
+class StateReader;
+
+// Tie-break order for components that are due at the same instant.
+// Lower runs first, mirroring the order the old main() loop used.
+enum class SimPhase : uint8_t {
+    Waypoint   = 0,   // trajectory / setpoint switching
+    Controller  = 1,  // position + velocity control
+    Environment = 2,  // wind, drag, ground effect forces
+    Physics     = 3,  // force application and integration
+    Sensor      = 4,  // sampling the new physical state
+    Output      = 5,  // logging, SPI emit, anything that consumes samples
+};
+
+// Sim time is kept in integer nanoseconds so components with related rates
+// (e.g. 120 Hz and 60 Hz) land on exactly the same instants.
+using SimTimeNs = int64_t;
+constexpr SimTimeNs SIM_NEVER = std::numeric_limits<SimTimeNs>::max();
+constexpr SimTimeNs NS_PER_SEC = 1000000000LL;
+
+inline double nsToSeconds(SimTimeNs t) { return (double)t / (double)NS_PER_SEC; }
+inline SimTimeNs secondsToNs(double t) { return (SimTimeNs)std::llround(t * (double)NS_PER_SEC); }
+
+class SimComponent {
+public:
+    // rateHz == 0 declares an aperiodic component; it must override nextDue().
+    SimComponent(SimPhase phase, uint32_t rateHz) : phase(phase), rateHz(rateHz) {}
+    virtual ~SimComponent() = default;
+
+    virtual const char* name() const = 0;
+
+    // Called when the component is due. dt is the declared period (0 when aperiodic).
+    virtual void step(Simulation& sim, double dt) = 0;
+
+    // Absolute sim time of the next firing, or SIM_NEVER to retire.
+    // Periodic components fire at ticks / rateHz, computed from the tick count
+    // so rounding never accumulates.
+    virtual SimTimeNs nextDue() const {
+        if (rateHz == 0) return SIM_NEVER;
+        return (SimTimeNs)((ticks * (uint64_t)NS_PER_SEC) / rateHz);
+    }
+
+    // State the component carries between steps (cursors, integrators, the
+    // objects it drives). Default: none. The Simulation saves ticks itself.
+    virtual void saveState(StateWriter& out) const {}
+    virtual void restoreState(StateReader& in) {}
+
+    SimPhase getPhase() const { return phase; }
+    uint32_t getRateHz() const { return rateHz; }
+    uint64_t getTicks() const { return ticks; }
+
+protected:
+    // Number of completed firings; advanced by the Simulation after step().
+    uint64_t ticks = 0;
+
+private:
+    friend class Simulation;
+    SimPhase phase;
+    uint32_t rateHz;
+};
+
 class Simulation {
 
     private:
 
+        struct SimEvent {
+            SimTimeNs time;
+            uint8_t phase;
+            uint32_t component;
+
+            // std::priority_queue is a max-heap; invert so the earliest event wins.
+            bool operator<(const SimEvent& other) const {
+                if (time != other.time) return time > other.time;
+                if (phase != other.phase) return phase > other.phase;
+                return component > other.component;
+            }
+        };
+
         // Fields
-        double delta_t;
-        double t;
-        
-        // Example Environmental Constants
-        // And other forces...
+        SimTimeNs t;
+        bool stopped;
+
+        // Environmental Constants
+        // wind is the mean air velocity; EnvironmentComponent adds gusts and drag.
         Eigen::Vector3d wind;
         Eigen::Vector3d gravity;
 
+        std::vector<std::unique_ptr<SimComponent>> components;
+        std::priority_queue<SimEvent> events;
+
+        void schedule(uint32_t index);
+
+        // restore() without the rollback: may leave the state half-applied
+        // when it returns false.
+        bool apply(const uint8_t* data, size_t size);
+
     public:
         // Constructors
-        Simulation() : delta_t(0.01), t(0.0), wind(Eigen::Vector3d::Zero()), gravity(Eigen::Vector3d(0, 0, -9.81)) {}
+        Simulation() : t(0), stopped(false), wind(Eigen::Vector3d::Zero()), gravity(Eigen::Vector3d(0, 0, -9.81)) {}
+
+        // Takes ownership and schedules the component's first firing.
+        template <typename T>
+        T& addComponent(std::unique_ptr<T> component) {
+            T& ref = *component;
+            components.push_back(std::move(component));
+            schedule((uint32_t)(components.size() - 1));
+            return ref;
+        }
+
+        template <typename T, typename... Args>
+        T& emplaceComponent(Args&&... args) {
+            return addComponent(std::make_unique<T>(std::forward<Args>(args)...));
+        }
+
+        // Runs the single earliest event. Returns false once nothing is left.
+        bool stepEvent();
+
+        // Runs every event due before tEnd (seconds), as fast as possible.
+        void runUntil(double tEnd);
+
+        // Same as runUntil, but each event waits for the wall clock to reach it.
+        void runRealtime(double tEnd);
+
+        // Snapshot of sim time, wind/gravity, every component's tick count and
+        // its saveState() payload. blob is cleared and refilled; reuse it to
+        // avoid reallocating.
+        void checkpoint(std::vector<uint8_t>& blob) const;
+
+        // Restores a checkpoint into this Simulation. The component list must
+        // match the one that produced it (same types, same order), which is
+        // how a run is forked: build the same scenario again and restore.
+        // Returns false, leaving the state untouched, if the layout or any
+        // component's payload does not match.
+        bool restore(const uint8_t* data, size_t size);
+        bool restore(const std::vector<uint8_t>& blob) { return restore(blob.data(), blob.size()); }
+
+        // Asks run loops to return after the current event.
+        void stop() { stopped = true; }
+
+        // Time of the next pending event, or SIM_NEVER.
+        SimTimeNs peekNextTime() const { return events.empty() ? SIM_NEVER : events.top().time; }
+
+        double getTime() const { return nsToSeconds(t); }
+        SimTimeNs getTimeNs() const { return t; }
+
+        Eigen::Vector3d getWind() const { return wind; }
+        Eigen::Vector3d getGravity() const { return gravity; }
+        void setWind(const Eigen::Vector3d& w) { wind = w; }
+        void setGravity(const Eigen::Vector3d& g) { gravity = g; }
 
-};
\ No newline at end of file
+};
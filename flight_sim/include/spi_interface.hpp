@@ -8,4 +8,35 @@ public:
     virtual ~SpiInterface() = default;
     virtual bool init() = 0;
     virtual bool transmit(const uint8_t* data, size_t len) = 0;
+    // Full duplex: clocks tx out and fills rx with what the node sent back
+    // in the same transfer. Both buffers are len bytes.
+    virtual bool transfer(const uint8_t* tx, uint8_t* rx, size_t len) = 0;
+};
+
+// No hardware: logs every frame to spi_payload.log and reads MISO back as
+// zeros, so the node never answers.
+class SpiStub : public SpiInterface {
+public:
+    bool init() override;
+    bool transmit(const uint8_t* data, size_t len) override;
+    bool transfer(const uint8_t* tx, uint8_t* rx, size_t len) override;
+};
+
+// spidev master, e.g. /dev/spidev0.0 on the Pi. Mode 0, 8-bit words.
+class SpiLinux : public SpiInterface {
+public:
+    explicit SpiLinux(const char* dev = "/dev/spidev0.0", uint8_t mode = 0,
+                      uint32_t speed = 500000, uint8_t bits = 8);
+    ~SpiLinux() override;
+
+    bool init() override;
+    bool transmit(const uint8_t* data, size_t len) override;
+    bool transfer(const uint8_t* tx, uint8_t* rx, size_t len) override;
+
+private:
+    const char* devPath;
+    uint8_t mode;
+    uint32_t speed;
+    uint8_t bits;
+    int fd = -1;
 };
@@ -3,6 +3,9 @@
 
 #include <Eigen/Dense>
 
+class StateWriter;
+class StateReader;
+
 class velocityController {
 public:
     velocityController();
@@ -15,6 +18,10 @@ public:
                             const Eigen::Vector3d& targetVelocity,
                             double dt);
 
+    // Integrator and derivative memory, for Simulation checkpoints.
+    void saveState(StateWriter& out) const;
+    void restoreState(StateReader& in);
+
     Eigen::Vector3d kp;
     Eigen::Vector3d ki;
     Eigen::Vector3d kd;
@@ -9,29 +9,29 @@ Drone::Drone() : RigidBody::RigidBody() {
     // TO DO: Come up with reasonable positional offsets for the drone parts
     // e.i. body at (0,0,0) or even (0,0,-3) or something, we decide
 
-    this->body = new RigidBody();
-    this->m1 = new RigidBody();
-    this->m2 = new RigidBody();
-    this->m3 = new RigidBody();
-    this->m4 = new RigidBody();
+    this->body = std::make_unique<RigidBody>();
+    this->m1 = std::make_unique<RigidBody>();
+    this->m2 = std::make_unique<RigidBody>();
+    this->m3 = std::make_unique<RigidBody>();
+    this->m4 = std::make_unique<RigidBody>();
 
     // No need to calculate or set other values because everything is zeroed out (I think)
 }
 
 Drone::Drone (
-        RigidBody* body,
-        RigidBody* m1,
-        RigidBody* m2,
-        RigidBody* m3,
-        RigidBody* m4
+        std::unique_ptr<RigidBody> body,
+        std::unique_ptr<RigidBody> m1,
+        std::unique_ptr<RigidBody> m2,
+        std::unique_ptr<RigidBody> m3,
+        std::unique_ptr<RigidBody> m4
 )   {
 
-    // Set fields
-    this->body = body;
-    this->m1 = m1;
-    this->m2 = m2;
-    this->m3 = m3;
-    this->m4 = m4;
+    // Set fields (Drone owns its parts)
+    this->body = std::move(body);
+    this->m1 = std::move(m1);
+    this->m2 = std::move(m2);
+    this->m3 = std::move(m3);
+    this->m4 = std::move(m4);
 
     // Mass
     this->mass = calculateMass();
@@ -137,3 +137,24 @@ void Drone::update(double dt) {
     this->angularVelocity = calculateAngularVelocity();
 
 }
+
+
+// Checkpoints
+
+void Drone::saveState(StateWriter& out) const {
+    RigidBody::saveState(out);
+    body->saveState(out);
+    m1->saveState(out);
+    m2->saveState(out);
+    m3->saveState(out);
+    m4->saveState(out);
+}
+
+void Drone::restoreState(StateReader& in) {
+    RigidBody::restoreState(in);
+    body->restoreState(in);
+    m1->restoreState(in);
+    m2->restoreState(in);
+    m3->restoreState(in);
+    m4->restoreState(in);
+}
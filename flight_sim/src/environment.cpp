@@ -0,0 +1,126 @@
+#include <environment.hpp>
+#include <sim_state.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// SplitMix64 finalizer; good enough to turn (seed, counter) into white noise.
+uint64_t mix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+// First-order Gauss-Markov update: exact discretisation of the Dryden
+// shaping filter sigma * sqrt(2L/(pi V)) / (1 + (L/V) s), which keeps the
+// gust's stationary variance at sigma^2 for any dt.
+double gaussMarkov(double state, double sigma, double lengthScale,
+                   double airspeed, double dt, double noise) {
+  if (sigma <= 0.0) {
+    return 0.0;
+  }
+  double a = std::exp(-dt * airspeed / lengthScale);
+  return a * state + sigma * std::sqrt(1.0 - a * a) * noise;
+}
+
+} // namespace
+
+Environment::Environment(const EnvironmentConfig &config) : config(config) {}
+
+size_t Environment::addBody(PhysicsBody &body, const AeroParams &params) {
+  bodies.push_back({&body, params, Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(),
+                    Eigen::Vector3d::Zero()});
+  return bodies.size() - 1;
+}
+
+double Environment::uniform() {
+  uint64_t bits = mix64(config.seed ^ mix64(noiseCounter++));
+  // 53 random mantissa bits in (0, 1]; never 0 so log() below is safe.
+  return ((bits >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+double Environment::gaussian() {
+  // Box-Muller, cosine branch only: two counter steps per sample.
+  double u1 = uniform();
+  double u2 = uniform();
+  return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+double Environment::groundEffectFactor(double height, double rotorRadius) {
+  if (rotorRadius <= 0.0) {
+    return 1.0;
+  }
+  double h = std::max(height, 0.5 * rotorRadius);
+  double r = rotorRadius / (4.0 * h);
+  return 1.0 / (1.0 - r * r);
+}
+
+void Environment::step(double dt, const Eigen::Vector3d &meanWind) {
+  if (dt <= 0.0) {
+    return;
+  }
+
+  for (AeroBody &b : bodies) {
+    Eigen::Vector3d velocity = b.body->getVelocity();
+    Eigen::Vector3d position = b.body->getPosition();
+
+    double airspeed =
+        std::max((velocity - meanWind).norm(), config.minAirspeed);
+    b.gust.x() =
+        gaussMarkov(b.gust.x(), config.turbulenceHorizontal,
+                    config.lengthScaleHorizontal, airspeed, dt, gaussian());
+    b.gust.y() =
+        gaussMarkov(b.gust.y(), config.turbulenceHorizontal,
+                    config.lengthScaleHorizontal, airspeed, dt, gaussian());
+    b.gust.z() =
+        gaussMarkov(b.gust.z(), config.turbulenceVertical,
+                    config.lengthScaleVertical, airspeed, dt, gaussian());
+    b.wind = meanWind + b.gust;
+
+    // Quadratic drag against the relative air velocity
+    Eigen::Vector3d relative = velocity - b.wind;
+    b.drag = -0.5 * config.airDensity * b.params.dragArea * relative.norm() *
+             relative;
+    b.body->applyForce(b.drag);
+
+    // Ground effect: extra lift on the upward part of the thrust
+    if (b.params.rotorRadius > 0.0 && b.thrust.z() > 0.0) {
+      double factor = groundEffectFactor(position.z() - config.groundHeight,
+                                         b.params.rotorRadius);
+      b.body->applyForce(Eigen::Vector3d(0, 0, (factor - 1.0) * b.thrust.z()));
+    }
+  }
+}
+
+void Environment::saveState(StateWriter &out) const {
+  out.put(noiseCounter);
+  out.put((uint32_t)bodies.size());
+  for (const AeroBody &b : bodies) {
+    out.put(b.gust);
+    out.put(b.thrust);
+    out.put(b.wind);
+    out.put(b.drag);
+  }
+}
+
+void Environment::restoreState(StateReader &in) {
+  uint64_t counter = 0;
+  uint32_t count = 0;
+  in.get(counter);
+  in.get(count);
+  if (!in.ok() || count != bodies.size()) {
+    in.fail(); // body layout differs
+    return;
+  }
+  noiseCounter = counter;
+  for (AeroBody &b : bodies) {
+    in.get(b.gust);
+    in.get(b.thrust);
+    in.get(b.wind);
+    in.get(b.drag);
+  }
+}
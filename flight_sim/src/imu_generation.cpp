@@ -1,8 +1,30 @@
 #include <flight_sim.hpp>
 
-ImuSimulator::ImuSimulator() : m_(0.0), I_(0.0) {}
+ImuSimulator::ImuSimulator()
+    : m_(0.0), I_(0.0), wx_(0.0f), wy_(0.0f), wz_(0.0f), roll_(0.0f),
+      pitch_(0.0f), yaw_(0.0f) {}
+
+ImuSimulator::ImuSimulator(float m, float moi)
+    : m_(m), I_(moi), wx_(0.0f), wy_(0.0f), wz_(0.0f), roll_(0.0f),
+      pitch_(0.0f), yaw_(0.0f) {}
+
+void ImuSimulator::saveState(StateWriter &out) const {
+  out.put(wx_);
+  out.put(wy_);
+  out.put(wz_);
+  out.put(roll_);
+  out.put(pitch_);
+  out.put(yaw_);
+}
 
-ImuSimulator::ImuSimulator(float m, float moi) : m_(m), I_(moi) {}
+void ImuSimulator::restoreState(StateReader &in) {
+  in.get(wx_);
+  in.get(wy_);
+  in.get(wz_);
+  in.get(roll_);
+  in.get(pitch_);
+  in.get(yaw_);
+}
 
 i2c_imu_data_16_t ImuSimulator::pack_16(int16_t value) {
   i2c_imu_data_16_t result;
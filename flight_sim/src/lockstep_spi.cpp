@@ -0,0 +1,52 @@
+#include <flight_sim.hpp>
+
+SpiLockstepTransport::SpiLockstepTransport(SpiInterface &spi, int maxPolls)
+    : spi(spi), maxPolls(maxPolls) {}
+
+bool SpiLockstepTransport::exchange(NodeStatus &status) {
+  return spi.transfer(tx.data(), rx.data(), tx.size()) &&
+         decodeNodeStatus(rx.data(), rx.size(), status);
+}
+
+bool SpiLockstepTransport::init() {
+  NodeStatus status;
+  serializeSyncFrame(tx.data());
+  if (!exchange(status)) {
+    std::cerr << "Lockstep: no status from the test_node on SPI.\n";
+    return false;
+  }
+  return true;
+}
+
+bool SpiLockstepTransport::send(const uint8_t *data, size_t len) {
+  if (len > NODE_FRAME_SIZE - NODE_SYNC_HDR_SIZE) {
+    std::cerr << "Lockstep frame too long for one SPI transfer.\n";
+    return false;
+  }
+  serializeSyncFrame(tx.data());
+  std::memcpy(tx.data() + NODE_SYNC_HDR_SIZE, data, len);
+
+  // The status in this transfer was filled before it, so it counts the
+  // transfers ahead of ours: ours completes the node's seq + 1-th.
+  NodeStatus status;
+  if (!exchange(status)) {
+    std::cerr << "Lockstep: SPI transfer failed or the node did not answer.\n";
+    return false;
+  }
+  ackAt = status.seq + 1;
+  return true;
+}
+
+bool SpiLockstepTransport::waitAck(uint32_t seq) {
+  serializeSyncFrame(tx.data());
+  for (int i = 0; i < maxPolls; i++) {
+    NodeStatus status;
+    if (exchange(status) && (int32_t)(status.seq - ackAt) >= 0) {
+      polls += (uint64_t)i;
+      return true;
+    }
+  }
+  std::cerr << "Lockstep: node never completed the transfer for seq " << seq
+            << "\n";
+  return false;
+}
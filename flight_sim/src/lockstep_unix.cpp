@@ -0,0 +1,83 @@
+#include <flight_sim.hpp>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+UnixSocketTransport::UnixSocketTransport(std::string path, int ackTimeoutMs)
+    : path(std::move(path)), ackTimeoutMs(ackTimeoutMs) {}
+
+UnixSocketTransport::~UnixSocketTransport() {
+  if (fd >= 0)
+    close(fd);
+  if (listenFd >= 0) {
+    close(listenFd);
+    unlink(path.c_str());
+  }
+}
+
+bool UnixSocketTransport::init() {
+  sockaddr_un addr{};
+  if (path.size() >= sizeof(addr.sun_path)) {
+    std::cerr << "Lockstep socket path too long: " << path << "\n";
+    return false;
+  }
+  addr.sun_family = AF_UNIX;
+  std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+  listenFd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+  if (listenFd < 0) {
+    std::cerr << "Failed to create lockstep socket.\n";
+    return false;
+  }
+  unlink(path.c_str());
+  if (bind(listenFd, (sockaddr *)&addr, sizeof(addr)) < 0 ||
+      listen(listenFd, 1) < 0) {
+    std::cerr << "Failed to bind lockstep socket: " << path << "\n";
+    return false;
+  }
+
+  std::cout << "[Lockstep] Waiting for consumer on " << path << "\n";
+  fd = accept(listenFd, nullptr, nullptr);
+  if (fd < 0) {
+    std::cerr << "Failed to accept lockstep consumer.\n";
+    return false;
+  }
+  std::cout << "[Lockstep] Consumer connected.\n";
+  return true;
+}
+
+bool UnixSocketTransport::send(const uint8_t *data, size_t len) {
+  // One frame per datagram; SEQPACKET keeps the boundaries for the reader.
+  ssize_t n = ::send(fd, data, len, MSG_NOSIGNAL);
+  if (n != (ssize_t)len) {
+    std::cerr << "Lockstep send failed.\n";
+    return false;
+  }
+  return true;
+}
+
+bool UnixSocketTransport::waitAck(uint32_t seq) {
+  for (;;) {
+    pollfd p{fd, POLLIN, 0};
+    int ready = poll(&p, 1, ackTimeoutMs);
+    if (ready <= 0) {
+      std::cerr << "Lockstep ack timeout at seq " << seq << "\n";
+      return false;
+    }
+
+    LockstepAck ack{};
+    ssize_t n = recv(fd, &ack, sizeof(ack), 0);
+    if (n != (ssize_t)sizeof(ack) || ack.magic != LOCKSTEP_ACK_MAGIC) {
+      std::cerr << "Lockstep consumer closed or sent a bad ack.\n";
+      return false;
+    }
+    // Stale acks (older seq) are dropped; anything newer is a protocol error.
+    if (ack.seq == seq)
+      return true;
+    if ((int32_t)(ack.seq - seq) > 0) {
+      std::cerr << "Lockstep ack from the future: " << ack.seq << " > " << seq
+                << "\n";
+      return false;
+    }
+  }
+}
@@ -1,31 +1,69 @@
-#include "imu_generation.hpp"
-#include <chrono>
 #include <flight_sim.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <stdio.h>
-#include <thread>
-
-void initializeLogging();
-void logData(double t, const Eigen::Vector3d &desiredPos,
-             const Eigen::Vector3d &currentPos, const Eigen::Vector3d &error,
-             const Eigen::Vector3d &controlOutput);
-void closeLogging();
-
-std::ofstream logFile;
-
-struct Waypoint {
-  double time;
-  Eigen::Vector3d position;
-};
+#include <memory>
+
+int main(int argc, char **argv) {
+  // --fast                     run as quickly as possible instead of in real time
+  // --checkpoint <sec> <file>  write the full sim state to <file> at <sec>
+  // --restore <file>           start from a checkpoint instead of t = 0
+  // --lockstep <path|loopback|spi>
+  //                            advance one step per consumer ack (implies --fast);
+  //                            spi steps with the test_node on the --spi bus
+  // --shm <name>               publish every step to a shared-memory bus
+  // --aero                     drag and ground effect on the drone (off by default)
+  // --wind <x,y,z>             mean wind, world frame (m/s; default calm)
+  // --turbulence <h> <v>       Dryden gust intensity, 1-sigma (m/s; default 0)
+  // --spi <dev|stub>           send each IMU sample to the test_node and fly on
+  //                            the motor PWM it captures from the DUT
+  bool fast = false;
+  const char *spiPath = nullptr;
+  const char *lockstepPath = nullptr;
+  const char *shmName = nullptr;
+  bool aero = false;
+  Eigen::Vector3d meanWind(0, 0, 0);
+  double turbulenceH = 0.0;
+  double turbulenceV = 0.0;
+  double checkpointAt = -1.0;
+  const char *checkpointPath = nullptr;
+  const char *restorePath = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--fast") == 0) {
+      fast = true;
+    } else if (std::strcmp(argv[i], "--checkpoint") == 0 && i + 2 < argc) {
+      checkpointAt = std::atof(argv[++i]);
+      checkpointPath = argv[++i];
+    } else if (std::strcmp(argv[i], "--restore") == 0 && i + 1 < argc) {
+      restorePath = argv[++i];
+    } else if (std::strcmp(argv[i], "--lockstep") == 0 && i + 1 < argc) {
+      lockstepPath = argv[++i];
+      fast = true;
+    } else if (std::strcmp(argv[i], "--shm") == 0 && i + 1 < argc) {
+      shmName = argv[++i];
+    } else if (std::strcmp(argv[i], "--aero") == 0) {
+      aero = true;
+    } else if (std::strcmp(argv[i], "--wind") == 0 && i + 1 < argc) {
+      double x, y, z;
+      if (std::sscanf(argv[++i], "%lf,%lf,%lf", &x, &y, &z) != 3) {
+        std::cerr << "--wind wants x,y,z in m/s" << std::endl;
+        return 1;
+      }
+      meanWind = Eigen::Vector3d(x, y, z);
+    } else if (std::strcmp(argv[i], "--turbulence") == 0 && i + 2 < argc) {
+      turbulenceH = std::atof(argv[++i]);
+      turbulenceV = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--spi") == 0 && i + 1 < argc) {
+      spiPath = argv[++i];
+    }
+  }
 
-int main() {
   std::vector<Waypoint> path;
 
   std::vector<Eigen::Vector3d> rc_instructions;
 
-  ImuSimulator *sim = new ImuSimulator(5, 5);
-
   rc_instructions = rc_read("test.txt");
   for (Eigen::Vector3d a : rc_instructions) {
     std::cout << "vector: \n" << a << std::endl;
@@ -36,122 +74,173 @@ int main() {
     path.push_back(temp);
     time += 0.5;
   }
-  int currentWaypointIndex = 0;
-  Drone *drone = new Drone(
-      new RigidBody(1.0, Eigen::Matrix3d::Identity(),
-                    Eigen::Vector3d(0, 0, 0)), // body
-      new RigidBody(0.5, Eigen::Matrix3d::Identity(),
-                    Eigen::Vector3d(1, 0, 0)), // motors
-      new RigidBody(0.5, Eigen::Matrix3d::Identity(),
-                    Eigen::Vector3d(-1, 0, 0)),
-      new RigidBody(0.5, Eigen::Matrix3d::Identity(), Eigen::Vector3d(0, 1, 0)),
-      new RigidBody(0.5, Eigen::Matrix3d::Identity(),
-                    Eigen::Vector3d(0, -1, 0)));
-
-  RigidBody *ground = new RigidBody();
-  ground->setBounds(
+
+  Drone drone(std::make_unique<RigidBody>(1.0, Eigen::Matrix3d::Identity(),
+                                          Eigen::Vector3d(0, 0, 0)), // body
+              std::make_unique<RigidBody>(0.5, Eigen::Matrix3d::Identity(),
+                                          Eigen::Vector3d(1, 0, 0)), // motors
+              std::make_unique<RigidBody>(0.5, Eigen::Matrix3d::Identity(),
+                                          Eigen::Vector3d(-1, 0, 0)),
+              std::make_unique<RigidBody>(0.5, Eigen::Matrix3d::Identity(),
+                                          Eigen::Vector3d(0, 1, 0)),
+              std::make_unique<RigidBody>(0.5, Eigen::Matrix3d::Identity(),
+                                          Eigen::Vector3d(0, -1, 0)));
+
+  // Collisions are disabled for now; the ground plane is kept for when they return.
+  RigidBody ground;
+  ground.setBounds(
       50, 50,
       5); // Plane perpendicular to the z-axis with dimensions 100x100x10
 
-  using clock = std::chrono::high_resolution_clock;
-  using duration = std::chrono::duration<double>;
-
   // Time is in seconds.
-  const double DELTATIME = 1.0 / 60.0;
+  const uint32_t SIM_RATE_HZ = 60;
   const double SIM_TIME = 30.0;
-  double elapsedTime = 0.0;
-  auto previousTime = std::chrono::high_resolution_clock::now();
 
   Eigen::Vector3d posGains(0.5, 0.5, 2.0);
-  positionController *positionControl = new positionController(posGains);
+  positionController positionControl(posGains);
   Eigen::Vector3d vKp(1.0, 1.0, 3.0);
   Eigen::Vector3d vKi(0.1, 0.1, 0.5);
   Eigen::Vector3d vKd(0.05, 0.05, 0.2);
-  velocityController *velocityControl =
-      new velocityController(vKp, vKi, vKd, 20);
-  positionControl->setTarget(path[0].position);
-
-  // Current condition set to break when the drone collides with the ground
-  //	while( !drone->isColliding(ground) ){ got rid of collisions for now
-  initializeLogging();
-  while (elapsedTime < SIM_TIME) {
-    auto currentTime = clock::now();
-    duration dt = currentTime - previousTime;
-
-    if (dt.count() >= DELTATIME) {
-      // TODO: logic and the actual physics
-      if (currentWaypointIndex < path.size() - 1) {
-        if (elapsedTime >= path[currentWaypointIndex + 1].time) {
-          currentWaypointIndex++;
-          positionControl->setTarget(path[currentWaypointIndex].position);
-          std::cout << "--- SWITCHING TO WAYPOINT" << currentWaypointIndex
-                    << " ---" << std::endl
-                    << std::endl;
-        }
+  velocityController velocityControl(vKp, vKi, vKd, 20);
+
+  ImuSimulator imu(5, 5);
+  SimBus bus;
+
+  // Calm air unless --wind / --turbulence ask for gusts.
+  EnvironmentConfig envConfig;
+  envConfig.turbulenceHorizontal = turbulenceH;
+  envConfig.turbulenceVertical = turbulenceV;
+  Environment environment(envConfig);
+  environment.reserve(1);
+  // No drag or ground effect unless asked for, so the baseline trajectory
+  // matches runs without the environment model.
+  AeroParams droneAero;
+  if (aero) {
+    droneAero.dragArea = 0.1;     // Cd * frontal area, m^2
+    droneAero.rotorRadius = 0.12; // m
+  }
+
+  // Components run in SimPhase order when due at the same instant:
+  // waypoint -> controller (-> motors) -> environment -> physics -> imu ->
+  // logger (-> spi_emit)
+  Simulation sim;
+  sim.setWind(meanWind);
+  sim.emplaceComponent<WaypointComponent>(path, positionControl);
+  sim.emplaceComponent<ControllerComponent>(drone, positionControl,
+                                            velocityControl, bus, SIM_RATE_HZ);
+  sim.emplaceComponent<EnvironmentComponent>(drone, environment, droneAero, bus,
+                                             SIM_RATE_HZ);
+  sim.emplaceComponent<PhysicsComponent>(drone, bus, SIM_RATE_HZ);
+  sim.emplaceComponent<ImuComponent>(drone, imu, bus, SIM_RATE_HZ);
+  sim.emplaceComponent<LoggerComponent>(drone, positionControl, bus,
+                                        "pid_tuning.csv", SIM_RATE_HZ);
+
+  std::unique_ptr<SpiInterface> spi;
+  if (spiPath) {
+    if (std::strcmp(spiPath, "stub") == 0) {
+      spi = std::make_unique<SpiStub>();
+    } else {
+#ifdef __linux__
+      spi = std::make_unique<SpiLinux>(spiPath);
+#else
+      std::cerr << "spidev SPI is Linux only" << std::endl;
+      return 1;
+#endif
+    }
+    if (!spi->init()) {
+      return 1;
+    }
+  }
+
+  std::unique_ptr<LockstepTransport> lockstep;
+  if (lockstepPath) {
+    if (std::strcmp(lockstepPath, "loopback") == 0) {
+      lockstep = std::make_unique<LoopbackTransport>();
+    } else if (std::strcmp(lockstepPath, "spi") == 0) {
+      if (!spi) {
+        std::cerr << "--lockstep spi needs --spi <dev|stub>" << std::endl;
+        return 1;
       }
-      drone->applyForce(Eigen::Vector3d(0, 0, -9.81 * drone->getMass()));
-      // Eigen::Vector3d force = control->compute(drone->getPosition(),
-      // DELTATIME);
-      Eigen::Vector3d targetVelocity =
-          positionControl->compute(drone->getPosition(), DELTATIME);
-      Eigen::Vector3d force = velocityControl->compute(
-          drone->getVelocity(), targetVelocity, DELTATIME);
-      force *= drone->getMass();
-      force.z() += drone->getMass() * 9.81;
-      drone->applyForce(force);
-      // sim->update(force, )
-      drone->update(DELTATIME);
-      Eigen::Vector3f imuForce = force.cast<float>();
-      Eigen::Vector3f imuTorque = drone->calculateNetTorque().cast<float>();
-      imu_data_t imuData = sim->update(imuForce, imuTorque, DELTATIME);
-
-
-      std::cout << "pos: (" << drone->getPosition().transpose() << ")";
-
-      std::cout << "\tvel: (" << drone->getVelocity().transpose() << ")";
-
-      std::cout << "\tori: [" << drone->orientation.coeffs().transpose() << "]";
-
-      std::cout
-          << "error: "
-          << (positionControl->getTarget() - drone->getPosition()).transpose();
-
-      std::cout << "\ttimestep: " << elapsedTime << std::endl;
-
-      Eigen::Vector3d posError =
-          positionControl->getTarget() - drone->getPosition();
-      logData(elapsedTime, positionControl->getTarget(), drone->getPosition(),
-              posError, force);
-      previousTime = currentTime;
-      elapsedTime += DELTATIME;
+      lockstep = std::make_unique<SpiLockstepTransport>(*spi);
+    } else {
+#ifdef __linux__
+      lockstep = std::make_unique<UnixSocketTransport>(lockstepPath);
+#else
+      std::cerr << "Unix socket lockstep is Linux only" << std::endl;
+      return 1;
+#endif
+    }
+    if (!lockstep->init()) {
+      return 1;
     }
+    sim.emplaceComponent<LockstepComponent>(*lockstep, bus, SIM_RATE_HZ);
+  }
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  std::unique_ptr<ShmBusWriter> shm;
+  if (shmName) {
+    shm = std::make_unique<ShmBusWriter>(shmName);
+    if (!shm->init()) {
+      return 1;
+    }
+    sim.emplaceComponent<ShmPublishComponent>(*shm, drone, bus, SIM_RATE_HZ);
   }
 
-  // Delete RigidBody pointers
-  delete drone;
-  delete ground;
-  delete positionControl;
-  delete velocityControl;
-  closeLogging();
+  if (spi) {
+    // The node's status from one step's transfer drives the next step's
+    // thrust: spi_emit runs last, motors right after the controller.
+    sim.emplaceComponent<SpiEmitComponent>(*spi, bus, SIM_RATE_HZ);
+    sim.emplaceComponent<MotorComponent>(drone, MotorParams{}, bus,
+                                         SIM_RATE_HZ);
+  }
 
-  return 0;
-}
+  if (restorePath) {
+    std::ifstream in(restorePath, std::ios::binary);
+    if (!in) {
+      std::cerr << "Cannot open checkpoint " << restorePath << std::endl;
+      return 1;
+    }
+    // read() rather than istreambuf_iterator: the stream turns a read error
+    // (e.g. a directory) into badbit instead of letting it throw.
+    std::vector<uint8_t> blob;
+    char chunk[4096];
+    while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0) {
+      blob.insert(blob.end(), chunk, chunk + in.gcount());
+    }
+    if (in.bad()) {
+      std::cerr << "Failed to read checkpoint " << restorePath << std::endl;
+      return 1;
+    }
+    if (!sim.restore(blob)) {
+      std::cerr << "Checkpoint " << restorePath
+                << " does not match this scenario" << std::endl;
+      return 1;
+    }
+  }
 
-void initializeLogging() {
-  logFile.open("pid_tuning.csv");
-  logFile << "Time, X, Y, Z, errorZ, \n";
-}
+  auto run = [&](double until) {
+    if (fast) {
+      sim.runUntil(until);
+    } else {
+      sim.runRealtime(until);
+    }
+  };
+
+  if (checkpointPath && checkpointAt > sim.getTime()) {
+    run(checkpointAt);
+    std::vector<uint8_t> blob;
+    sim.checkpoint(blob);
+    std::ofstream out(checkpointPath, std::ios::binary);
+    out.write((const char *)blob.data(), (std::streamsize)blob.size());
+    out.close();
+    if (!out) {
+      std::cerr << "Failed to write checkpoint " << checkpointPath << std::endl;
+      return 1;
+    }
+  }
+  run(SIM_TIME);
 
-void logData(double t, const Eigen::Vector3d &desiredPos,
-             const Eigen::Vector3d &currentPos, const Eigen::Vector3d &error,
-             const Eigen::Vector3d &controlOutput) {
-  logFile << t << "," << currentPos.x() << "," << currentPos.y() << ","
-          << currentPos.z() << "," << error.z() << "," << controlOutput.z()
-          << "\n";
+  return 0;
 }
-void closeLogging() { logFile.close(); }
 
 // Old Collision detection test code
 
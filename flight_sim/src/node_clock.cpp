@@ -0,0 +1,114 @@
+#include <flight_sim.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+constexpr double DAMPING = 0.70710678;  // critically damped-ish, no ringing
+constexpr double MAX_LOOP_STEP = 0.5;   // wn * T cap, keeps long gaps stable
+constexpr double GEAR_RATIO = 4.0;      // tau grows at 1/4 of the time locked
+constexpr double GATE_SPREADS = 6.0;    // gate at this many mean |error|s
+constexpr double SPREAD_GAIN = 1.0 / 64;
+
+} // namespace
+
+uint64_t piNowUs() {
+  using namespace std::chrono;
+  return (uint64_t)duration_cast<microseconds>(
+             steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void NodeClock::onStatus(const NodeStatus &status, uint64_t piUs) {
+  if (haveLast && status.seq < lastSeq) {
+    // The node rebooted and its clock with it.
+    reset();
+    relocks++;
+  } else if (haveLast && status.seq == lastSeq + 1) {
+    // rxDoneUs is the end of the transfer we timed as lastPiUs. Any other
+    // step means a transfer failed on one side and the pair is not one.
+    observe(status.rxDoneUs, lastPiUs);
+  }
+  haveLast = true;
+  lastSeq = status.seq;
+  lastPiUs = piUs;
+}
+
+void NodeClock::reset() {
+  haveModel = false;
+  haveLast = false;
+  skew = 0;
+  rejectRun = 0;
+}
+
+double NodeClock::gateNowUs() const {
+  return std::clamp(GATE_SPREADS * spread, config.gateUs, config.acquireGateUs);
+}
+
+double NodeClock::tauS() const {
+  double lockedS = (double)(piRef - lockPi) * 1e-6;
+  return std::clamp(lockedS / GEAR_RATIO, config.tauMinS, config.tauMaxS);
+}
+
+void NodeClock::lock(uint64_t nodeUs, uint64_t piUs) {
+  // Skew survives a relock; the crystals did not change.
+  haveModel = true;
+  piRef = piUs;
+  nodeRef = (double)nodeUs;
+  lockPi = piUs;
+  spread = config.acquireGateUs / GATE_SPREADS;
+  rejectRun = 0;
+}
+
+void NodeClock::observe(uint64_t nodeUs, uint64_t piUs) {
+  if (!haveModel) {
+    lock(nodeUs, piUs);
+    return;
+  }
+
+  double dt = (double)(int64_t)(piUs - piRef);
+  double predicted = nodeRef + (1.0 + skew) * dt;
+  double err = (double)nodeUs - predicted;
+  lastError = err;
+
+  double gate = gateNowUs();
+  if (dt <= 0 || std::abs(err) > gate) {
+    rejects++;
+    if (++rejectRun > config.maxRejects) {
+      rejectRun = 0;
+      if (gate >= config.acquireGateUs) {
+        // Not a burst of late stamps: the clocks really moved apart.
+        relocks++;
+        lock(nodeUs, piUs);
+      } else {
+        spread = config.acquireGateUs / GATE_SPREADS;
+      }
+    }
+    return;
+  }
+  rejectRun = 0;
+  observations++;
+  spread += (std::abs(err) - spread) * SPREAD_GAIN;
+
+  // Second-order loop, natural frequency 1 / tau: the phase term moves the
+  // model onto the observation, the frequency term integrates into skew.
+  double wnT = std::min(dt * 1e-6 / tauS(), MAX_LOOP_STEP);
+  piRef = piUs;
+  nodeRef = predicted + 2.0 * DAMPING * wnT * err;
+  skew += wnT * wnT * err / dt;
+}
+
+uint64_t NodeClock::toNode(uint64_t piUs) const {
+  double dt = (double)(int64_t)(piUs - piRef);
+  return (uint64_t)std::llround(nodeRef + (1.0 + skew) * dt + config.latencyUs);
+}
+
+uint64_t NodeClock::toPi(uint64_t nodeUs) const {
+  double dn = (double)nodeUs - nodeRef - config.latencyUs;
+  return piRef + (uint64_t)std::llround(dn / (1.0 + skew));
+}
+
+uint64_t NodeClock::unwrap(uint32_t nodeUs, uint64_t ref) {
+  return ref + (uint64_t)(int64_t)(int32_t)(nodeUs - (uint32_t)ref);
+}
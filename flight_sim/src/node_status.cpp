@@ -0,0 +1,71 @@
+#include <flight_sim.hpp>
+
+namespace {
+
+constexpr size_t FRAME_HDR_SIZE = 2;  // LE payload length
+constexpr size_t STATUS_HDR_SIZE = 80;
+constexpr size_t SAMPLE_SIZE = 16;
+constexpr uint8_t FLAG_LATEST = 1u << 0;
+
+uint32_t getLe(const uint8_t *p, size_t size) {
+  uint32_t v = 0;
+  for (size_t i = 0; i < size; i++) {
+    v |= uint32_t(p[i]) << (8 * i);
+  }
+  return v;
+}
+
+uint64_t getLe64(const uint8_t *p) {
+  return getLe(p, 4) | (uint64_t(getLe(p + 4, 4)) << 32);
+}
+
+const uint8_t *getSample(const uint8_t *p, MotorSample &s) {
+  s.tsUs = getLe(p, 4);
+  for (size_t ch = 0; ch < s.duty.size(); ch++) {
+    s.duty[ch] = uint16_t(getLe(p + 4 + 2 * ch, 2));
+  }
+  s.periodUs = uint16_t(getLe(p + 12, 2));
+  s.fresh = p[14];
+  return p + SAMPLE_SIZE;
+}
+
+} // namespace
+
+bool decodeNodeStatus(const uint8_t *frame, size_t len, NodeStatus &out) {
+  if (len < FRAME_HDR_SIZE + STATUS_HDR_SIZE) {
+    return false;
+  }
+  size_t payload = getLe(frame, FRAME_HDR_SIZE);
+  const uint8_t *p = frame + FRAME_HDR_SIZE;
+
+  if (payload < STATUS_HDR_SIZE || payload > len - FRAME_HDR_SIZE ||
+      p[0] != NODE_STATUS_MAGIC || p[1] != NODE_STATUS_VERSION) {
+    return false;
+  }
+  size_t n = p[2];
+  if (payload != STATUS_HDR_SIZE + n * SAMPLE_SIZE) {
+    return false;
+  }
+
+  out.hasLatest = (p[3] & FLAG_LATEST) != 0;
+  out.seq = getLe(p + 4, 4);
+  out.rxDoneUs = getLe64(p + 8);
+  out.fillUs = getLe64(p + 16);
+  out.lost = getLe(p + 24, 4);
+  p += 28;
+
+  NodeCounters &c = out.counters;
+  for (uint32_t *field : {&c.spiRx, &c.decodeFail, &c.spiErr, &c.inject,
+                          &c.schedEvict, &c.superseded, &c.rcDrop, &c.imuRead,
+                          &c.lidarRead}) {
+    *field = getLe(p, 4);
+    p += 4;
+  }
+  p = getSample(p, out.latest);
+
+  out.samples.resize(n);
+  for (MotorSample &s : out.samples) {
+    p = getSample(p, s);
+  }
+  return true;
+}
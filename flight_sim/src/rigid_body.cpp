@@ -33,6 +33,38 @@ Eigen::Vector3d RigidBody::getPosition() const { return position; }
 
 Eigen::Vector3d RigidBody::getVelocity() const { return velocity; }
 
+void RigidBody::saveState(StateWriter &out) const {
+  out.put(mass);
+  out.put(position);
+  out.put(velocity);
+  out.put(acceleration);
+  out.put(total_force);
+  out.put(orientation);
+  out.put(inertiaBody);
+  out.put(inertiaBodyInv);
+  out.put(total_torque_body);
+  out.put(angularVelocity);
+  out.put(x_bound);
+  out.put(y_bound);
+  out.put(z_bound);
+}
+
+void RigidBody::restoreState(StateReader &in) {
+  in.get(mass);
+  in.get(position);
+  in.get(velocity);
+  in.get(acceleration);
+  in.get(total_force);
+  in.get(orientation);
+  in.get(inertiaBody);
+  in.get(inertiaBodyInv);
+  in.get(total_torque_body);
+  in.get(angularVelocity);
+  in.get(x_bound);
+  in.get(y_bound);
+  in.get(z_bound);
+}
+
 void RigidBody::clearAccumulators() {
   total_force.setZero();
   total_torque_body.setZero();
@@ -1,4 +1,5 @@
 #include <flight_sim.hpp>
+#include "sensor_data.pb.h"
 
 uint8_t* serialize(const imu_data_t& data, uint8_t *buffer) {
     
@@ -50,4 +51,51 @@ uint8_t* serialize(const imu_data_t& data, uint8_t *buffer) {
     buffer[35] = data.gyro.z.msb & 0xFF;
 
     return buffer;
-}
\ No newline at end of file
+}
+namespace {
+
+constexpr size_t FRAME_HDR_SIZE = 2; // LE payload length
+constexpr uint16_t SYNC_MARKER = 0xFFFF;
+constexpr uint32_t SYNC_MAGIC = 0xC0FFEEEE;
+
+// BNO055 register pair back to the signed 16-bit value the node splits again.
+int32_t regValue(const i2c_imu_data_16_t& r) {
+    return int16_t(uint16_t(uint8_t(r.lsb)) | uint16_t(uint8_t(r.msb)) << 8);
+}
+
+} // namespace
+
+size_t serializeSensorFrame(const imu_data_t& imu, uint32_t timestampUs, uint8_t* frame) {
+    SensorPacket packet;
+    packet.set_timestamp_us(timestampUs);
+
+    ImuPayload* p = packet.mutable_imu();
+    p->set_gyro_x(regValue(imu.gyro.x));
+    p->set_gyro_y(regValue(imu.gyro.y));
+    p->set_gyro_z(regValue(imu.gyro.z));
+    p->set_euler_x(regValue(imu.euler_angles.x));
+    p->set_euler_y(regValue(imu.euler_angles.y));
+    p->set_euler_z(regValue(imu.euler_angles.z));
+    p->set_lin_acc_x(regValue(imu.linear_acceleration.x));
+    p->set_lin_acc_y(regValue(imu.linear_acceleration.y));
+    p->set_lin_acc_z(regValue(imu.linear_acceleration.z));
+
+    size_t len = packet.ByteSizeLong();
+    std::memset(frame, 0, NODE_FRAME_SIZE);
+    if (len > NODE_FRAME_SIZE - FRAME_HDR_SIZE ||
+        !packet.SerializeToArray(frame + FRAME_HDR_SIZE, int(len))) {
+        return 0;
+    }
+    frame[0] = uint8_t(len);
+    frame[1] = uint8_t(len >> 8);
+    return len;
+}
+
+void serializeSyncFrame(uint8_t* frame) {
+    std::memset(frame, 0, NODE_FRAME_SIZE);
+    frame[0] = uint8_t(SYNC_MARKER);
+    frame[1] = uint8_t(SYNC_MARKER >> 8);
+    for (size_t i = 0; i < 4; i++) {
+        frame[2 + i] = uint8_t(SYNC_MAGIC >> (8 * i));
+    }
+}
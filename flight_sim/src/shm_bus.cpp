@@ -0,0 +1,125 @@
+// Only the bus header, not flight_sim.hpp: out-of-tree readers such as the
+// viewer under graphics/ build this file on its own.
+#include <shm_bus.hpp>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Writer
+
+ShmBusWriter::ShmBusWriter(std::string name) : name(std::move(name)) {}
+
+ShmBusWriter::~ShmBusWriter() {
+  if (bus) {
+    munmap(bus, sizeof(ShmBus::Layout));
+    shm_unlink(name.c_str());
+  }
+}
+
+bool ShmBusWriter::init() {
+  int fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0) {
+    std::cerr << "Failed to create shared memory bus: " << name << "\n";
+    return false;
+  }
+  if (ftruncate(fd, sizeof(ShmBus::Layout)) < 0) {
+    std::cerr << "Failed to size shared memory bus.\n";
+    close(fd);
+    return false;
+  }
+  void *mem = mmap(nullptr, sizeof(ShmBus::Layout), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    std::cerr << "Failed to map shared memory bus.\n";
+    return false;
+  }
+
+  // Fresh mapping is zero-filled; only the header needs filling in.
+  bus = static_cast<ShmBus::Layout *>(mem);
+  bus->header.slotCount = ShmBus::SLOT_COUNT;
+  bus->header.frameSize = sizeof(ShmSimFrame);
+  bus->header.version = SHM_BUS_VERSION;
+  bus->header.published.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  bus->header.magic = SHM_BUS_MAGIC;
+  return true;
+}
+
+void ShmBusWriter::publish(const ShmSimFrame &frame) {
+  uint64_t n = bus->header.published.load(std::memory_order_relaxed);
+  ShmBus::Slot &slot = bus->slots[n % ShmBus::SLOT_COUNT];
+
+  slot.seq.store(2 * n + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.frame = frame;
+  slot.seq.store(2 * n + 2, std::memory_order_release);
+  bus->header.published.store(n + 1, std::memory_order_release);
+}
+
+uint64_t ShmBusWriter::getPublished() const {
+  return bus ? bus->header.published.load(std::memory_order_relaxed) : 0;
+}
+
+// Reader
+
+ShmBusReader::ShmBusReader(std::string name) : name(std::move(name)) {}
+
+ShmBusReader::~ShmBusReader() {
+  if (bus) {
+    munmap(const_cast<ShmBus::Layout *>(bus), sizeof(ShmBus::Layout));
+  }
+}
+
+bool ShmBusReader::init(bool fromOldest) {
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return false;
+  }
+  void *mem =
+      mmap(nullptr, sizeof(ShmBus::Layout), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    return false;
+  }
+  bus = static_cast<const ShmBus::Layout *>(mem);
+  if (bus->header.magic != SHM_BUS_MAGIC ||
+      bus->header.version != SHM_BUS_VERSION ||
+      bus->header.slotCount != ShmBus::SLOT_COUNT ||
+      bus->header.frameSize != sizeof(ShmSimFrame)) {
+    std::cerr << "Shared memory bus " << name << " has a different layout\n";
+    munmap(mem, sizeof(ShmBus::Layout));
+    bus = nullptr;
+    return false;
+  }
+
+  uint64_t published = bus->header.published.load(std::memory_order_acquire);
+  if (!fromOldest) {
+    cursor = published;
+  } else if (published >= ShmBus::SLOT_COUNT) {
+    cursor = published - ShmBus::SLOT_COUNT + 1;
+  }
+  return true;
+}
+
+ShmBusReader::Result ShmBusReader::check(uint64_t &published) {
+  published = bus->header.published.load(std::memory_order_acquire);
+  if (cursor >= published) {
+    return Result::Empty;
+  }
+  // The slot for frame `published` may already be mid-write, so the oldest
+  // safe frame is one newer than a full lap.
+  if (published - cursor >= ShmBus::SLOT_COUNT) {
+    uint64_t oldest = published - ShmBus::SLOT_COUNT + 1;
+    dropped += oldest - cursor;
+    cursor = oldest;
+    return Result::Overrun;
+  }
+  return Result::Ok;
+}
+
+ShmBusReader::Result ShmBusReader::read(ShmSimFrame &out) {
+  return visit([&](const ShmSimFrame &frame) { out = frame; });
+}
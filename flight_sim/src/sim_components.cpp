@@ -0,0 +1,277 @@
+#include <flight_sim.hpp>
+#include <algorithm>
+
+// Waypoints
+
+WaypointComponent::WaypointComponent(std::vector<Waypoint> path,
+                                     positionController &control)
+    : SimComponent(SimPhase::Waypoint, 0), path(std::move(path)),
+      control(control) {}
+
+SimTimeNs WaypointComponent::nextDue() const {
+  if (cursor >= path.size()) {
+    return SIM_NEVER;
+  }
+  return secondsToNs(path[cursor].time);
+}
+
+void WaypointComponent::step(Simulation &sim, double dt) {
+  control.setTarget(path[cursor].position);
+  if (cursor > 0) {
+    std::cout << "--- SWITCHING TO WAYPOINT" << cursor << " ---" << std::endl
+              << std::endl;
+  }
+  cursor++;
+}
+
+void WaypointComponent::saveState(StateWriter &out) const {
+  out.put((uint64_t)cursor);
+  out.put(control.desiredPos);
+}
+
+void WaypointComponent::restoreState(StateReader &in) {
+  uint64_t saved = 0;
+  in.get(saved);
+  in.get(control.desiredPos);
+  if (saved > path.size()) {
+    in.fail();
+    return;
+  }
+  cursor = (size_t)saved;
+}
+
+// Controller
+
+ControllerComponent::ControllerComponent(Drone &drone,
+                                         positionController &position,
+                                         velocityController &velocity,
+                                         SimBus &bus, uint32_t rateHz)
+    : SimComponent(SimPhase::Controller, rateHz), drone(drone),
+      position(position), velocity(velocity), bus(bus) {}
+
+void ControllerComponent::step(Simulation &sim, double dt) {
+  Eigen::Vector3d targetVelocity = position.compute(drone.getPosition(), dt);
+  Eigen::Vector3d force =
+      velocity.compute(drone.getVelocity(), targetVelocity, dt);
+  force *= drone.getMass();
+  // Feed-forward gravity compensation
+  force -= drone.getMass() * sim.getGravity();
+  bus.commandForce = force;
+}
+
+void ControllerComponent::saveState(StateWriter &out) const {
+  velocity.saveState(out);
+  out.put(bus.commandForce);
+}
+
+void ControllerComponent::restoreState(StateReader &in) {
+  velocity.restoreState(in);
+  in.get(bus.commandForce);
+}
+
+// Motors
+
+MotorComponent::MotorComponent(Drone &drone, const MotorParams &params,
+                               SimBus &bus, uint32_t rateHz)
+    : SimComponent(SimPhase::Controller, rateHz), drone(drone), params(params),
+      bus(bus) {}
+
+double MotorComponent::thrust(const MotorSample &s, size_t ch,
+                              const MotorParams &params) {
+  double pulseUs = s.dutyFraction(ch) * s.periodUs;
+  double throttle = (pulseUs - params.minPulseUs) /
+                    (params.maxPulseUs - params.minPulseUs);
+  return std::clamp(throttle, 0.0, 1.0) * params.maxThrustN;
+}
+
+void MotorComponent::step(Simulation &sim, double dt) {
+  if (!bus.nodeValid) {
+    return;
+  }
+  // Newest sample: the last one queued in this status, else the repeat.
+  const MotorSample *s = nullptr;
+  if (!bus.node.samples.empty()) {
+    s = &bus.node.samples.back();
+  } else if (bus.node.hasLatest) {
+    s = &bus.node.latest;
+  }
+  if (!s) {
+    return;
+  }
+
+  double total = 0.0;
+  for (size_t ch = 0; ch < s->duty.size(); ch++) {
+    total += thrust(*s, ch, params);
+  }
+  bus.commandForce = drone.orientation * Eigen::Vector3d(0, 0, total);
+}
+
+// Environment
+
+EnvironmentComponent::EnvironmentComponent(Drone &drone, Environment &env,
+                                           const AeroParams &params,
+                                           SimBus &bus, uint32_t rateHz)
+    : SimComponent(SimPhase::Environment, rateHz), env(env), bus(bus),
+      droneIndex(env.addBody(drone, params)) {}
+
+void EnvironmentComponent::step(Simulation &sim, double dt) {
+  env.setThrust(droneIndex, bus.commandForce);
+  env.step(dt, sim.getWind());
+  bus.wind = env.getWind(droneIndex);
+}
+
+void EnvironmentComponent::saveState(StateWriter &out) const {
+  env.saveState(out);
+}
+
+void EnvironmentComponent::restoreState(StateReader &in) {
+  env.restoreState(in);
+  if (in.ok()) {
+    bus.wind = env.getWind(droneIndex);
+  }
+}
+
+// Physics
+
+PhysicsComponent::PhysicsComponent(Drone &drone, SimBus &bus, uint32_t rateHz)
+    : SimComponent(SimPhase::Physics, rateHz), drone(drone), bus(bus) {}
+
+void PhysicsComponent::step(Simulation &sim, double dt) {
+  drone.applyForce(sim.getGravity() * drone.getMass());
+  drone.applyForce(bus.commandForce);
+  drone.update(dt);
+}
+
+void PhysicsComponent::saveState(StateWriter &out) const {
+  drone.saveState(out);
+}
+
+void PhysicsComponent::restoreState(StateReader &in) {
+  drone.restoreState(in);
+}
+
+// IMU
+
+ImuComponent::ImuComponent(Drone &drone, ImuSimulator &imu, SimBus &bus,
+                           uint32_t rateHz)
+    : SimComponent(SimPhase::Sensor, rateHz), drone(drone), imu(imu),
+      bus(bus) {}
+
+void ImuComponent::step(Simulation &sim, double dt) {
+  Eigen::Vector3f imuForce = bus.commandForce.cast<float>();
+  Eigen::Vector3f imuTorque = drone.calculateNetTorque().cast<float>();
+  bus.imu = imu.update(imuForce, imuTorque, (float)dt);
+  bus.imuTime = sim.getTime();
+}
+
+void ImuComponent::saveState(StateWriter &out) const {
+  imu.saveState(out);
+  out.put(bus.imu);
+  out.put(bus.imuTime);
+}
+
+void ImuComponent::restoreState(StateReader &in) {
+  imu.restoreState(in);
+  in.get(bus.imu);
+  in.get(bus.imuTime);
+}
+
+// Logging
+
+LoggerComponent::LoggerComponent(Drone &drone, positionController &position,
+                                 SimBus &bus, const std::string &csvPath,
+                                 uint32_t rateHz)
+    : SimComponent(SimPhase::Output, rateHz), drone(drone), position(position),
+      bus(bus), logFile(csvPath) {
+  logFile << "Time, X, Y, Z, errorZ, \n";
+}
+
+void LoggerComponent::step(Simulation &sim, double dt) {
+  Eigen::Vector3d pos = drone.getPosition();
+  Eigen::Vector3d posError = position.getTarget() - pos;
+
+  std::cout << "pos: (" << pos.transpose() << ")";
+  std::cout << "\tvel: (" << drone.getVelocity().transpose() << ")";
+  std::cout << "\tori: [" << drone.orientation.coeffs().transpose() << "]";
+  std::cout << "error: " << posError.transpose();
+  std::cout << "\ttimestep: " << sim.getTime() << std::endl;
+
+  logFile << sim.getTime() << "," << pos.x() << "," << pos.y() << ","
+          << pos.z() << "," << posError.z() << "," << bus.commandForce.z()
+          << "\n";
+}
+
+// SPI
+
+SpiEmitComponent::SpiEmitComponent(SpiInterface &spi, SimBus &bus,
+                                   uint32_t rateHz, uint32_t leadUs)
+    : SimComponent(SimPhase::Output, rateHz), spi(spi), bus(bus),
+      leadUs(leadUs) {}
+
+void SpiEmitComponent::step(Simulation &sim, double dt) {
+  bool stamped = false;
+  if (bus.nodeClock.locked()) {
+    uint32_t ts = bus.nodeClock.packetTimestamp(piNowUs() + leadUs);
+    stamped = serializeSensorFrame(bus.imu, ts, frame.data()) != 0;
+    if (stamped) {
+      lastTimestamp = ts;
+    }
+  }
+  if (!stamped) {
+    serializeSyncFrame(frame.data());
+  }
+
+  bool sent = spi.transfer(frame.data(), rx.data(), frame.size());
+  uint64_t endUs = piNowUs(); // as close to the end of the transfer as we get
+  if (sent && stamped) {
+    packetsSent++;
+  }
+  if (sent && decodeNodeStatus(rx.data(), rx.size(), bus.node)) {
+    bus.nodeValid = true;
+    bus.nodeClock.onStatus(bus.node, endUs);
+  }
+}
+
+// Lockstep
+
+LockstepComponent::LockstepComponent(LockstepTransport &link, SimBus &bus,
+                                     uint32_t rateHz)
+    : SimComponent(SimPhase::Output, rateHz), link(link), bus(bus) {}
+
+void LockstepComponent::step(Simulation &sim, double dt) {
+  // seq follows ticks so a restored checkpoint resumes the same numbering.
+  LockstepHeader header{LOCKSTEP_FRAME_MAGIC, (uint32_t)ticks, sim.getTimeNs(),
+                        (uint32_t)PAYLOAD_SIZE};
+  std::memcpy(frame.data(), &header, sizeof(header));
+  serialize(bus.imu, frame.data() + sizeof(header));
+
+  if (!link.send(frame.data(), frame.size()) || !link.waitAck(header.seq)) {
+    std::cerr << "Lockstep link lost at t=" << sim.getTime() << ", stopping"
+              << std::endl;
+    sim.stop();
+  }
+}
+
+// Shared memory
+
+ShmPublishComponent::ShmPublishComponent(ShmBusWriter &shm, Drone &drone,
+                                         SimBus &bus, uint32_t rateHz)
+    : SimComponent(SimPhase::Output, rateHz), shm(shm), drone(drone),
+      bus(bus) {}
+
+void ShmPublishComponent::step(Simulation &sim, double dt) {
+  ShmSimFrame frame{};
+  frame.step = ticks;
+  frame.simTimeNs = sim.getTimeNs();
+
+  Eigen::Map<Eigen::Vector3d>(frame.position) = drone.getPosition();
+  Eigen::Map<Eigen::Vector3d>(frame.velocity) = drone.getVelocity();
+  Eigen::Map<Eigen::Vector4d>(frame.orientation) = drone.orientation.coeffs();
+  Eigen::Map<Eigen::Vector3d>(frame.angularVelocity) = drone.angularVelocity;
+  Eigen::Map<Eigen::Vector3d>(frame.commandForce) = bus.commandForce;
+  Eigen::Map<Eigen::Vector3d>(frame.wind) = bus.wind;
+  frame.imuTime = bus.imuTime;
+  serialize(bus.imu, frame.imu);
+
+  shm.publish(frame);
+}
@@ -0,0 +1,169 @@
+#include <flight_sim.hpp>
+#include <chrono>
+#include <thread>
+
+void Simulation::schedule(uint32_t index) {
+  SimTimeNs due = components[index]->nextDue();
+  if (due == SIM_NEVER) {
+    return;
+  }
+  // Never schedule into the past; a late component fires immediately.
+  if (due < t) {
+    due = t;
+  }
+  events.push({due, (uint8_t)components[index]->getPhase(), index});
+}
+
+bool Simulation::stepEvent() {
+  if (events.empty()) {
+    return false;
+  }
+
+  SimEvent ev = events.top();
+  events.pop();
+
+  t = ev.time;
+
+  SimComponent &c = *components[ev.component];
+  double dt = c.rateHz ? 1.0 / (double)c.rateHz : 0.0;
+  c.step(*this, dt);
+  c.ticks++;
+
+  schedule(ev.component);
+  return true;
+}
+
+void Simulation::runUntil(double tEnd) {
+  const SimTimeNs end = secondsToNs(tEnd);
+  stopped = false;
+  while (!stopped && peekNextTime() < end) {
+    stepEvent();
+  }
+}
+
+void Simulation::runRealtime(double tEnd) {
+  using clock = std::chrono::steady_clock;
+
+  const SimTimeNs end = secondsToNs(tEnd);
+  const auto wallStart = clock::now() - std::chrono::nanoseconds(t);
+  stopped = false;
+  while (!stopped && peekNextTime() < end) {
+    std::this_thread::sleep_until(wallStart +
+                                  std::chrono::nanoseconds(peekNextTime()));
+    stepEvent();
+  }
+}
+
+// Checkpoints
+//
+// Blob layout (host byte order):
+//   u32 magic, u32 version, i64 t, wind, gravity, u32 component count
+//   per component: u32 name hash, u32 payload bytes, u64 ticks, payload
+
+namespace {
+
+constexpr uint32_t CHECKPOINT_MAGIC = 0x4B435346; // "FSCK"
+constexpr uint32_t CHECKPOINT_VERSION = 1;
+
+uint32_t nameHash(const char *name) {
+  uint32_t h = 2166136261u; // FNV-1a
+  for (; *name; ++name) {
+    h = (h ^ (uint8_t)*name) * 16777619u;
+  }
+  return h;
+}
+
+} // namespace
+
+void Simulation::checkpoint(std::vector<uint8_t> &blob) const {
+  blob.clear();
+  StateWriter out(blob);
+  out.put(CHECKPOINT_MAGIC);
+  out.put(CHECKPOINT_VERSION);
+  out.put(t);
+  out.put(wind);
+  out.put(gravity);
+  out.put((uint32_t)components.size());
+
+  for (const auto &c : components) {
+    out.put(nameHash(c->name()));
+    size_t lenAt = out.reserveU32();
+    out.put(c->ticks);
+    size_t start = out.size();
+    c->saveState(out);
+    out.patchU32(lenAt, (uint32_t)(out.size() - start));
+  }
+}
+
+bool Simulation::restore(const uint8_t *data, size_t size) {
+  // A payload can only be checked by restoring it, so keep our own
+  // checkpoint and roll back to it if any component rejects its part.
+  std::vector<uint8_t> backup;
+  checkpoint(backup);
+  bool wasStopped = stopped;
+  if (apply(data, size)) {
+    return true;
+  }
+  apply(backup.data(), backup.size());
+  stopped = wasStopped;
+  return false;
+}
+
+bool Simulation::apply(const uint8_t *data, size_t size) {
+  uint32_t magic = 0, version = 0, count = 0;
+  SimTimeNs time = 0;
+  Eigen::Vector3d w, g;
+
+  StateReader in(data, size);
+  in.get(magic);
+  in.get(version);
+  in.get(time);
+  in.get(w);
+  in.get(g);
+  in.get(count);
+  if (!in.ok() || magic != CHECKPOINT_MAGIC ||
+      version != CHECKPOINT_VERSION || count != components.size()) {
+    return false;
+  }
+
+  // First pass: check the layout without touching any state.
+  StateReader scan = in;
+  for (const auto &c : components) {
+    uint32_t hash = 0, len = 0;
+    uint64_t ticks = 0;
+    scan.get(hash);
+    scan.get(len);
+    scan.get(ticks);
+    if (!scan.ok() || hash != nameHash(c->name()) || !scan.skip(len)) {
+      return false;
+    }
+  }
+  if (scan.remaining() != 0) {
+    return false;
+  }
+
+  // Second pass: apply.
+  t = time;
+  wind = w;
+  gravity = g;
+  stopped = false;
+  for (const auto &c : components) {
+    uint32_t hash = 0, len = 0;
+    in.get(hash);
+    in.get(len);
+    in.get(c->ticks);
+    StateReader payload(in.position(), len);
+    c->restoreState(payload);
+    in.skip(len);
+    if (!payload.ok() || payload.remaining() != 0) {
+      return false;
+    }
+  }
+
+  // Rebuild the queue from the restored tick counts.
+  events = std::priority_queue<SimEvent>();
+  for (uint32_t i = 0; i < components.size(); i++) {
+    schedule(i);
+  }
+  return true;
+}
@@ -1,7 +1,7 @@
 #include <flight_sim.hpp>
 
 // NEW proto (generated from node_imu.proto)
-#include "../../shared/proto/node_imu.pb.h"
+#include "node_imu.pb.h"
 
 #define SPI_MODE 	(SPI_MODE_0)
 #define SPI_BITS 	(8)
@@ -13,7 +13,7 @@ void serialize_to_proto(char **msg, size_t *length) {
     uint32_t lidar_cm     = 123;
     uint32_t command      = 0;
 
-    auto packet = std::make_unique<DeviceUpdatePacket>();
+    auto packet = std::make_unique<legacy::DeviceUpdatePacket>();
 
     packet->set_timestamp(timestamp_ms);
     packet->set_lidar(lidar_cm);
@@ -22,7 +22,7 @@ void serialize_to_proto(char **msg, size_t *length) {
     // If you don't need IMU yet, leave it default (still a valid message).
     // If you DO want IMU, uncomment and fill fields once you confirm ImuData16 layout.
     /*
-    ImuPayload* imu = packet->mutable_imu();
+    legacy::ImuPayload* imu = packet->mutable_imu();
 
     // Example of touching nested messages without setting ImuData16 fields:
     imu->mutable_quaternion();
@@ -1,29 +1,33 @@
 #include <flight_sim.hpp>
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 
 //this is a stub implementation of the SPI interface for testing without actual hardware
-//switch to spi_linux.cpp after obtaining properly configured hardware (rpi)
+//use SpiLinux (spi_linux.cpp) after obtaining properly configured hardware (rpi)
 
-class SpiStub : public SpiInterface {
-public:
-    bool init() override {
-        std::cout << "[SPI Stub] Initialized.\n";
-        return true;
-    }
+bool SpiStub::init() {
+  std::cout << "[SPI Stub] Initialized.\n";
+  return true;
+}
 
-    bool transmit(const uint8_t* data, size_t len) override {
-        std::ofstream f("spi_payload.log", std::ios::app | std::ios::binary);
-        f.write(reinterpret_cast<const char*>(data), len);
-        f.close();
+bool SpiStub::transmit(const uint8_t *data, size_t len) {
+  std::ofstream f("spi_payload.log", std::ios::app | std::ios::binary);
+  f.write(reinterpret_cast<const char *>(data), len);
+  f.close();
 
-        std::cout << "[SPI Stub] Wrote " << len << " bytes to spi_payload.log\n";
-        // Print hex for inspection
-        for (size_t i = 0; i < len; i++) {
-            std::cout << std::hex << std::setw(2) << std::setfill('0')
-                      << static_cast<int>(data[i]) << " ";
-        }
-        std::cout << std::dec << "\n";
-        return true;
-    }
-};
+  std::cout << "[SPI Stub] Wrote " << len << " bytes to spi_payload.log\n";
+  // Print hex for inspection
+  for (size_t i = 0; i < len; i++) {
+    std::cout << std::hex << std::setw(2) << std::setfill('0')
+              << static_cast<int>(data[i]) << " ";
+  }
+  std::cout << std::dec << "\n";
+  return true;
+}
+
+// No node behind the stub: MISO reads back as idle-low zeros.
+bool SpiStub::transfer(const uint8_t *tx, uint8_t *rx, size_t len) {
+  std::fill(rx, rx + len, 0);
+  return transmit(tx, len);
+}
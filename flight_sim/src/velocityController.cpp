@@ -1,4 +1,5 @@
 #include "velocityController.hpp"
+#include "sim_state.hpp"
 
 velocityController::velocityController()
     : kp(Eigen::Vector3d::Zero()), ki(Eigen::Vector3d::Zero()),
@@ -36,3 +37,13 @@ velocityController::compute(const Eigen::Vector3d &currentVelocity,
 
   return finalOutput;
 }
+
+void velocityController::saveState(StateWriter &out) const {
+  out.put(velocityIntegral);
+  out.put(previousError);
+}
+
+void velocityController::restoreState(StateReader &in) {
+  in.get(velocityIntegral);
+  in.get(previousError);
+}
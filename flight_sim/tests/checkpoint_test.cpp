@@ -0,0 +1,176 @@
+// Checkpoint/restore of the whole Simulation: a run forked from a checkpoint
+// must end in exactly the state of the run it was taken from, and a blob
+// that does not fit the scenario must be refused without touching anything.
+// The scenario is main()'s, minus the console/CSV logger, with turbulence on
+// so the gust generator's state has to survive the round trip too.
+//
+//   ctest --test-dir <build> -R checkpoint
+
+#include <flight_sim.hpp>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);   \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+namespace {
+
+constexpr uint32_t RATE_HZ = 60;
+constexpr double FORK_AT = 7.3;
+constexpr double END_AT = 15.0;
+
+std::unique_ptr<RigidBody> body(double mass, const Eigen::Vector3d &at) {
+  return std::make_unique<RigidBody>(mass, Eigen::Matrix3d::Identity(), at);
+}
+
+// Everything the components hold references to lives here, so each
+// Scenario is an independent copy of the same run.
+struct Scenario {
+  Drone drone{body(1.0, Eigen::Vector3d(0, 0, 0)),
+              body(0.5, Eigen::Vector3d(1, 0, 0)),
+              body(0.5, Eigen::Vector3d(-1, 0, 0)),
+              body(0.5, Eigen::Vector3d(0, 1, 0)),
+              body(0.5, Eigen::Vector3d(0, -1, 0))};
+  positionController position{Eigen::Vector3d(0.5, 0.5, 2.0)};
+  velocityController velocity{Eigen::Vector3d(1.0, 1.0, 3.0),
+                              Eigen::Vector3d(0.1, 0.1, 0.5),
+                              Eigen::Vector3d(0.05, 0.05, 0.2), 20};
+  ImuSimulator imu{5, 5};
+  SimBus bus;
+  Environment environment{config()};
+  Simulation sim;
+
+  Scenario() {
+    std::vector<Waypoint> path;
+    for (int i = 0; i < 20; i++) {
+      path.push_back({i * 0.5, Eigen::Vector3d(0.1 * i, -0.05 * i, 1.0)});
+    }
+    AeroParams aero;
+    aero.dragArea = 0.1;
+    aero.rotorRadius = 0.12;
+
+    environment.reserve(1);
+    sim.setWind(Eigen::Vector3d(2.0, -1.0, 0.0));
+    sim.emplaceComponent<WaypointComponent>(path, position);
+    sim.emplaceComponent<ControllerComponent>(drone, position, velocity, bus,
+                                              RATE_HZ);
+    sim.emplaceComponent<EnvironmentComponent>(drone, environment, aero, bus,
+                                               RATE_HZ);
+    sim.emplaceComponent<PhysicsComponent>(drone, bus, RATE_HZ);
+    sim.emplaceComponent<ImuComponent>(drone, imu, bus, RATE_HZ);
+  }
+
+  static EnvironmentConfig config() {
+    EnvironmentConfig c;
+    c.turbulenceHorizontal = 1.5;
+    c.turbulenceVertical = 0.5;
+    return c;
+  }
+
+  std::vector<uint8_t> state() const {
+    std::vector<uint8_t> blob;
+    sim.checkpoint(blob);
+    return blob;
+  }
+};
+
+} // namespace
+
+// Run A straight through; run B up to the fork, checkpoint, and carry on in
+// a fresh Scenario restored from it.
+static void forkedRun() {
+  Scenario straight;
+  straight.sim.runUntil(END_AT);
+
+  std::vector<uint8_t> fork;
+  {
+    Scenario first;
+    first.sim.runUntil(FORK_AT);
+    fork = first.state();
+  }
+  Scenario resumed;
+  CHECK(resumed.sim.restore(fork));
+  CHECK(resumed.state() == fork);
+  resumed.sim.runUntil(END_AT);
+
+  CHECK(resumed.state() == straight.state());
+  CHECK(resumed.drone.getPosition() == straight.drone.getPosition());
+  CHECK(resumed.drone.getVelocity() == straight.drone.getVelocity());
+}
+
+// Blobs that must be refused; each leaves the target exactly as it was.
+static void corruptBlobs() {
+  Scenario source;
+  source.sim.runUntil(FORK_AT);
+  const std::vector<uint8_t> good = source.state();
+
+  Scenario target;
+  target.sim.runUntil(2.0);
+  const std::vector<uint8_t> before = target.state();
+
+  auto refused = [&](std::vector<uint8_t> blob) {
+    bool ok = target.sim.restore(blob);
+    return !ok && target.state() == before;
+  };
+
+  // Truncated, trailing junk, bad magic.
+  CHECK(refused(std::vector<uint8_t>(good.begin(), good.end() - 1)));
+  std::vector<uint8_t> longer = good;
+  longer.push_back(0);
+  CHECK(refused(longer));
+  std::vector<uint8_t> magic = good;
+  magic[0] ^= 0xFF;
+  CHECK(refused(magic));
+  CHECK(refused({}));
+
+  // Last component's payload one byte short: the layout scan passes, so
+  // the earlier components are already applied when its restoreState()
+  // runs out of bytes, and must be rolled back.
+  std::vector<uint8_t> shortPayload = good;
+  shortPayload.pop_back();
+  size_t at = 4 + 4 + 8 + 2 * 3 * 8 + 4; // magic, version, t, wind, gravity, count
+  size_t lenAt = 0;
+  for (int i = 0; i < 5; i++) {           // hash, len, ticks, payload
+    uint32_t len;
+    lenAt = at + 4;
+    std::memcpy(&len, &good[lenAt], 4);
+    at = lenAt + 4 + 8 + len;
+  }
+  CHECK(at == good.size());
+  uint32_t len;
+  std::memcpy(&len, &shortPayload[lenAt], 4);
+  len--;
+  std::memcpy(&shortPayload[lenAt], &len, 4);
+  CHECK(refused(shortPayload));
+
+  // A checkpoint of a different scenario is refused as well.
+  Scenario other;
+  std::vector<uint8_t> otherBlob;
+  {
+    Simulation small;
+    small.emplaceComponent<PhysicsComponent>(other.drone, other.bus, RATE_HZ);
+    small.runUntil(1.0);
+    small.checkpoint(otherBlob);
+  }
+  CHECK(refused(otherBlob));
+
+  // After all that the target still takes a good blob.
+  CHECK(target.sim.restore(good));
+  CHECK(target.state() == good);
+}
+
+int main() {
+  forkedRun();
+  corruptBlobs();
+
+  std::printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
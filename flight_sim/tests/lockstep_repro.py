@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Runs the sim twice in --fast --lockstep against hil_replay as the consumer
+and requires both runs to end in the same state, byte for byte: the sim's
+final checkpoint and every frame the consumer was sent.
+
+    lockstep_repro.py FLIGHT_SIM HIL_REPLAY WORK_DIR
+
+flight_sim reads its flight path from ../../tests/flightpaths relative to
+its working directory, so each run happens two levels below WORK_DIR with
+WORK_DIR/tests linked to the repo's tests/.
+"""
+
+import pathlib
+import shutil
+import subprocess
+import sys
+
+REPO = pathlib.Path(__file__).resolve().parents[2]
+SIM_TIME = 30.0
+STEPS = 1800          # SIM_TIME at 60 Hz
+FRAME_RECORD = 260    # hil_replay capture record: u32 rx_us + 256-byte frame
+
+
+def run(sim, replay, work, n):
+    sock = work / f"lockstep{n}.sock"
+    frames = work / f"frames{n}.bin"
+    final = work / f"final{n}.bin"
+
+    consumer = subprocess.Popen(
+        [replay, "--lockstep", str(sock), "--write", str(frames)],
+        stdout=subprocess.DEVNULL)
+    subprocess.run(
+        [sim, "--fast", "--lockstep", str(sock), "--checkpoint", str(SIM_TIME), str(final)],
+        cwd=work / "run" / "sim", stdout=subprocess.DEVNULL, check=True, timeout=300)
+    if consumer.wait(timeout=60) != 0:
+        sys.exit(f"run {n}: hil_replay failed")
+    return final.read_bytes(), frames.read_bytes()
+
+
+def main():
+    sim, replay, work = sys.argv[1], sys.argv[2], pathlib.Path(sys.argv[3])
+    shutil.rmtree(work, ignore_errors=True)
+    (work / "run" / "sim").mkdir(parents=True)
+    (work / "tests").symlink_to(REPO / "tests", target_is_directory=True)
+
+    final1, frames1 = run(sim, replay, work, 1)
+    final2, frames2 = run(sim, replay, work, 2)
+
+    steps = len(frames1) // FRAME_RECORD
+    if steps != STEPS:
+        sys.exit(f"consumer got {steps} steps, want {STEPS}")
+    if frames1 != frames2:
+        sys.exit("the two runs sent the consumer different frames")
+    if final1 != final2:
+        sys.exit("the two runs ended in different states")
+    print(f"PASS ({steps} lockstep steps, both runs identical)")
+
+
+if __name__ == "__main__":
+    main()
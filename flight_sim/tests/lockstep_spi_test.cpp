@@ -0,0 +1,110 @@
+// SpiLockstepTransport against a node that answers every transfer with its
+// real MISO status (hil_miso_encode() via node_fixtures.c), seq = transfers
+// it has completed. A frame counts as acked only once a later status shows
+// the node got past the transfer that carried it, however long that takes,
+// and the frame itself must reach the node as a sync frame it never injects.
+//
+//   ctest --test-dir <build> -R lockstep_spi
+
+#include <flight_sim.hpp>
+#include <cstdio>
+#include "node_fixtures.h"
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);   \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+namespace {
+
+// The node side of the bus. A busy node still clocks out the status it
+// filled earlier, but does not count the transfer until busy runs out.
+class FakeNode : public SpiInterface {
+public:
+  bool init() override { return true; }
+  bool transmit(const uint8_t *data, size_t len) override { return false; }
+
+  bool transfer(const uint8_t *tx, uint8_t *rx, size_t len) override {
+    if (len != NODE_FRAME_SIZE || fixture_miso_frame(completed, 0, rx) == 0) {
+      return false;
+    }
+    std::memcpy(last, tx, len);
+    transfers++;
+    if (busy > 0) {
+      busy--;
+    } else {
+      completed = transfers;
+    }
+    return true;
+  }
+
+  uint32_t completed = 0;
+  uint32_t transfers = 0;
+  int busy = 0;
+  uint8_t last[NODE_FRAME_SIZE];
+};
+
+} // namespace
+
+static void stepsInLockstep() {
+  FakeNode node;
+  SpiLockstepTransport link(node, 10);
+  CHECK(link.init());
+
+  uint8_t frame[64];
+  for (uint32_t seq = 0; seq < 50; seq++) {
+    // Every few steps the node lags a few transfers behind.
+    node.busy = (seq % 7 == 3) ? 3 : 0;
+    std::memset(frame, int(seq), sizeof(frame));
+    CHECK(link.send(frame, sizeof(frame)));
+
+    // The node sees a sync frame, with the lockstep frame behind the marker.
+    fixture_gate gate;
+    fixture_gate_reset();
+    CHECK(fixture_gate_frame(node.last, 0, &gate) == FIXTURE_FRAME_SYNC);
+    CHECK(!gate.armed);
+    CHECK(std::memcmp(node.last + NODE_SYNC_HDR_SIZE, frame, sizeof(frame)) ==
+          0);
+
+    // Acked only once the node completed the transfer that carried it.
+    uint32_t carried = node.transfers;
+    CHECK(link.waitAck(seq));
+    CHECK(node.completed >= carried);
+  }
+  CHECK(link.getPolls() > 0);
+}
+
+static void stalledNode() {
+  FakeNode node;
+  SpiLockstepTransport link(node, 10);
+  CHECK(link.init());
+
+  uint8_t frame[36] = {};
+  node.busy = 1000;
+  CHECK(link.send(frame, sizeof(frame)));
+  CHECK(!link.waitAck(0));
+
+  // Too long for one transfer.
+  uint8_t big[NODE_FRAME_SIZE] = {};
+  CHECK(!link.send(big, sizeof(big)));
+}
+
+static void silentNode() {
+  SpiStub stub; // MISO reads back as zeros: no status
+  SpiLockstepTransport link(stub);
+  CHECK(!link.init());
+}
+
+int main() {
+  stepsInLockstep();
+  stalledNode();
+  silentNode();
+
+  std::printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+#include "node_fixtures.h"
+
+#include "hil_core/miso.h"
+#include "hil_core/sched.h"
+
+#include <string.h>
+
+_Static_assert(FIXTURE_FRAME_OK == HIL_FRAME_OK && FIXTURE_FRAME_SYNC == HIL_FRAME_SYNC,
+               "fixture frame status values");
+
+// Sample j of seed: a wrapping timestamp, a distinct duty per channel.
+static struct hil_motor_sample fixture_sample(uint32_t seed, uint32_t j)
+{
+    struct hil_motor_sample s = {
+        .ts_us = 0xFFFFFF00U + j * 0x40U,
+        .period_us = (uint16_t)(2500U + j),
+        .fresh = (uint8_t)((seed + j) & HIL_MOTOR_ALL),
+    };
+    for (uint32_t ch = 0; ch < HIL_MOTORS; ch++) {
+        s.duty[ch] = (uint16_t)(seed * 4096U + j * 16U + ch);
+    }
+    return s;
+}
+
+// seq = seed, rx_done_us = seed << 32 | 0xFFFFFFF0, fill_us = rx_done_us + 123,
+// lost = seed + 1, counter i = seed * 100 + i, latest = sample 99 (only
+// odd seeds mark it valid; the others send zeros), queued sample j =
+// sample j.
+size_t fixture_miso_frame(uint32_t seed, size_t n, uint8_t *frame)
+{
+    struct hil_miso_status st = {
+        .seq = seed,
+        .rx_done_us = ((uint64_t)seed << 32) | 0xFFFFFFF0U,
+        .lost = seed + 1U,
+        .has_latest = (seed & 1U) != 0,
+        .latest = fixture_sample(seed, 99),
+    };
+    st.fill_us = st.rx_done_us + 123U;
+
+    uint32_t i = 0;
+#define FIXTURE_COUNTER(name) st.counters.name = seed * 100U + i++;
+    HIL_MISO_COUNTERS(FIXTURE_COUNTER)
+#undef FIXTURE_COUNTER
+
+    struct hil_motor_sample s[HIL_MISO_MAX_SAMPLES + 1];
+    for (size_t j = 0; j < n && j < HIL_MISO_MAX_SAMPLES + 1; j++) {
+        s[j] = fixture_sample(seed, (uint32_t)j);
+    }
+    return hil_miso_encode(&st, s, n, frame);
+}
+
+size_t fixture_miso_max_samples(void)
+{
+    return HIL_MISO_MAX_SAMPLES;
+}
+
+/* ── Injection gate ───────────────────────────────────────────────────────── */
+
+static struct hil_pool gate_pool;
+static struct hil_sched gate;
+static uint32_t gate_now;
+static struct fixture_gate *gate_out;
+
+static uint32_t gate_now_us(void *ctx)
+{
+    (void)ctx;
+    return gate_now;
+}
+
+static bool gate_alarm_at(void *ctx, uint32_t target_us)
+{
+    (void)ctx;
+    gate_out->armed = true;
+    gate_out->alarm_us = target_us;
+    return true;
+}
+
+static void gate_deliver(void *ctx, uint16_t pkt)
+{
+    (void)ctx;
+    const device_update_packet_t *p = hil_pool_pkt(&gate_pool, pkt);
+    const i2c_imu_data_16_t *g = &p->imu[0].gyro.x;
+
+    gate_out->injected = true;
+    gate_out->timestamp_us = p->timestamp_us;
+    gate_out->gyro_x = (int16_t)((uint16_t)(uint8_t)g->lsb | (uint16_t)((uint8_t)g->msb << 8));
+    hil_pool_put(&gate_pool, pkt);
+}
+
+static const struct hil_sched_port gate_port = {
+    .now_us = gate_now_us,
+    .alarm_at = gate_alarm_at,
+    .deliver = gate_deliver,
+};
+
+void fixture_gate_reset(void)
+{
+    hil_sched_init(&gate, &gate_port, &gate_pool);
+}
+
+int fixture_gate_frame(const uint8_t *frame, uint32_t now_us, struct fixture_gate *out)
+{
+    memset(out, 0, sizeof(*out));
+    gate_now = now_us;
+    gate_out = out;
+    return (int)hil_sched_on_frame(&gate, frame, NULL, NULL);
+}
+
+void fixture_gate_fire(uint32_t now_us, struct fixture_gate *out)
+{
+    memset(out, 0, sizeof(*out));
+    gate_now = now_us;
+    gate_out = out;
+    hil_sched_on_timer(&gate);
+}
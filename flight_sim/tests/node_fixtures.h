@@ -0,0 +1,51 @@
+// Frames built by the test_node's own C code (test_node/lib/hil_core), for
+// checking the Pi side against it. hil_core's headers are C only, so the
+// fixtures are built in node_fixtures.c and only plain types cross over.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fills a 256-byte MISO frame with hil_miso_encode() and n queued samples.
+// Every field is a function of seed, as described in node_fixtures.c, so the
+// decoding side can predict it. Returns the payload length (0 if n is too
+// large for one frame).
+size_t fixture_miso_frame(uint32_t seed, size_t n, uint8_t *frame);
+
+// HIL_MISO_MAX_SAMPLES.
+size_t fixture_miso_max_samples(void);
+
+// hil_sched_on_frame() results the tests look at.
+#define FIXTURE_FRAME_OK    0
+#define FIXTURE_FRAME_SYNC  1
+
+// What the node's injection path did with a packet.
+struct fixture_gate {
+    bool armed;            // the scheduler armed its alarm
+    uint32_t alarm_us;     // ... for this absolute node time
+    bool injected;         // a packet was delivered to the emulators
+    uint32_t timestamp_us; // ... with this timestamp
+    int16_t gyro_x;        // ... and this IMU 0 gyro x
+};
+
+// The node's scheduler core (hil_sched) with a clock the test sets. Clears
+// it, with nothing queued and the alarm idle.
+void fixture_gate_reset(void);
+
+// Hands one 256-byte SPI frame to hil_sched_on_frame() at node time now_us.
+// Returns its hil_frame_status; out->armed / alarm_us report the alarm.
+int fixture_gate_frame(const uint8_t *frame, uint32_t now_us, struct fixture_gate *out);
+
+// Fires the injection alarm at node time now_us (hil_sched_on_timer).
+// out->injected and the fields after it report what was delivered.
+void fixture_gate_fire(uint32_t now_us, struct fixture_gate *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+// Round trip of the MISO status frame: encoded by the test_node's
+// hil_miso_encode(), decoded by our decodeNodeStatus(). Catches the two
+// sides drifting apart on layout, field order or version.
+//
+//   ctest --test-dir <build> -R node_status
+
+#include <node_status.hpp>
+#include <cstdio>
+#include "node_fixtures.h"
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);   \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+// Mirrors fixture_sample() in node_fixtures.c.
+static void checkSample(const MotorSample &s, uint32_t seed, uint32_t j) {
+  CHECK(s.tsUs == 0xFFFFFF00u + j * 0x40u);
+  CHECK(s.periodUs == 2500 + j);
+  CHECK(s.fresh == ((seed + j) & 0xF));
+  for (uint32_t ch = 0; ch < 4; ch++) {
+    CHECK(s.duty[ch] == uint16_t(seed * 4096 + j * 16 + ch));
+  }
+}
+
+static void roundTrip(uint32_t seed, size_t n) {
+  uint8_t frame[NODE_FRAME_SIZE];
+  CHECK(fixture_miso_frame(seed, n, frame) != 0);
+
+  NodeStatus st;
+  CHECK(decodeNodeStatus(frame, sizeof(frame), st));
+  CHECK(st.seq == seed);
+  CHECK(st.rxDoneUs == ((uint64_t(seed) << 32) | 0xFFFFFFF0u));
+  CHECK(st.fillUs == st.rxDoneUs + 123);
+  CHECK(st.lost == seed + 1);
+
+  const NodeCounters &c = st.counters;
+  uint32_t i = 0;
+  for (uint32_t v : {c.spiRx, c.decodeFail, c.spiErr, c.inject, c.schedEvict,
+                     c.superseded, c.rcDrop, c.imuRead, c.lidarRead}) {
+    CHECK(v == seed * 100 + i++);
+  }
+
+  CHECK(st.hasLatest == ((seed & 1) != 0));
+  if (st.hasLatest) {
+    checkSample(st.latest, seed, 99);
+  } else {
+    CHECK(st.latest.tsUs == 0 && st.latest.fresh == 0); // sent as zeros
+  }
+  CHECK(st.samples.size() == n);
+  for (size_t j = 0; j < st.samples.size(); j++) {
+    checkSample(st.samples[j], seed, uint32_t(j));
+  }
+}
+
+static void rejects() {
+  uint8_t frame[NODE_FRAME_SIZE] = {};
+  NodeStatus st;
+
+  // Idle bus (node not running) reads as zeros.
+  CHECK(!decodeNodeStatus(frame, sizeof(frame), st));
+
+  // Too many samples for one frame: the node refuses to encode it.
+  CHECK(fixture_miso_frame(1, fixture_miso_max_samples() + 1, frame) == 0);
+
+  fixture_miso_frame(2, 3, frame);
+  CHECK(decodeNodeStatus(frame, sizeof(frame), st));
+  CHECK(!decodeNodeStatus(frame, 40, st));    // truncated transfer
+
+  frame[3] = NODE_STATUS_VERSION + 1;         // version byte, after the prefix
+  CHECK(!decodeNodeStatus(frame, sizeof(frame), st));
+  frame[3] = NODE_STATUS_VERSION;
+
+  frame[4] = 4;                               // n disagrees with the length
+  CHECK(!decodeNodeStatus(frame, sizeof(frame), st));
+}
+
+int main() {
+  for (uint32_t seed = 1; seed <= 3; seed++) {
+    roundTrip(seed, 0);
+    roundTrip(seed, 1);
+    roundTrip(seed, fixture_miso_max_samples());
+  }
+  rejects();
+
+  std::printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
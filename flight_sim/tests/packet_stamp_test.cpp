@@ -0,0 +1,113 @@
+// SensorPacket timestamps against the node's injection gate: a NodeClock is
+// locked onto a simulated node clock (fast, skewed, wrapping its 32-bit
+// counter), each packet is stamped the way SpiEmitComponent stamps it, and
+// the frame goes through the node's own scheduler core (hil_sched). The
+// alarm must be armed for exactly the stamped time, which must be the node
+// time `lead` after the send, and nothing may be injected before it.
+//
+//   ctest --test-dir <build> -R packet_stamp
+
+#include <flight_sim.hpp>
+#include <cmath>
+#include <cstdio>
+#include "node_fixtures.h"
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);   \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+namespace {
+
+constexpr uint64_t PI_START_US = 1'000'000'000;
+constexpr double NODE_SKEW = 40e-6;     // node crystal 40 ppm fast
+constexpr uint64_t PERIOD_US = 1000;    // one transfer per ms
+constexpr uint32_t LEAD_US = 2000;
+
+// The node clock, 64-bit; chosen so its low 32 bits wrap at PI_WRAP_US.
+constexpr uint64_t PI_WRAP_US = PI_START_US + 60'000'000;
+constexpr uint64_t NODE_WRAP = 5ull << 32;
+
+uint64_t nodeAt(uint64_t piUs) {
+  double dt = (double)(int64_t)(piUs - PI_WRAP_US);
+  return NODE_WRAP + (int64_t)std::llround(dt * (1.0 + NODE_SKEW));
+}
+
+imu_data_t imuWithGyroX(int16_t v) {
+  imu_data_t imu{};
+  imu.gyro.x.lsb = int8_t(uint8_t(v));
+  imu.gyro.x.msb = int8_t(uint8_t(uint16_t(v) >> 8));
+  imu.linear_acceleration.z.msb = 3;
+  return imu;
+}
+
+} // namespace
+
+// Until the clock locks SpiEmitComponent sends sync frames; the node must
+// take them as such and never queue them.
+static void syncFrame() {
+  uint8_t frame[NODE_FRAME_SIZE];
+  fixture_gate gate;
+
+  serializeSyncFrame(frame);
+  fixture_gate_reset();
+  CHECK(fixture_gate_frame(frame, 12345, &gate) == FIXTURE_FRAME_SYNC);
+  CHECK(!gate.armed);
+}
+
+static void stampedFrames() {
+  // Lock onto the node: status k arrives at the end of transfer k and
+  // reports when the node finished transfer k - 1.
+  NodeClock clock;
+  uint64_t pi = PI_START_US;
+  uint32_t seq = 0;
+  for (; pi < PI_WRAP_US - 5000; pi += PERIOD_US, seq++) {
+    NodeStatus st;
+    st.seq = seq;
+    st.rxDoneUs = nodeAt(pi - PERIOD_US);
+    clock.onStatus(st, pi);
+  }
+  CHECK(clock.locked() && clock.settled());
+
+  // Sends around the counter wrap, including ones whose lead crosses it.
+  fixture_gate_reset();
+  for (uint64_t send = pi; send < PI_WRAP_US + 5000; send += 700) {
+    uint32_t ts = clock.packetTimestamp(send + LEAD_US);
+    int16_t gyro = int16_t(-1234 - int(send - pi));
+    uint8_t frame[NODE_FRAME_SIZE];
+    CHECK(serializeSensorFrame(imuWithGyroX(gyro), ts, frame) != 0);
+
+    // The stamp is the node time lead after the send, to the µs.
+    int32_t stampErr = int32_t(ts - uint32_t(nodeAt(send + LEAD_US)));
+    CHECK(std::abs(stampErr) <= 1);
+
+    // The node arms its alarm for exactly that time ...
+    fixture_gate gate;
+    uint32_t now = uint32_t(nodeAt(send));
+    CHECK(fixture_gate_frame(frame, now, &gate) == FIXTURE_FRAME_OK);
+    CHECK(gate.armed && gate.alarm_us == ts);
+
+    // ... holds the packet until then ...
+    fixture_gate_fire(ts - 1, &gate);
+    CHECK(!gate.injected);
+    CHECK(gate.armed && gate.alarm_us == ts);
+
+    // ... and injects it, intact, when it is due.
+    fixture_gate_fire(ts, &gate);
+    CHECK(gate.injected && gate.timestamp_us == ts);
+    CHECK(gate.gyro_x == gyro);
+  }
+}
+
+int main() {
+  syncFrame();
+  stampedFrames();
+
+  std::printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
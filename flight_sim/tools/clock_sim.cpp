@@ -0,0 +1,224 @@
+// Host simulation of the Pi / test_node clock servo: two drifting crystals,
+// jittery timestamps on both sides and a node counter that wraps, run
+// through NodeClock exactly as SpiEmitComponent feeds it. For every frame
+// the Pi asks for an injection `lead` µs ahead and the simulated node fires
+// its alarm on the 32-bit packet timestamp; the report is how far from the
+// intended instant (true time) that lands.
+//
+//   ./clock_sim                       4 h at 500 frames/s
+//   ./clock_sim --hours 12 --rate 100 --max-err-us 5
+//
+// Exits non-zero if any injection after --settle-s is off by more than
+// --max-err-us.
+
+#include <flight_sim.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Options {
+  double hours = 4.0;
+  double rateHz = 500.0;
+  double leadUs = 2000.0;         // Pi schedules each injection this far ahead
+  double settleS = 60.0;          // acquisition, not counted
+  double maxErrUs = 5.0;
+  uint32_t seed = 1;
+
+  // Crystals: fixed error, a slow thermal swing on the node, random walk.
+  double piPpm = 20.0;
+  double nodePpm = -35.0;
+  double nodeSwingPpm = 2.0;
+  double nodeSwingPeriodS = 2400.0;
+  double wanderPpmPerRootS = 0.001;
+
+  // Timestamp latency after the true end of a transfer, in µs.
+  double piLatFixed = 5.0, piLatJitter = 3.0;      // ioctl return
+  double nodeLatFixed = 2.0, nodeLatJitter = 0.5;  // thread wake after DMA
+  double spikeProb = 0.01, spikeMaxUs = 3000.0;    // Pi preempted
+  double nodeFailProb = 0.001;                     // node transfer error
+  double piDecodeFailProb = 0.001;                 // status not decoded
+};
+
+// A free-running µs clock with a time-varying frequency error.
+struct SimClock {
+  double us;      // reading at the current true time
+  double ppm;     // current frequency error
+
+  double at(double aheadS) const { return us + aheadS * 1e6 * (1.0 + ppm * 1e-6); }
+  double trueDelay(double ticks) const { return ticks / (1e6 * (1.0 + ppm * 1e-6)); }
+};
+
+bool parse(int argc, char **argv, Options &o) {
+  for (int i = 1; i < argc; i++) {
+    auto num = [&](double &v) {
+      if (i + 1 >= argc) {
+        return false;
+      }
+      v = std::atof(argv[++i]);
+      return true;
+    };
+    bool ok = true;
+    if (std::strcmp(argv[i], "--hours") == 0) {
+      ok = num(o.hours);
+    } else if (std::strcmp(argv[i], "--rate") == 0) {
+      ok = num(o.rateHz);
+    } else if (std::strcmp(argv[i], "--lead-us") == 0) {
+      ok = num(o.leadUs);
+    } else if (std::strcmp(argv[i], "--settle-s") == 0) {
+      ok = num(o.settleS);
+    } else if (std::strcmp(argv[i], "--max-err-us") == 0) {
+      ok = num(o.maxErrUs);
+    } else if (std::strcmp(argv[i], "--pi-ppm") == 0) {
+      ok = num(o.piPpm);
+    } else if (std::strcmp(argv[i], "--node-ppm") == 0) {
+      ok = num(o.nodePpm);
+    } else if (std::strcmp(argv[i], "--spike-prob") == 0) {
+      ok = num(o.spikeProb);
+    } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      o.seed = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      std::fprintf(stderr, "unknown or incomplete option: %s\n", argv[i]);
+      return false;
+    }
+  }
+  return o.hours > 0 && o.rateHz > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  if (!parse(argc, argv, o)) {
+    return 2;
+  }
+
+  std::mt19937_64 rng(o.seed);
+  std::uniform_real_distribution<double> uni(0.0, 1.0);
+  std::normal_distribution<double> gauss(0.0, 1.0);
+  auto expo = [&](double mean) { return -mean * std::log(1.0 - uni(rng)); };
+  auto chance = [&](double p) { return uni(rng) < p; };
+
+  // Pi: steady_clock of a box up for 30 days. Node: up 61 min, so its
+  // 32-bit counter wraps 10.6 min into the run and every 71.6 min after.
+  SimClock pi{30.0 * 86400e6, o.piPpm};
+  SimClock node{61.0 * 60e6, o.nodePpm};
+
+  // The servo is told the mean fixed latency difference, as it would be
+  // after calibration on the bench; the jitter it has to filter itself.
+  NodeClockConfig config;
+  config.latencyUs = (o.piLatFixed + o.piLatJitter) - (o.nodeLatFixed + o.nodeLatJitter);
+  NodeClock clock(config);
+
+  const double frameS = 1.0 / o.rateHz;
+  const uint64_t frames = (uint64_t)(o.hours * 3600.0 * o.rateHz);
+  const double wanderStep = o.wanderPpmPerRootS * std::sqrt(frameS);
+  double wander = 0;
+
+  // Node side of the MISO status.
+  uint32_t nodeSeq = 0;
+  uint64_t nodeDoneUs = 0;
+  uint32_t nodeWraps = 0;
+
+  // Injection error statistics, after settling.
+  uint64_t counted = 0, late = 0;
+  double sum = 0, sumSq = 0, worst = 0, worstAtS = 0;
+  std::vector<double> hourWorst((size_t)std::ceil(o.hours), 0.0);
+
+  for (uint64_t k = 0; k < frames; k++) {
+    double tS = (double)k * frameS;
+
+    // Frequencies for this frame.
+    wander += wanderStep * gauss(rng);
+    node.ppm = o.nodePpm + wander +
+               o.nodeSwingPpm * std::sin(2.0 * std::numbers::pi * tS / o.nodeSwingPeriodS);
+
+    // The Pi stamps its packet before the transfer, from the current model.
+    uint64_t piNow = (uint64_t)pi.us;
+    bool inject = clock.locked();
+    uint64_t wantPi = piNow + (uint64_t)o.leadUs;
+    uint32_t ts = inject ? clock.packetTimestamp(wantPi) : 0;
+
+    // The transfer ends now (true time tS). Each side stamps it late.
+    bool nodeOk = !chance(o.nodeFailProb);
+    double nodeLat = o.nodeLatFixed + expo(o.nodeLatJitter);
+    double piLat = o.piLatFixed + expo(o.piLatJitter);
+    if (chance(o.spikeProb)) {
+      piLat += uni(rng) * o.spikeMaxUs;
+    }
+    uint64_t nodeStamp = (uint64_t)node.at(nodeLat * 1e-6);
+    uint64_t piStamp = (uint64_t)pi.at(piLat * 1e-6);
+
+    // The status went out in this transfer, filled before it.
+    NodeStatus status;
+    status.seq = nodeSeq;
+    status.rxDoneUs = nodeDoneUs;
+    if (nodeOk) {
+      if ((nodeStamp >> 32) != (nodeDoneUs >> 32) && k > 0) {
+        nodeWraps++;
+      }
+      nodeSeq++;
+      nodeDoneUs = nodeStamp;
+    }
+
+    // The node fires when its counter reaches ts, modulo 2^32 like
+    // hil_sched; the packet arrived at nodeStamp.
+    if (inject && nodeOk && tS >= o.settleS) {
+      int32_t ahead = (int32_t)(ts - (uint32_t)nodeStamp);
+      if (ahead < 0) {
+        late++;
+        ahead = 0;
+      }
+      double fireS = tS + node.trueDelay((double)nodeStamp - node.us + ahead);
+      double wantS = tS + pi.trueDelay((double)wantPi - pi.us);
+      double err = (fireS - wantS) * 1e6;
+      counted++;
+      sum += err;
+      sumSq += err * err;
+      if (std::abs(err) > std::abs(worst)) {
+        worst = err;
+        worstAtS = tS;
+      }
+      double &hw = hourWorst[(size_t)(tS / 3600.0)];
+      hw = std::max(hw, std::abs(err));
+    }
+
+    if (!chance(o.piDecodeFailProb)) {
+      clock.onStatus(status, piStamp);
+    }
+
+    // Advance both clocks to the next frame.
+    pi.us = pi.at(frameS);
+    node.us = node.at(frameS);
+  }
+
+  double mean = counted ? sum / (double)counted : 0;
+  double rms = counted ? std::sqrt(sumSq / (double)counted) : 0;
+  std::printf("clock_sim: %.1f h at %.0f frames/s, pi %+.1f ppm, node %+.1f ppm "
+              "(±%.1f swing), lead %.0f us\n",
+              o.hours, o.rateHz, o.piPpm, o.nodePpm, o.nodeSwingPpm, o.leadUs);
+  std::printf("  node counter wraps   %u\n", nodeWraps);
+  std::printf("  servo                skew %+.3f ppm, %llu obs, %llu rejected, %u relocks\n",
+              clock.skewPpm(), (unsigned long long)clock.getObservations(),
+              (unsigned long long)clock.getRejects(), clock.getRelocks());
+  std::printf("  injection error      mean %+.3f us, rms %.3f us, worst %+.3f us at %.0f s\n",
+              mean, rms, worst, worstAtS);
+  std::printf("  late (already due)   %llu of %llu\n", (unsigned long long)late,
+              (unsigned long long)counted);
+  for (size_t h = 0; h < hourWorst.size(); h++) {
+    std::printf("  hour %-3zu worst |err|  %.3f us\n", h, hourWorst[h]);
+  }
+
+  bool pass = counted > 0 && late == 0 && std::abs(worst) <= o.maxErrUs;
+  std::printf("%s (limit %.1f us)\n", pass ? "PASS" : "FAIL", o.maxErrUs);
+  return pass ? 0 : 1;
+}
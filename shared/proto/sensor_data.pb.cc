@@ -1,7 +1,7 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: shared/proto/sensor_data.proto
+// source: sensor_data.proto
 
-#include "shared/proto/sensor_data.pb.h"
+#include "sensor_data.pb.h"
 
 #include <algorithm>
 
@@ -20,55 +20,77 @@ PROTOBUF_PRAGMA_INIT_SEG
 namespace _pb = ::PROTOBUF_NAMESPACE_ID;
 namespace _pbi = _pb::internal;
 
-PROTOBUF_CONSTEXPR Vector3D::Vector3D(
+PROTOBUF_CONSTEXPR ImuPayload::ImuPayload(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.x_)*/0
-  , /*decltype(_impl_.y_)*/0
-  , /*decltype(_impl_.z_)*/0
+    /*decltype(_impl_.gyro_x_)*/0
+  , /*decltype(_impl_.gyro_y_)*/0
+  , /*decltype(_impl_.gyro_z_)*/0
+  , /*decltype(_impl_.euler_x_)*/0
+  , /*decltype(_impl_.euler_y_)*/0
+  , /*decltype(_impl_.euler_z_)*/0
+  , /*decltype(_impl_.lin_acc_x_)*/0
+  , /*decltype(_impl_.lin_acc_y_)*/0
+  , /*decltype(_impl_.lin_acc_z_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
-struct Vector3DDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Vector3DDefaultTypeInternal()
+struct ImuPayloadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ImuPayloadDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Vector3DDefaultTypeInternal() {}
+  ~ImuPayloadDefaultTypeInternal() {}
   union {
-    Vector3D _instance;
+    ImuPayload _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vector3DDefaultTypeInternal _Vector3D_default_instance_;
-PROTOBUF_CONSTEXPR ImuData::ImuData(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ImuPayloadDefaultTypeInternal _ImuPayload_default_instance_;
+PROTOBUF_CONSTEXPR RcPayload::RcPayload(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.acceleration_)*/nullptr
-  , /*decltype(_impl_.angular_velocity_)*/nullptr
+    /*decltype(_impl_.vertical_)*/0
+  , /*decltype(_impl_.horizontal_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
-struct ImuDataDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ImuDataDefaultTypeInternal()
+struct RcPayloadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RcPayloadDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ImuDataDefaultTypeInternal() {}
+  ~RcPayloadDefaultTypeInternal() {}
   union {
-    ImuData _instance;
+    RcPayload _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ImuDataDefaultTypeInternal _ImuData_default_instance_;
-PROTOBUF_CONSTEXPR AltimeterData::AltimeterData(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RcPayloadDefaultTypeInternal _RcPayload_default_instance_;
+PROTOBUF_CONSTEXPR ImuRecord::ImuRecord(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.pressure_)*/0
-  , /*decltype(_impl_.altitude_)*/0
-  , /*decltype(_impl_.temperature_)*/0
+    /*decltype(_impl_.imu_)*/nullptr
+  , /*decltype(_impl_.instance_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
-struct AltimeterDataDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR AltimeterDataDefaultTypeInternal()
+struct ImuRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ImuRecordDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~AltimeterDataDefaultTypeInternal() {}
+  ~ImuRecordDefaultTypeInternal() {}
   union {
-    AltimeterData _instance;
+    ImuRecord _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AltimeterDataDefaultTypeInternal _AltimeterData_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ImuRecordDefaultTypeInternal _ImuRecord_default_instance_;
+PROTOBUF_CONSTEXPR RangeRecord::RangeRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.instance_)*/0u
+  , /*decltype(_impl_.distance_mm_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeRecordDefaultTypeInternal() {}
+  union {
+    RangeRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeRecordDefaultTypeInternal _RangeRecord_default_instance_;
 PROTOBUF_CONSTEXPR SensorPacket::SensorPacket(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.imu_data_)*/nullptr
-  , /*decltype(_impl_.altimeter_data_)*/nullptr
-  , /*decltype(_impl_.timestamp_)*/0u
+    /*decltype(_impl_.imus_)*/{}
+  , /*decltype(_impl_.ranges_)*/{}
+  , /*decltype(_impl_.imu_)*/nullptr
+  , /*decltype(_impl_.rc_)*/nullptr
+  , /*decltype(_impl_.timestamp_us_)*/0u
+  , /*decltype(_impl_.lidar_mm_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SensorPacketDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SensorPacketDefaultTypeInternal()
@@ -79,130 +101,165 @@ struct SensorPacketDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SensorPacketDefaultTypeInternal _SensorPacket_default_instance_;
-static ::_pb::Metadata file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto[4];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_shared_2fproto_2fsensor_5fdata_2eproto = nullptr;
-static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_shared_2fproto_2fsensor_5fdata_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_sensor_5fdata_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_sensor_5fdata_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sensor_5fdata_2eproto = nullptr;
 
-const uint32_t TableStruct_shared_2fproto_2fsensor_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_sensor_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::Vector3D, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::Vector3D, _impl_.x_),
-  PROTOBUF_FIELD_OFFSET(::Vector3D, _impl_.y_),
-  PROTOBUF_FIELD_OFFSET(::Vector3D, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.gyro_x_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.gyro_y_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.gyro_z_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.euler_x_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.euler_y_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.euler_z_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.lin_acc_x_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.lin_acc_y_),
+  PROTOBUF_FIELD_OFFSET(::ImuPayload, _impl_.lin_acc_z_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::ImuData, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::RcPayload, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::ImuData, _impl_.acceleration_),
-  PROTOBUF_FIELD_OFFSET(::ImuData, _impl_.angular_velocity_),
+  PROTOBUF_FIELD_OFFSET(::RcPayload, _impl_.vertical_),
+  PROTOBUF_FIELD_OFFSET(::RcPayload, _impl_.horizontal_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::AltimeterData, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::ImuRecord, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::AltimeterData, _impl_.pressure_),
-  PROTOBUF_FIELD_OFFSET(::AltimeterData, _impl_.altitude_),
-  PROTOBUF_FIELD_OFFSET(::AltimeterData, _impl_.temperature_),
+  PROTOBUF_FIELD_OFFSET(::ImuRecord, _impl_.instance_),
+  PROTOBUF_FIELD_OFFSET(::ImuRecord, _impl_.imu_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RangeRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RangeRecord, _impl_.instance_),
+  PROTOBUF_FIELD_OFFSET(::RangeRecord, _impl_.distance_mm_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::SensorPacket, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.timestamp_),
-  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.imu_data_),
-  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.altimeter_data_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.timestamp_us_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.lidar_mm_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.imu_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.rc_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.imus_),
+  PROTOBUF_FIELD_OFFSET(::SensorPacket, _impl_.ranges_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::Vector3D)},
-  { 9, -1, -1, sizeof(::ImuData)},
-  { 17, -1, -1, sizeof(::AltimeterData)},
-  { 26, -1, -1, sizeof(::SensorPacket)},
+  { 0, -1, -1, sizeof(::ImuPayload)},
+  { 15, -1, -1, sizeof(::RcPayload)},
+  { 23, -1, -1, sizeof(::ImuRecord)},
+  { 31, -1, -1, sizeof(::RangeRecord)},
+  { 39, -1, -1, sizeof(::SensorPacket)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
-  &::_Vector3D_default_instance_._instance,
-  &::_ImuData_default_instance_._instance,
-  &::_AltimeterData_default_instance_._instance,
+  &::_ImuPayload_default_instance_._instance,
+  &::_RcPayload_default_instance_._instance,
+  &::_ImuRecord_default_instance_._instance,
+  &::_RangeRecord_default_instance_._instance,
   &::_SensorPacket_default_instance_._instance,
 };
 
-const char descriptor_table_protodef_shared_2fproto_2fsensor_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\036shared/proto/sensor_data.proto\"+\n\010Vect"
-  "or3D\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"O\n"
-  "\007ImuData\022\037\n\014acceleration\030\001 \001(\0132\t.Vector3"
-  "D\022#\n\020angular_velocity\030\002 \001(\0132\t.Vector3D\"H"
-  "\n\rAltimeterData\022\020\n\010pressure\030\001 \001(\002\022\020\n\010alt"
-  "itude\030\002 \001(\002\022\023\n\013temperature\030\003 \001(\002\"e\n\014Sens"
-  "orPacket\022\021\n\ttimestamp\030\001 \001(\r\022\032\n\010imu_data\030"
-  "\002 \001(\0132\010.ImuData\022&\n\016altimeter_data\030\003 \001(\0132"
-  "\016.AltimeterDatab\006proto3"
+const char descriptor_table_protodef_sensor_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021sensor_data.proto\"\250\001\n\nImuPayload\022\016\n\006gy"
+  "ro_x\030\001 \001(\021\022\016\n\006gyro_y\030\002 \001(\021\022\016\n\006gyro_z\030\003 \001"
+  "(\021\022\017\n\007euler_x\030\004 \001(\021\022\017\n\007euler_y\030\005 \001(\021\022\017\n\007"
+  "euler_z\030\006 \001(\021\022\021\n\tlin_acc_x\030\007 \001(\021\022\021\n\tlin_"
+  "acc_y\030\010 \001(\021\022\021\n\tlin_acc_z\030\t \001(\021\"1\n\tRcPayl"
+  "oad\022\020\n\010vertical\030\001 \001(\021\022\022\n\nhorizontal\030\002 \001("
+  "\021\"7\n\tImuRecord\022\020\n\010instance\030\001 \001(\r\022\030\n\003imu\030"
+  "\002 \001(\0132\013.ImuPayload\"4\n\013RangeRecord\022\020\n\010ins"
+  "tance\030\001 \001(\r\022\023\n\013distance_mm\030\002 \001(\r\"\240\001\n\014Sen"
+  "sorPacket\022\024\n\014timestamp_us\030\001 \001(\r\022\020\n\010lidar"
+  "_mm\030\002 \001(\r\022\030\n\003imu\030\003 \001(\0132\013.ImuPayload\022\026\n\002r"
+  "c\030\004 \001(\0132\n.RcPayload\022\030\n\004imus\030\005 \003(\0132\n.ImuR"
+  "ecord\022\034\n\006ranges\030\006 \003(\0132\014.RangeRecordb\006pro"
+  "to3"
   ;
-static ::_pbi::once_flag descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto = {
-    false, false, 343, descriptor_table_protodef_shared_2fproto_2fsensor_5fdata_2eproto,
-    "shared/proto/sensor_data.proto",
-    &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once, nullptr, 0, 4,
-    schemas, file_default_instances, TableStruct_shared_2fproto_2fsensor_5fdata_2eproto::offsets,
-    file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto, file_level_enum_descriptors_shared_2fproto_2fsensor_5fdata_2eproto,
-    file_level_service_descriptors_shared_2fproto_2fsensor_5fdata_2eproto,
+static ::_pbi::once_flag descriptor_table_sensor_5fdata_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_sensor_5fdata_2eproto = {
+    false, false, 523, descriptor_table_protodef_sensor_5fdata_2eproto,
+    "sensor_data.proto",
+    &descriptor_table_sensor_5fdata_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_sensor_5fdata_2eproto::offsets,
+    file_level_metadata_sensor_5fdata_2eproto, file_level_enum_descriptors_sensor_5fdata_2eproto,
+    file_level_service_descriptors_sensor_5fdata_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_getter() {
-  return &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto;
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_sensor_5fdata_2eproto_getter() {
+  return &descriptor_table_sensor_5fdata_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_shared_2fproto_2fsensor_5fdata_2eproto(&descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_sensor_5fdata_2eproto(&descriptor_table_sensor_5fdata_2eproto);
 
 // ===================================================================
 
-class Vector3D::_Internal {
+class ImuPayload::_Internal {
  public:
 };
 
-Vector3D::Vector3D(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ImuPayload::ImuPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Vector3D)
+  // @@protoc_insertion_point(arena_constructor:ImuPayload)
 }
-Vector3D::Vector3D(const Vector3D& from)
+ImuPayload::ImuPayload(const ImuPayload& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  Vector3D* const _this = this; (void)_this;
+  ImuPayload* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.x_){}
-    , decltype(_impl_.y_){}
-    , decltype(_impl_.z_){}
+      decltype(_impl_.gyro_x_){}
+    , decltype(_impl_.gyro_y_){}
+    , decltype(_impl_.gyro_z_){}
+    , decltype(_impl_.euler_x_){}
+    , decltype(_impl_.euler_y_){}
+    , decltype(_impl_.euler_z_){}
+    , decltype(_impl_.lin_acc_x_){}
+    , decltype(_impl_.lin_acc_y_){}
+    , decltype(_impl_.lin_acc_z_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.x_, &from._impl_.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
-    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
-  // @@protoc_insertion_point(copy_constructor:Vector3D)
+  ::memcpy(&_impl_.gyro_x_, &from._impl_.gyro_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lin_acc_z_) -
+    reinterpret_cast<char*>(&_impl_.gyro_x_)) + sizeof(_impl_.lin_acc_z_));
+  // @@protoc_insertion_point(copy_constructor:ImuPayload)
 }
 
-inline void Vector3D::SharedCtor(
+inline void ImuPayload::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.x_){0}
-    , decltype(_impl_.y_){0}
-    , decltype(_impl_.z_){0}
+      decltype(_impl_.gyro_x_){0}
+    , decltype(_impl_.gyro_y_){0}
+    , decltype(_impl_.gyro_z_){0}
+    , decltype(_impl_.euler_x_){0}
+    , decltype(_impl_.euler_y_){0}
+    , decltype(_impl_.euler_z_){0}
+    , decltype(_impl_.lin_acc_x_){0}
+    , decltype(_impl_.lin_acc_y_){0}
+    , decltype(_impl_.lin_acc_z_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-Vector3D::~Vector3D() {
-  // @@protoc_insertion_point(destructor:Vector3D)
+ImuPayload::~ImuPayload() {
+  // @@protoc_insertion_point(destructor:ImuPayload)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -210,53 +267,101 @@ Vector3D::~Vector3D() {
   SharedDtor();
 }
 
-inline void Vector3D::SharedDtor() {
+inline void ImuPayload::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Vector3D::SetCachedSize(int size) const {
+void ImuPayload::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void Vector3D::Clear() {
-// @@protoc_insertion_point(message_clear_start:Vector3D)
+void ImuPayload::Clear() {
+// @@protoc_insertion_point(message_clear_start:ImuPayload)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.z_) -
-      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  ::memset(&_impl_.gyro_x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lin_acc_z_) -
+      reinterpret_cast<char*>(&_impl_.gyro_x_)) + sizeof(_impl_.lin_acc_z_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Vector3D::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ImuPayload::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float x = 1;
+      // sint32 gyro_x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
-          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.gyro_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // float y = 2;
+      // sint32 gyro_y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
-          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.gyro_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // float z = 3;
+      // sint32 gyro_z = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
-          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.gyro_z_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 euler_x = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.euler_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 euler_y = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.euler_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 euler_z = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.euler_z_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 lin_acc_x = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.lin_acc_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 lin_acc_y = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.lin_acc_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 lin_acc_z = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.lin_acc_z_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -283,208 +388,460 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Vector3D::_InternalSerialize(
+uint8_t* ImuPayload::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Vector3D)
+  // @@protoc_insertion_point(serialize_to_array_start:ImuPayload)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float x = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_x = this->_internal_x();
-  uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
+  // sint32 gyro_x = 1;
+  if (this->_internal_gyro_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(1, this->_internal_gyro_x(), target);
+  }
+
+  // sint32 gyro_y = 2;
+  if (this->_internal_gyro_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(2, this->_internal_gyro_y(), target);
+  }
+
+  // sint32 gyro_z = 3;
+  if (this->_internal_gyro_z() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(3, this->_internal_gyro_z(), target);
+  }
+
+  // sint32 euler_x = 4;
+  if (this->_internal_euler_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(4, this->_internal_euler_x(), target);
+  }
+
+  // sint32 euler_y = 5;
+  if (this->_internal_euler_y() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(5, this->_internal_euler_y(), target);
   }
 
-  // float y = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_y = this->_internal_y();
-  uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
+  // sint32 euler_z = 6;
+  if (this->_internal_euler_z() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(6, this->_internal_euler_z(), target);
   }
 
-  // float z = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_z = this->_internal_z();
-  uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
+  // sint32 lin_acc_x = 7;
+  if (this->_internal_lin_acc_x() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(7, this->_internal_lin_acc_x(), target);
+  }
+
+  // sint32 lin_acc_y = 8;
+  if (this->_internal_lin_acc_y() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(8, this->_internal_lin_acc_y(), target);
+  }
+
+  // sint32 lin_acc_z = 9;
+  if (this->_internal_lin_acc_z() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(9, this->_internal_lin_acc_z(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Vector3D)
+  // @@protoc_insertion_point(serialize_to_array_end:ImuPayload)
   return target;
 }
 
-size_t Vector3D::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Vector3D)
+size_t ImuPayload::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ImuPayload)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float x = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_x = this->_internal_x();
-  uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
-    total_size += 1 + 4;
+  // sint32 gyro_x = 1;
+  if (this->_internal_gyro_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_gyro_x());
+  }
+
+  // sint32 gyro_y = 2;
+  if (this->_internal_gyro_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_gyro_y());
+  }
+
+  // sint32 gyro_z = 3;
+  if (this->_internal_gyro_z() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_gyro_z());
+  }
+
+  // sint32 euler_x = 4;
+  if (this->_internal_euler_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_euler_x());
+  }
+
+  // sint32 euler_y = 5;
+  if (this->_internal_euler_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_euler_y());
+  }
+
+  // sint32 euler_z = 6;
+  if (this->_internal_euler_z() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_euler_z());
   }
 
-  // float y = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_y = this->_internal_y();
-  uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
-    total_size += 1 + 4;
+  // sint32 lin_acc_x = 7;
+  if (this->_internal_lin_acc_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_lin_acc_x());
   }
 
-  // float z = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_z = this->_internal_z();
-  uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
-    total_size += 1 + 4;
+  // sint32 lin_acc_y = 8;
+  if (this->_internal_lin_acc_y() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_lin_acc_y());
+  }
+
+  // sint32 lin_acc_z = 9;
+  if (this->_internal_lin_acc_z() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_lin_acc_z());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vector3D::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ImuPayload::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    Vector3D::MergeImpl
+    ImuPayload::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vector3D::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ImuPayload::GetClassData() const { return &_class_data_; }
 
 
-void Vector3D::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<Vector3D*>(&to_msg);
-  auto& from = static_cast<const Vector3D&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Vector3D)
+void ImuPayload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ImuPayload*>(&to_msg);
+  auto& from = static_cast<const ImuPayload&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ImuPayload)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_x = from._internal_x();
-  uint32_t raw_x;
-  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
-  if (raw_x != 0) {
-    _this->_internal_set_x(from._internal_x());
-  }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_y = from._internal_y();
-  uint32_t raw_y;
-  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
-  if (raw_y != 0) {
-    _this->_internal_set_y(from._internal_y());
-  }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_z = from._internal_z();
-  uint32_t raw_z;
-  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
-  if (raw_z != 0) {
-    _this->_internal_set_z(from._internal_z());
+  if (from._internal_gyro_x() != 0) {
+    _this->_internal_set_gyro_x(from._internal_gyro_x());
+  }
+  if (from._internal_gyro_y() != 0) {
+    _this->_internal_set_gyro_y(from._internal_gyro_y());
+  }
+  if (from._internal_gyro_z() != 0) {
+    _this->_internal_set_gyro_z(from._internal_gyro_z());
+  }
+  if (from._internal_euler_x() != 0) {
+    _this->_internal_set_euler_x(from._internal_euler_x());
+  }
+  if (from._internal_euler_y() != 0) {
+    _this->_internal_set_euler_y(from._internal_euler_y());
+  }
+  if (from._internal_euler_z() != 0) {
+    _this->_internal_set_euler_z(from._internal_euler_z());
+  }
+  if (from._internal_lin_acc_x() != 0) {
+    _this->_internal_set_lin_acc_x(from._internal_lin_acc_x());
+  }
+  if (from._internal_lin_acc_y() != 0) {
+    _this->_internal_set_lin_acc_y(from._internal_lin_acc_y());
+  }
+  if (from._internal_lin_acc_z() != 0) {
+    _this->_internal_set_lin_acc_z(from._internal_lin_acc_z());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Vector3D::CopyFrom(const Vector3D& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Vector3D)
+void ImuPayload::CopyFrom(const ImuPayload& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ImuPayload)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Vector3D::IsInitialized() const {
+bool ImuPayload::IsInitialized() const {
   return true;
 }
 
-void Vector3D::InternalSwap(Vector3D* other) {
+void ImuPayload::InternalSwap(ImuPayload* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Vector3D, _impl_.z_)
-      + sizeof(Vector3D::_impl_.z_)
-      - PROTOBUF_FIELD_OFFSET(Vector3D, _impl_.x_)>(
-          reinterpret_cast<char*>(&_impl_.x_),
-          reinterpret_cast<char*>(&other->_impl_.x_));
+      PROTOBUF_FIELD_OFFSET(ImuPayload, _impl_.lin_acc_z_)
+      + sizeof(ImuPayload::_impl_.lin_acc_z_)
+      - PROTOBUF_FIELD_OFFSET(ImuPayload, _impl_.gyro_x_)>(
+          reinterpret_cast<char*>(&_impl_.gyro_x_),
+          reinterpret_cast<char*>(&other->_impl_.gyro_x_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Vector3D::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ImuPayload::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
-      &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_getter, &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once,
-      file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto[0]);
+      &descriptor_table_sensor_5fdata_2eproto_getter, &descriptor_table_sensor_5fdata_2eproto_once,
+      file_level_metadata_sensor_5fdata_2eproto[0]);
 }
 
 // ===================================================================
 
-class ImuData::_Internal {
+class RcPayload::_Internal {
  public:
-  static const ::Vector3D& acceleration(const ImuData* msg);
-  static const ::Vector3D& angular_velocity(const ImuData* msg);
 };
 
-const ::Vector3D&
-ImuData::_Internal::acceleration(const ImuData* msg) {
-  return *msg->_impl_.acceleration_;
+RcPayload::RcPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RcPayload)
+}
+RcPayload::RcPayload(const RcPayload& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RcPayload* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertical_){}
+    , decltype(_impl_.horizontal_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.vertical_, &from._impl_.vertical_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.horizontal_) -
+    reinterpret_cast<char*>(&_impl_.vertical_)) + sizeof(_impl_.horizontal_));
+  // @@protoc_insertion_point(copy_constructor:RcPayload)
+}
+
+inline void RcPayload::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertical_){0}
+    , decltype(_impl_.horizontal_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RcPayload::~RcPayload() {
+  // @@protoc_insertion_point(destructor:RcPayload)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RcPayload::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RcPayload::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RcPayload::Clear() {
+// @@protoc_insertion_point(message_clear_start:RcPayload)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.vertical_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.horizontal_) -
+      reinterpret_cast<char*>(&_impl_.vertical_)) + sizeof(_impl_.horizontal_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RcPayload::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // sint32 vertical = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vertical_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 horizontal = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.horizontal_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RcPayload::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RcPayload)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // sint32 vertical = 1;
+  if (this->_internal_vertical() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(1, this->_internal_vertical(), target);
+  }
+
+  // sint32 horizontal = 2;
+  if (this->_internal_horizontal() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(2, this->_internal_horizontal(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RcPayload)
+  return target;
+}
+
+size_t RcPayload::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RcPayload)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // sint32 vertical = 1;
+  if (this->_internal_vertical() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_vertical());
+  }
+
+  // sint32 horizontal = 2;
+  if (this->_internal_horizontal() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_horizontal());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RcPayload::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RcPayload::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RcPayload::GetClassData() const { return &_class_data_; }
+
+
+void RcPayload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RcPayload*>(&to_msg);
+  auto& from = static_cast<const RcPayload&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RcPayload)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_vertical() != 0) {
+    _this->_internal_set_vertical(from._internal_vertical());
+  }
+  if (from._internal_horizontal() != 0) {
+    _this->_internal_set_horizontal(from._internal_horizontal());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-const ::Vector3D&
-ImuData::_Internal::angular_velocity(const ImuData* msg) {
-  return *msg->_impl_.angular_velocity_;
+
+void RcPayload::CopyFrom(const RcPayload& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RcPayload)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-ImuData::ImuData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+
+bool RcPayload::IsInitialized() const {
+  return true;
+}
+
+void RcPayload::InternalSwap(RcPayload* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RcPayload, _impl_.horizontal_)
+      + sizeof(RcPayload::_impl_.horizontal_)
+      - PROTOBUF_FIELD_OFFSET(RcPayload, _impl_.vertical_)>(
+          reinterpret_cast<char*>(&_impl_.vertical_),
+          reinterpret_cast<char*>(&other->_impl_.vertical_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RcPayload::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sensor_5fdata_2eproto_getter, &descriptor_table_sensor_5fdata_2eproto_once,
+      file_level_metadata_sensor_5fdata_2eproto[1]);
+}
+
+// ===================================================================
+
+class ImuRecord::_Internal {
+ public:
+  static const ::ImuPayload& imu(const ImuRecord* msg);
+};
+
+const ::ImuPayload&
+ImuRecord::_Internal::imu(const ImuRecord* msg) {
+  return *msg->_impl_.imu_;
+}
+ImuRecord::ImuRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:ImuData)
+  // @@protoc_insertion_point(arena_constructor:ImuRecord)
 }
-ImuData::ImuData(const ImuData& from)
+ImuRecord::ImuRecord(const ImuRecord& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ImuData* const _this = this; (void)_this;
+  ImuRecord* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.acceleration_){nullptr}
-    , decltype(_impl_.angular_velocity_){nullptr}
+      decltype(_impl_.imu_){nullptr}
+    , decltype(_impl_.instance_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_acceleration()) {
-    _this->_impl_.acceleration_ = new ::Vector3D(*from._impl_.acceleration_);
-  }
-  if (from._internal_has_angular_velocity()) {
-    _this->_impl_.angular_velocity_ = new ::Vector3D(*from._impl_.angular_velocity_);
+  if (from._internal_has_imu()) {
+    _this->_impl_.imu_ = new ::ImuPayload(*from._impl_.imu_);
   }
-  // @@protoc_insertion_point(copy_constructor:ImuData)
+  _this->_impl_.instance_ = from._impl_.instance_;
+  // @@protoc_insertion_point(copy_constructor:ImuRecord)
 }
 
-inline void ImuData::SharedCtor(
+inline void ImuRecord::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.acceleration_){nullptr}
-    , decltype(_impl_.angular_velocity_){nullptr}
+      decltype(_impl_.imu_){nullptr}
+    , decltype(_impl_.instance_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ImuData::~ImuData() {
-  // @@protoc_insertion_point(destructor:ImuData)
+ImuRecord::~ImuRecord() {
+  // @@protoc_insertion_point(destructor:ImuRecord)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -492,51 +849,47 @@ ImuData::~ImuData() {
   SharedDtor();
 }
 
-inline void ImuData::SharedDtor() {
+inline void ImuRecord::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.acceleration_;
-  if (this != internal_default_instance()) delete _impl_.angular_velocity_;
+  if (this != internal_default_instance()) delete _impl_.imu_;
 }
 
-void ImuData::SetCachedSize(int size) const {
+void ImuRecord::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ImuData::Clear() {
-// @@protoc_insertion_point(message_clear_start:ImuData)
+void ImuRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:ImuRecord)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.acceleration_ != nullptr) {
-    delete _impl_.acceleration_;
+  if (GetArenaForAllocation() == nullptr && _impl_.imu_ != nullptr) {
+    delete _impl_.imu_;
   }
-  _impl_.acceleration_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.angular_velocity_ != nullptr) {
-    delete _impl_.angular_velocity_;
-  }
-  _impl_.angular_velocity_ = nullptr;
+  _impl_.imu_ = nullptr;
+  _impl_.instance_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ImuData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ImuRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Vector3D acceleration = 1;
+      // uint32 instance = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_acceleration(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.instance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .Vector3D angular_velocity = 2;
+      // .ImuPayload imu = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_angular_velocity(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_imu(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -564,155 +917,149 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ImuData::_InternalSerialize(
+uint8_t* ImuRecord::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ImuData)
+  // @@protoc_insertion_point(serialize_to_array_start:ImuRecord)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Vector3D acceleration = 1;
-  if (this->_internal_has_acceleration()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::acceleration(this),
-        _Internal::acceleration(this).GetCachedSize(), target, stream);
+  // uint32 instance = 1;
+  if (this->_internal_instance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_instance(), target);
   }
 
-  // .Vector3D angular_velocity = 2;
-  if (this->_internal_has_angular_velocity()) {
+  // .ImuPayload imu = 2;
+  if (this->_internal_has_imu()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::angular_velocity(this),
-        _Internal::angular_velocity(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(2, _Internal::imu(this),
+        _Internal::imu(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ImuData)
+  // @@protoc_insertion_point(serialize_to_array_end:ImuRecord)
   return target;
 }
 
-size_t ImuData::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ImuData)
+size_t ImuRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ImuRecord)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .Vector3D acceleration = 1;
-  if (this->_internal_has_acceleration()) {
+  // .ImuPayload imu = 2;
+  if (this->_internal_has_imu()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.acceleration_);
+        *_impl_.imu_);
   }
 
-  // .Vector3D angular_velocity = 2;
-  if (this->_internal_has_angular_velocity()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.angular_velocity_);
+  // uint32 instance = 1;
+  if (this->_internal_instance() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_instance());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ImuData::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ImuRecord::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ImuData::MergeImpl
+    ImuRecord::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ImuData::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ImuRecord::GetClassData() const { return &_class_data_; }
 
 
-void ImuData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ImuData*>(&to_msg);
-  auto& from = static_cast<const ImuData&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:ImuData)
+void ImuRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ImuRecord*>(&to_msg);
+  auto& from = static_cast<const ImuRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ImuRecord)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_acceleration()) {
-    _this->_internal_mutable_acceleration()->::Vector3D::MergeFrom(
-        from._internal_acceleration());
+  if (from._internal_has_imu()) {
+    _this->_internal_mutable_imu()->::ImuPayload::MergeFrom(
+        from._internal_imu());
   }
-  if (from._internal_has_angular_velocity()) {
-    _this->_internal_mutable_angular_velocity()->::Vector3D::MergeFrom(
-        from._internal_angular_velocity());
+  if (from._internal_instance() != 0) {
+    _this->_internal_set_instance(from._internal_instance());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ImuData::CopyFrom(const ImuData& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ImuData)
+void ImuRecord::CopyFrom(const ImuRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ImuRecord)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ImuData::IsInitialized() const {
+bool ImuRecord::IsInitialized() const {
   return true;
 }
 
-void ImuData::InternalSwap(ImuData* other) {
+void ImuRecord::InternalSwap(ImuRecord* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ImuData, _impl_.angular_velocity_)
-      + sizeof(ImuData::_impl_.angular_velocity_)
-      - PROTOBUF_FIELD_OFFSET(ImuData, _impl_.acceleration_)>(
-          reinterpret_cast<char*>(&_impl_.acceleration_),
-          reinterpret_cast<char*>(&other->_impl_.acceleration_));
+      PROTOBUF_FIELD_OFFSET(ImuRecord, _impl_.instance_)
+      + sizeof(ImuRecord::_impl_.instance_)
+      - PROTOBUF_FIELD_OFFSET(ImuRecord, _impl_.imu_)>(
+          reinterpret_cast<char*>(&_impl_.imu_),
+          reinterpret_cast<char*>(&other->_impl_.imu_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ImuData::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ImuRecord::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
-      &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_getter, &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once,
-      file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto[1]);
+      &descriptor_table_sensor_5fdata_2eproto_getter, &descriptor_table_sensor_5fdata_2eproto_once,
+      file_level_metadata_sensor_5fdata_2eproto[2]);
 }
 
 // ===================================================================
 
-class AltimeterData::_Internal {
+class RangeRecord::_Internal {
  public:
 };
 
-AltimeterData::AltimeterData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+RangeRecord::RangeRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:AltimeterData)
+  // @@protoc_insertion_point(arena_constructor:RangeRecord)
 }
-AltimeterData::AltimeterData(const AltimeterData& from)
+RangeRecord::RangeRecord(const RangeRecord& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AltimeterData* const _this = this; (void)_this;
+  RangeRecord* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.pressure_){}
-    , decltype(_impl_.altitude_){}
-    , decltype(_impl_.temperature_){}
+      decltype(_impl_.instance_){}
+    , decltype(_impl_.distance_mm_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.pressure_, &from._impl_.pressure_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.temperature_) -
-    reinterpret_cast<char*>(&_impl_.pressure_)) + sizeof(_impl_.temperature_));
-  // @@protoc_insertion_point(copy_constructor:AltimeterData)
+  ::memcpy(&_impl_.instance_, &from._impl_.instance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.distance_mm_) -
+    reinterpret_cast<char*>(&_impl_.instance_)) + sizeof(_impl_.distance_mm_));
+  // @@protoc_insertion_point(copy_constructor:RangeRecord)
 }
 
-inline void AltimeterData::SharedCtor(
+inline void RangeRecord::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.pressure_){0}
-    , decltype(_impl_.altitude_){0}
-    , decltype(_impl_.temperature_){0}
+      decltype(_impl_.instance_){0u}
+    , decltype(_impl_.distance_mm_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-AltimeterData::~AltimeterData() {
-  // @@protoc_insertion_point(destructor:AltimeterData)
+RangeRecord::~RangeRecord() {
+  // @@protoc_insertion_point(destructor:RangeRecord)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -720,53 +1067,45 @@ AltimeterData::~AltimeterData() {
   SharedDtor();
 }
 
-inline void AltimeterData::SharedDtor() {
+inline void RangeRecord::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AltimeterData::SetCachedSize(int size) const {
+void RangeRecord::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AltimeterData::Clear() {
-// @@protoc_insertion_point(message_clear_start:AltimeterData)
+void RangeRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:RangeRecord)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.pressure_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.temperature_) -
-      reinterpret_cast<char*>(&_impl_.pressure_)) + sizeof(_impl_.temperature_));
+  ::memset(&_impl_.instance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.distance_mm_) -
+      reinterpret_cast<char*>(&_impl_.instance_)) + sizeof(_impl_.distance_mm_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AltimeterData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* RangeRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float pressure = 1;
+      // uint32 instance = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
-          _impl_.pressure_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.instance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // float altitude = 2;
+      // uint32 distance_mm = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
-          _impl_.altitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else
-          goto handle_unusual;
-        continue;
-      // float temperature = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
-          _impl_.temperature_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.distance_mm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -793,170 +1132,120 @@ failure:
 #undef CHK_
 }
 
-uint8_t* AltimeterData::_InternalSerialize(
+uint8_t* RangeRecord::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:AltimeterData)
+  // @@protoc_insertion_point(serialize_to_array_start:RangeRecord)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float pressure = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pressure = this->_internal_pressure();
-  uint32_t raw_pressure;
-  memcpy(&raw_pressure, &tmp_pressure, sizeof(tmp_pressure));
-  if (raw_pressure != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pressure(), target);
-  }
-
-  // float altitude = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude = this->_internal_altitude();
-  uint32_t raw_altitude;
-  memcpy(&raw_altitude, &tmp_altitude, sizeof(tmp_altitude));
-  if (raw_altitude != 0) {
+  // uint32 instance = 1;
+  if (this->_internal_instance() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_altitude(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_instance(), target);
   }
 
-  // float temperature = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_temperature = this->_internal_temperature();
-  uint32_t raw_temperature;
-  memcpy(&raw_temperature, &tmp_temperature, sizeof(tmp_temperature));
-  if (raw_temperature != 0) {
+  // uint32 distance_mm = 2;
+  if (this->_internal_distance_mm() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_temperature(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_distance_mm(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:AltimeterData)
+  // @@protoc_insertion_point(serialize_to_array_end:RangeRecord)
   return target;
 }
 
-size_t AltimeterData::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:AltimeterData)
+size_t RangeRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RangeRecord)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float pressure = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pressure = this->_internal_pressure();
-  uint32_t raw_pressure;
-  memcpy(&raw_pressure, &tmp_pressure, sizeof(tmp_pressure));
-  if (raw_pressure != 0) {
-    total_size += 1 + 4;
+  // uint32 instance = 1;
+  if (this->_internal_instance() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_instance());
   }
 
-  // float altitude = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude = this->_internal_altitude();
-  uint32_t raw_altitude;
-  memcpy(&raw_altitude, &tmp_altitude, sizeof(tmp_altitude));
-  if (raw_altitude != 0) {
-    total_size += 1 + 4;
-  }
-
-  // float temperature = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_temperature = this->_internal_temperature();
-  uint32_t raw_temperature;
-  memcpy(&raw_temperature, &tmp_temperature, sizeof(tmp_temperature));
-  if (raw_temperature != 0) {
-    total_size += 1 + 4;
+  // uint32 distance_mm = 2;
+  if (this->_internal_distance_mm() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_distance_mm());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AltimeterData::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeRecord::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AltimeterData::MergeImpl
+    RangeRecord::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AltimeterData::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeRecord::GetClassData() const { return &_class_data_; }
 
 
-void AltimeterData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AltimeterData*>(&to_msg);
-  auto& from = static_cast<const AltimeterData&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:AltimeterData)
+void RangeRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeRecord*>(&to_msg);
+  auto& from = static_cast<const RangeRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RangeRecord)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pressure = from._internal_pressure();
-  uint32_t raw_pressure;
-  memcpy(&raw_pressure, &tmp_pressure, sizeof(tmp_pressure));
-  if (raw_pressure != 0) {
-    _this->_internal_set_pressure(from._internal_pressure());
-  }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude = from._internal_altitude();
-  uint32_t raw_altitude;
-  memcpy(&raw_altitude, &tmp_altitude, sizeof(tmp_altitude));
-  if (raw_altitude != 0) {
-    _this->_internal_set_altitude(from._internal_altitude());
-  }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_temperature = from._internal_temperature();
-  uint32_t raw_temperature;
-  memcpy(&raw_temperature, &tmp_temperature, sizeof(tmp_temperature));
-  if (raw_temperature != 0) {
-    _this->_internal_set_temperature(from._internal_temperature());
+  if (from._internal_instance() != 0) {
+    _this->_internal_set_instance(from._internal_instance());
+  }
+  if (from._internal_distance_mm() != 0) {
+    _this->_internal_set_distance_mm(from._internal_distance_mm());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AltimeterData::CopyFrom(const AltimeterData& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:AltimeterData)
+void RangeRecord::CopyFrom(const RangeRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RangeRecord)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AltimeterData::IsInitialized() const {
+bool RangeRecord::IsInitialized() const {
   return true;
 }
 
-void AltimeterData::InternalSwap(AltimeterData* other) {
+void RangeRecord::InternalSwap(RangeRecord* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AltimeterData, _impl_.temperature_)
-      + sizeof(AltimeterData::_impl_.temperature_)
-      - PROTOBUF_FIELD_OFFSET(AltimeterData, _impl_.pressure_)>(
-          reinterpret_cast<char*>(&_impl_.pressure_),
-          reinterpret_cast<char*>(&other->_impl_.pressure_));
+      PROTOBUF_FIELD_OFFSET(RangeRecord, _impl_.distance_mm_)
+      + sizeof(RangeRecord::_impl_.distance_mm_)
+      - PROTOBUF_FIELD_OFFSET(RangeRecord, _impl_.instance_)>(
+          reinterpret_cast<char*>(&_impl_.instance_),
+          reinterpret_cast<char*>(&other->_impl_.instance_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AltimeterData::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata RangeRecord::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
-      &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_getter, &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once,
-      file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto[2]);
+      &descriptor_table_sensor_5fdata_2eproto_getter, &descriptor_table_sensor_5fdata_2eproto_once,
+      file_level_metadata_sensor_5fdata_2eproto[3]);
 }
 
 // ===================================================================
 
 class SensorPacket::_Internal {
  public:
-  static const ::ImuData& imu_data(const SensorPacket* msg);
-  static const ::AltimeterData& altimeter_data(const SensorPacket* msg);
+  static const ::ImuPayload& imu(const SensorPacket* msg);
+  static const ::RcPayload& rc(const SensorPacket* msg);
 };
 
-const ::ImuData&
-SensorPacket::_Internal::imu_data(const SensorPacket* msg) {
-  return *msg->_impl_.imu_data_;
+const ::ImuPayload&
+SensorPacket::_Internal::imu(const SensorPacket* msg) {
+  return *msg->_impl_.imu_;
 }
-const ::AltimeterData&
-SensorPacket::_Internal::altimeter_data(const SensorPacket* msg) {
-  return *msg->_impl_.altimeter_data_;
+const ::RcPayload&
+SensorPacket::_Internal::rc(const SensorPacket* msg) {
+  return *msg->_impl_.rc_;
 }
 SensorPacket::SensorPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
@@ -968,19 +1257,24 @@ SensorPacket::SensorPacket(const SensorPacket& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   SensorPacket* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.imu_data_){nullptr}
-    , decltype(_impl_.altimeter_data_){nullptr}
-    , decltype(_impl_.timestamp_){}
+      decltype(_impl_.imus_){from._impl_.imus_}
+    , decltype(_impl_.ranges_){from._impl_.ranges_}
+    , decltype(_impl_.imu_){nullptr}
+    , decltype(_impl_.rc_){nullptr}
+    , decltype(_impl_.timestamp_us_){}
+    , decltype(_impl_.lidar_mm_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_imu_data()) {
-    _this->_impl_.imu_data_ = new ::ImuData(*from._impl_.imu_data_);
+  if (from._internal_has_imu()) {
+    _this->_impl_.imu_ = new ::ImuPayload(*from._impl_.imu_);
   }
-  if (from._internal_has_altimeter_data()) {
-    _this->_impl_.altimeter_data_ = new ::AltimeterData(*from._impl_.altimeter_data_);
+  if (from._internal_has_rc()) {
+    _this->_impl_.rc_ = new ::RcPayload(*from._impl_.rc_);
   }
-  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  ::memcpy(&_impl_.timestamp_us_, &from._impl_.timestamp_us_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lidar_mm_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_us_)) + sizeof(_impl_.lidar_mm_));
   // @@protoc_insertion_point(copy_constructor:SensorPacket)
 }
 
@@ -989,9 +1283,12 @@ inline void SensorPacket::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.imu_data_){nullptr}
-    , decltype(_impl_.altimeter_data_){nullptr}
-    , decltype(_impl_.timestamp_){0u}
+      decltype(_impl_.imus_){arena}
+    , decltype(_impl_.ranges_){arena}
+    , decltype(_impl_.imu_){nullptr}
+    , decltype(_impl_.rc_){nullptr}
+    , decltype(_impl_.timestamp_us_){0u}
+    , decltype(_impl_.lidar_mm_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1007,8 +1304,10 @@ SensorPacket::~SensorPacket() {
 
 inline void SensorPacket::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.imu_data_;
-  if (this != internal_default_instance()) delete _impl_.altimeter_data_;
+  _impl_.imus_.~RepeatedPtrField();
+  _impl_.ranges_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.imu_;
+  if (this != internal_default_instance()) delete _impl_.rc_;
 }
 
 void SensorPacket::SetCachedSize(int size) const {
@@ -1021,15 +1320,19 @@ void SensorPacket::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.imu_data_ != nullptr) {
-    delete _impl_.imu_data_;
+  _impl_.imus_.Clear();
+  _impl_.ranges_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.imu_ != nullptr) {
+    delete _impl_.imu_;
   }
-  _impl_.imu_data_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.altimeter_data_ != nullptr) {
-    delete _impl_.altimeter_data_;
+  _impl_.imu_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.rc_ != nullptr) {
+    delete _impl_.rc_;
   }
-  _impl_.altimeter_data_ = nullptr;
-  _impl_.timestamp_ = 0u;
+  _impl_.rc_ = nullptr;
+  ::memset(&_impl_.timestamp_us_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lidar_mm_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_us_)) + sizeof(_impl_.lidar_mm_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1039,30 +1342,64 @@ const char* SensorPacket::_InternalParse(const char* ptr, ::_pbi::ParseContext*
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 timestamp = 1;
+      // uint32 timestamp_us = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.timestamp_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .ImuData imu_data = 2;
+      // uint32 lidar_mm = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_imu_data(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.lidar_mm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .AltimeterData altimeter_data = 3;
+      // .ImuPayload imu = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_altimeter_data(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_imu(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // .RcPayload rc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .ImuRecord imus = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_imus(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RangeRecord ranges = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1092,24 +1429,46 @@ uint8_t* SensorPacket::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
+  // uint32 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_timestamp(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_timestamp_us(), target);
   }
 
-  // .ImuData imu_data = 2;
-  if (this->_internal_has_imu_data()) {
+  // uint32 lidar_mm = 2;
+  if (this->_internal_lidar_mm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_lidar_mm(), target);
+  }
+
+  // .ImuPayload imu = 3;
+  if (this->_internal_has_imu()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::imu(this),
+        _Internal::imu(this).GetCachedSize(), target, stream);
+  }
+
+  // .RcPayload rc = 4;
+  if (this->_internal_has_rc()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::rc(this),
+        _Internal::rc(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .ImuRecord imus = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_imus_size()); i < n; i++) {
+    const auto& repfield = this->_internal_imus(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::imu_data(this),
-        _Internal::imu_data(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .AltimeterData altimeter_data = 3;
-  if (this->_internal_has_altimeter_data()) {
+  // repeated .RangeRecord ranges = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ranges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ranges(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::altimeter_data(this),
-        _Internal::altimeter_data(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -1128,23 +1487,42 @@ size_t SensorPacket::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .ImuData imu_data = 2;
-  if (this->_internal_has_imu_data()) {
+  // repeated .ImuRecord imus = 5;
+  total_size += 1UL * this->_internal_imus_size();
+  for (const auto& msg : this->_impl_.imus_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .RangeRecord ranges = 6;
+  total_size += 1UL * this->_internal_ranges_size();
+  for (const auto& msg : this->_impl_.ranges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .ImuPayload imu = 3;
+  if (this->_internal_has_imu()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.imu_data_);
+        *_impl_.imu_);
   }
 
-  // .AltimeterData altimeter_data = 3;
-  if (this->_internal_has_altimeter_data()) {
+  // .RcPayload rc = 4;
+  if (this->_internal_has_rc()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.altimeter_data_);
+        *_impl_.rc_);
   }
 
-  // uint32 timestamp = 1;
-  if (this->_internal_timestamp() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timestamp());
+  // uint32 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timestamp_us());
+  }
+
+  // uint32 lidar_mm = 2;
+  if (this->_internal_lidar_mm() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_lidar_mm());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
@@ -1165,16 +1543,21 @@ void SensorPacket::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_imu_data()) {
-    _this->_internal_mutable_imu_data()->::ImuData::MergeFrom(
-        from._internal_imu_data());
+  _this->_impl_.imus_.MergeFrom(from._impl_.imus_);
+  _this->_impl_.ranges_.MergeFrom(from._impl_.ranges_);
+  if (from._internal_has_imu()) {
+    _this->_internal_mutable_imu()->::ImuPayload::MergeFrom(
+        from._internal_imu());
   }
-  if (from._internal_has_altimeter_data()) {
-    _this->_internal_mutable_altimeter_data()->::AltimeterData::MergeFrom(
-        from._internal_altimeter_data());
+  if (from._internal_has_rc()) {
+    _this->_internal_mutable_rc()->::RcPayload::MergeFrom(
+        from._internal_rc());
   }
-  if (from._internal_timestamp() != 0) {
-    _this->_internal_set_timestamp(from._internal_timestamp());
+  if (from._internal_timestamp_us() != 0) {
+    _this->_internal_set_timestamp_us(from._internal_timestamp_us());
+  }
+  if (from._internal_lidar_mm() != 0) {
+    _this->_internal_set_lidar_mm(from._internal_lidar_mm());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -1193,33 +1576,39 @@ bool SensorPacket::IsInitialized() const {
 void SensorPacket::InternalSwap(SensorPacket* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.imus_.InternalSwap(&other->_impl_.imus_);
+  _impl_.ranges_.InternalSwap(&other->_impl_.ranges_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SensorPacket, _impl_.timestamp_)
-      + sizeof(SensorPacket::_impl_.timestamp_)
-      - PROTOBUF_FIELD_OFFSET(SensorPacket, _impl_.imu_data_)>(
-          reinterpret_cast<char*>(&_impl_.imu_data_),
-          reinterpret_cast<char*>(&other->_impl_.imu_data_));
+      PROTOBUF_FIELD_OFFSET(SensorPacket, _impl_.lidar_mm_)
+      + sizeof(SensorPacket::_impl_.lidar_mm_)
+      - PROTOBUF_FIELD_OFFSET(SensorPacket, _impl_.imu_)>(
+          reinterpret_cast<char*>(&_impl_.imu_),
+          reinterpret_cast<char*>(&other->_impl_.imu_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SensorPacket::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
-      &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_getter, &descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto_once,
-      file_level_metadata_shared_2fproto_2fsensor_5fdata_2eproto[3]);
+      &descriptor_table_sensor_5fdata_2eproto_getter, &descriptor_table_sensor_5fdata_2eproto_once,
+      file_level_metadata_sensor_5fdata_2eproto[4]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::Vector3D*
-Arena::CreateMaybeMessage< ::Vector3D >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Vector3D >(arena);
+template<> PROTOBUF_NOINLINE ::ImuPayload*
+Arena::CreateMaybeMessage< ::ImuPayload >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ImuPayload >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RcPayload*
+Arena::CreateMaybeMessage< ::RcPayload >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RcPayload >(arena);
 }
-template<> PROTOBUF_NOINLINE ::ImuData*
-Arena::CreateMaybeMessage< ::ImuData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::ImuData >(arena);
+template<> PROTOBUF_NOINLINE ::ImuRecord*
+Arena::CreateMaybeMessage< ::ImuRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ImuRecord >(arena);
 }
-template<> PROTOBUF_NOINLINE ::AltimeterData*
-Arena::CreateMaybeMessage< ::AltimeterData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::AltimeterData >(arena);
+template<> PROTOBUF_NOINLINE ::RangeRecord*
+Arena::CreateMaybeMessage< ::RangeRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RangeRecord >(arena);
 }
 template<> PROTOBUF_NOINLINE ::SensorPacket*
 Arena::CreateMaybeMessage< ::SensorPacket >(Arena* arena) {
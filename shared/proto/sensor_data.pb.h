@@ -1,8 +1,8 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: shared/proto/sensor_data.proto
+// source: sensor_data.proto
 
-#ifndef GOOGLE_PROTOBUF_INCLUDED_shared_2fproto_2fsensor_5fdata_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_shared_2fproto_2fsensor_5fdata_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sensor_5fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sensor_5fdata_2eproto
 
 #include <limits>
 #include <string>
@@ -32,7 +32,7 @@
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_shared_2fproto_2fsensor_5fdata_2eproto
+#define PROTOBUF_INTERNAL_EXPORT_sensor_5fdata_2eproto
 PROTOBUF_NAMESPACE_OPEN
 namespace internal {
 class AnyMetadata;
@@ -40,49 +40,53 @@ class AnyMetadata;
 PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
-struct TableStruct_shared_2fproto_2fsensor_5fdata_2eproto {
+struct TableStruct_sensor_5fdata_2eproto {
   static const uint32_t offsets[];
 };
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_shared_2fproto_2fsensor_5fdata_2eproto;
-class AltimeterData;
-struct AltimeterDataDefaultTypeInternal;
-extern AltimeterDataDefaultTypeInternal _AltimeterData_default_instance_;
-class ImuData;
-struct ImuDataDefaultTypeInternal;
-extern ImuDataDefaultTypeInternal _ImuData_default_instance_;
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sensor_5fdata_2eproto;
+class ImuPayload;
+struct ImuPayloadDefaultTypeInternal;
+extern ImuPayloadDefaultTypeInternal _ImuPayload_default_instance_;
+class ImuRecord;
+struct ImuRecordDefaultTypeInternal;
+extern ImuRecordDefaultTypeInternal _ImuRecord_default_instance_;
+class RangeRecord;
+struct RangeRecordDefaultTypeInternal;
+extern RangeRecordDefaultTypeInternal _RangeRecord_default_instance_;
+class RcPayload;
+struct RcPayloadDefaultTypeInternal;
+extern RcPayloadDefaultTypeInternal _RcPayload_default_instance_;
 class SensorPacket;
 struct SensorPacketDefaultTypeInternal;
 extern SensorPacketDefaultTypeInternal _SensorPacket_default_instance_;
-class Vector3D;
-struct Vector3DDefaultTypeInternal;
-extern Vector3DDefaultTypeInternal _Vector3D_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
-template<> ::AltimeterData* Arena::CreateMaybeMessage<::AltimeterData>(Arena*);
-template<> ::ImuData* Arena::CreateMaybeMessage<::ImuData>(Arena*);
+template<> ::ImuPayload* Arena::CreateMaybeMessage<::ImuPayload>(Arena*);
+template<> ::ImuRecord* Arena::CreateMaybeMessage<::ImuRecord>(Arena*);
+template<> ::RangeRecord* Arena::CreateMaybeMessage<::RangeRecord>(Arena*);
+template<> ::RcPayload* Arena::CreateMaybeMessage<::RcPayload>(Arena*);
 template<> ::SensorPacket* Arena::CreateMaybeMessage<::SensorPacket>(Arena*);
-template<> ::Vector3D* Arena::CreateMaybeMessage<::Vector3D>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class Vector3D final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Vector3D) */ {
+class ImuPayload final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ImuPayload) */ {
  public:
-  inline Vector3D() : Vector3D(nullptr) {}
-  ~Vector3D() override;
-  explicit PROTOBUF_CONSTEXPR Vector3D(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ImuPayload() : ImuPayload(nullptr) {}
+  ~ImuPayload() override;
+  explicit PROTOBUF_CONSTEXPR ImuPayload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Vector3D(const Vector3D& from);
-  Vector3D(Vector3D&& from) noexcept
-    : Vector3D() {
+  ImuPayload(const ImuPayload& from);
+  ImuPayload(ImuPayload&& from) noexcept
+    : ImuPayload() {
     *this = ::std::move(from);
   }
 
-  inline Vector3D& operator=(const Vector3D& from) {
+  inline ImuPayload& operator=(const ImuPayload& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Vector3D& operator=(Vector3D&& from) noexcept {
+  inline ImuPayload& operator=(ImuPayload&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -105,20 +109,20 @@ class Vector3D final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Vector3D& default_instance() {
+  static const ImuPayload& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Vector3D* internal_default_instance() {
-    return reinterpret_cast<const Vector3D*>(
-               &_Vector3D_default_instance_);
+  static inline const ImuPayload* internal_default_instance() {
+    return reinterpret_cast<const ImuPayload*>(
+               &_ImuPayload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     0;
 
-  friend void swap(Vector3D& a, Vector3D& b) {
+  friend void swap(ImuPayload& a, ImuPayload& b) {
     a.Swap(&b);
   }
-  inline void Swap(Vector3D* other) {
+  inline void Swap(ImuPayload* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -131,7 +135,7 @@ class Vector3D final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Vector3D* other) {
+  void UnsafeArenaSwap(ImuPayload* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -139,14 +143,14 @@ class Vector3D final :
 
   // implements Message ----------------------------------------------
 
-  Vector3D* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Vector3D>(arena);
+  ImuPayload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ImuPayload>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Vector3D& from);
+  void CopyFrom(const ImuPayload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Vector3D& from) {
-    Vector3D::MergeImpl(*this, from);
+  void MergeFrom( const ImuPayload& from) {
+    ImuPayload::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -164,15 +168,15 @@ class Vector3D final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Vector3D* other);
+  void InternalSwap(ImuPayload* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Vector3D";
+    return "ImuPayload";
   }
   protected:
-  explicit Vector3D(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ImuPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -186,38 +190,98 @@ class Vector3D final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kXFieldNumber = 1,
-    kYFieldNumber = 2,
-    kZFieldNumber = 3,
+    kGyroXFieldNumber = 1,
+    kGyroYFieldNumber = 2,
+    kGyroZFieldNumber = 3,
+    kEulerXFieldNumber = 4,
+    kEulerYFieldNumber = 5,
+    kEulerZFieldNumber = 6,
+    kLinAccXFieldNumber = 7,
+    kLinAccYFieldNumber = 8,
+    kLinAccZFieldNumber = 9,
   };
-  // float x = 1;
-  void clear_x();
-  float x() const;
-  void set_x(float value);
+  // sint32 gyro_x = 1;
+  void clear_gyro_x();
+  int32_t gyro_x() const;
+  void set_gyro_x(int32_t value);
   private:
-  float _internal_x() const;
-  void _internal_set_x(float value);
+  int32_t _internal_gyro_x() const;
+  void _internal_set_gyro_x(int32_t value);
   public:
 
-  // float y = 2;
-  void clear_y();
-  float y() const;
-  void set_y(float value);
+  // sint32 gyro_y = 2;
+  void clear_gyro_y();
+  int32_t gyro_y() const;
+  void set_gyro_y(int32_t value);
   private:
-  float _internal_y() const;
-  void _internal_set_y(float value);
+  int32_t _internal_gyro_y() const;
+  void _internal_set_gyro_y(int32_t value);
   public:
 
-  // float z = 3;
-  void clear_z();
-  float z() const;
-  void set_z(float value);
+  // sint32 gyro_z = 3;
+  void clear_gyro_z();
+  int32_t gyro_z() const;
+  void set_gyro_z(int32_t value);
   private:
-  float _internal_z() const;
-  void _internal_set_z(float value);
+  int32_t _internal_gyro_z() const;
+  void _internal_set_gyro_z(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:Vector3D)
+  // sint32 euler_x = 4;
+  void clear_euler_x();
+  int32_t euler_x() const;
+  void set_euler_x(int32_t value);
+  private:
+  int32_t _internal_euler_x() const;
+  void _internal_set_euler_x(int32_t value);
+  public:
+
+  // sint32 euler_y = 5;
+  void clear_euler_y();
+  int32_t euler_y() const;
+  void set_euler_y(int32_t value);
+  private:
+  int32_t _internal_euler_y() const;
+  void _internal_set_euler_y(int32_t value);
+  public:
+
+  // sint32 euler_z = 6;
+  void clear_euler_z();
+  int32_t euler_z() const;
+  void set_euler_z(int32_t value);
+  private:
+  int32_t _internal_euler_z() const;
+  void _internal_set_euler_z(int32_t value);
+  public:
+
+  // sint32 lin_acc_x = 7;
+  void clear_lin_acc_x();
+  int32_t lin_acc_x() const;
+  void set_lin_acc_x(int32_t value);
+  private:
+  int32_t _internal_lin_acc_x() const;
+  void _internal_set_lin_acc_x(int32_t value);
+  public:
+
+  // sint32 lin_acc_y = 8;
+  void clear_lin_acc_y();
+  int32_t lin_acc_y() const;
+  void set_lin_acc_y(int32_t value);
+  private:
+  int32_t _internal_lin_acc_y() const;
+  void _internal_set_lin_acc_y(int32_t value);
+  public:
+
+  // sint32 lin_acc_z = 9;
+  void clear_lin_acc_z();
+  int32_t lin_acc_z() const;
+  void set_lin_acc_z(int32_t value);
+  private:
+  int32_t _internal_lin_acc_z() const;
+  void _internal_set_lin_acc_z(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ImuPayload)
  private:
   class _Internal;
 
@@ -225,34 +289,40 @@ class Vector3D final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    float x_;
-    float y_;
-    float z_;
+    int32_t gyro_x_;
+    int32_t gyro_y_;
+    int32_t gyro_z_;
+    int32_t euler_x_;
+    int32_t euler_y_;
+    int32_t euler_z_;
+    int32_t lin_acc_x_;
+    int32_t lin_acc_y_;
+    int32_t lin_acc_z_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
-  friend struct ::TableStruct_shared_2fproto_2fsensor_5fdata_2eproto;
+  friend struct ::TableStruct_sensor_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ImuData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ImuData) */ {
+class RcPayload final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RcPayload) */ {
  public:
-  inline ImuData() : ImuData(nullptr) {}
-  ~ImuData() override;
-  explicit PROTOBUF_CONSTEXPR ImuData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RcPayload() : RcPayload(nullptr) {}
+  ~RcPayload() override;
+  explicit PROTOBUF_CONSTEXPR RcPayload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ImuData(const ImuData& from);
-  ImuData(ImuData&& from) noexcept
-    : ImuData() {
+  RcPayload(const RcPayload& from);
+  RcPayload(RcPayload&& from) noexcept
+    : RcPayload() {
     *this = ::std::move(from);
   }
 
-  inline ImuData& operator=(const ImuData& from) {
+  inline RcPayload& operator=(const RcPayload& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ImuData& operator=(ImuData&& from) noexcept {
+  inline RcPayload& operator=(RcPayload&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -275,20 +345,20 @@ class ImuData final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ImuData& default_instance() {
+  static const RcPayload& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ImuData* internal_default_instance() {
-    return reinterpret_cast<const ImuData*>(
-               &_ImuData_default_instance_);
+  static inline const RcPayload* internal_default_instance() {
+    return reinterpret_cast<const RcPayload*>(
+               &_RcPayload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     1;
 
-  friend void swap(ImuData& a, ImuData& b) {
+  friend void swap(RcPayload& a, RcPayload& b) {
     a.Swap(&b);
   }
-  inline void Swap(ImuData* other) {
+  inline void Swap(RcPayload* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -301,7 +371,7 @@ class ImuData final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ImuData* other) {
+  void UnsafeArenaSwap(RcPayload* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -309,14 +379,14 @@ class ImuData final :
 
   // implements Message ----------------------------------------------
 
-  ImuData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ImuData>(arena);
+  RcPayload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RcPayload>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ImuData& from);
+  void CopyFrom(const RcPayload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ImuData& from) {
-    ImuData::MergeImpl(*this, from);
+  void MergeFrom( const RcPayload& from) {
+    RcPayload::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -334,15 +404,15 @@ class ImuData final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ImuData* other);
+  void InternalSwap(RcPayload* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ImuData";
+    return "RcPayload";
   }
   protected:
-  explicit ImuData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RcPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -356,46 +426,28 @@ class ImuData final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAccelerationFieldNumber = 1,
-    kAngularVelocityFieldNumber = 2,
+    kVerticalFieldNumber = 1,
+    kHorizontalFieldNumber = 2,
   };
-  // .Vector3D acceleration = 1;
-  bool has_acceleration() const;
-  private:
-  bool _internal_has_acceleration() const;
-  public:
-  void clear_acceleration();
-  const ::Vector3D& acceleration() const;
-  PROTOBUF_NODISCARD ::Vector3D* release_acceleration();
-  ::Vector3D* mutable_acceleration();
-  void set_allocated_acceleration(::Vector3D* acceleration);
+  // sint32 vertical = 1;
+  void clear_vertical();
+  int32_t vertical() const;
+  void set_vertical(int32_t value);
   private:
-  const ::Vector3D& _internal_acceleration() const;
-  ::Vector3D* _internal_mutable_acceleration();
+  int32_t _internal_vertical() const;
+  void _internal_set_vertical(int32_t value);
   public:
-  void unsafe_arena_set_allocated_acceleration(
-      ::Vector3D* acceleration);
-  ::Vector3D* unsafe_arena_release_acceleration();
 
-  // .Vector3D angular_velocity = 2;
-  bool has_angular_velocity() const;
-  private:
-  bool _internal_has_angular_velocity() const;
-  public:
-  void clear_angular_velocity();
-  const ::Vector3D& angular_velocity() const;
-  PROTOBUF_NODISCARD ::Vector3D* release_angular_velocity();
-  ::Vector3D* mutable_angular_velocity();
-  void set_allocated_angular_velocity(::Vector3D* angular_velocity);
+  // sint32 horizontal = 2;
+  void clear_horizontal();
+  int32_t horizontal() const;
+  void set_horizontal(int32_t value);
   private:
-  const ::Vector3D& _internal_angular_velocity() const;
-  ::Vector3D* _internal_mutable_angular_velocity();
+  int32_t _internal_horizontal() const;
+  void _internal_set_horizontal(int32_t value);
   public:
-  void unsafe_arena_set_allocated_angular_velocity(
-      ::Vector3D* angular_velocity);
-  ::Vector3D* unsafe_arena_release_angular_velocity();
 
-  // @@protoc_insertion_point(class_scope:ImuData)
+  // @@protoc_insertion_point(class_scope:RcPayload)
  private:
   class _Internal;
 
@@ -403,33 +455,33 @@ class ImuData final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::Vector3D* acceleration_;
-    ::Vector3D* angular_velocity_;
+    int32_t vertical_;
+    int32_t horizontal_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
-  friend struct ::TableStruct_shared_2fproto_2fsensor_5fdata_2eproto;
+  friend struct ::TableStruct_sensor_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AltimeterData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:AltimeterData) */ {
+class ImuRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ImuRecord) */ {
  public:
-  inline AltimeterData() : AltimeterData(nullptr) {}
-  ~AltimeterData() override;
-  explicit PROTOBUF_CONSTEXPR AltimeterData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ImuRecord() : ImuRecord(nullptr) {}
+  ~ImuRecord() override;
+  explicit PROTOBUF_CONSTEXPR ImuRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AltimeterData(const AltimeterData& from);
-  AltimeterData(AltimeterData&& from) noexcept
-    : AltimeterData() {
+  ImuRecord(const ImuRecord& from);
+  ImuRecord(ImuRecord&& from) noexcept
+    : ImuRecord() {
     *this = ::std::move(from);
   }
 
-  inline AltimeterData& operator=(const AltimeterData& from) {
+  inline ImuRecord& operator=(const ImuRecord& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AltimeterData& operator=(AltimeterData&& from) noexcept {
+  inline ImuRecord& operator=(ImuRecord&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -452,20 +504,20 @@ class AltimeterData final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AltimeterData& default_instance() {
+  static const ImuRecord& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AltimeterData* internal_default_instance() {
-    return reinterpret_cast<const AltimeterData*>(
-               &_AltimeterData_default_instance_);
+  static inline const ImuRecord* internal_default_instance() {
+    return reinterpret_cast<const ImuRecord*>(
+               &_ImuRecord_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(AltimeterData& a, AltimeterData& b) {
+  friend void swap(ImuRecord& a, ImuRecord& b) {
     a.Swap(&b);
   }
-  inline void Swap(AltimeterData* other) {
+  inline void Swap(ImuRecord* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -478,7 +530,7 @@ class AltimeterData final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AltimeterData* other) {
+  void UnsafeArenaSwap(ImuRecord* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -486,14 +538,14 @@ class AltimeterData final :
 
   // implements Message ----------------------------------------------
 
-  AltimeterData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AltimeterData>(arena);
+  ImuRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ImuRecord>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const AltimeterData& from);
+  void CopyFrom(const ImuRecord& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const AltimeterData& from) {
-    AltimeterData::MergeImpl(*this, from);
+  void MergeFrom( const ImuRecord& from) {
+    ImuRecord::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -511,15 +563,15 @@ class AltimeterData final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AltimeterData* other);
+  void InternalSwap(ImuRecord* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "AltimeterData";
+    return "ImuRecord";
   }
   protected:
-  explicit AltimeterData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ImuRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -533,38 +585,196 @@ class AltimeterData final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPressureFieldNumber = 1,
-    kAltitudeFieldNumber = 2,
-    kTemperatureFieldNumber = 3,
+    kImuFieldNumber = 2,
+    kInstanceFieldNumber = 1,
   };
-  // float pressure = 1;
-  void clear_pressure();
-  float pressure() const;
-  void set_pressure(float value);
+  // .ImuPayload imu = 2;
+  bool has_imu() const;
+  private:
+  bool _internal_has_imu() const;
+  public:
+  void clear_imu();
+  const ::ImuPayload& imu() const;
+  PROTOBUF_NODISCARD ::ImuPayload* release_imu();
+  ::ImuPayload* mutable_imu();
+  void set_allocated_imu(::ImuPayload* imu);
+  private:
+  const ::ImuPayload& _internal_imu() const;
+  ::ImuPayload* _internal_mutable_imu();
+  public:
+  void unsafe_arena_set_allocated_imu(
+      ::ImuPayload* imu);
+  ::ImuPayload* unsafe_arena_release_imu();
+
+  // uint32 instance = 1;
+  void clear_instance();
+  uint32_t instance() const;
+  void set_instance(uint32_t value);
   private:
-  float _internal_pressure() const;
-  void _internal_set_pressure(float value);
+  uint32_t _internal_instance() const;
+  void _internal_set_instance(uint32_t value);
   public:
 
-  // float altitude = 2;
-  void clear_altitude();
-  float altitude() const;
-  void set_altitude(float value);
+  // @@protoc_insertion_point(class_scope:ImuRecord)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ImuPayload* imu_;
+    uint32_t instance_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sensor_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RangeRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RangeRecord) */ {
+ public:
+  inline RangeRecord() : RangeRecord(nullptr) {}
+  ~RangeRecord() override;
+  explicit PROTOBUF_CONSTEXPR RangeRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RangeRecord(const RangeRecord& from);
+  RangeRecord(RangeRecord&& from) noexcept
+    : RangeRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline RangeRecord& operator=(const RangeRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RangeRecord& operator=(RangeRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RangeRecord* internal_default_instance() {
+    return reinterpret_cast<const RangeRecord*>(
+               &_RangeRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RangeRecord& a, RangeRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RangeRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RangeRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RangeRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RangeRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeRecord& from) {
+    RangeRecord::MergeImpl(*this, from);
+  }
   private:
-  float _internal_altitude() const;
-  void _internal_set_altitude(float value);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // float temperature = 3;
-  void clear_temperature();
-  float temperature() const;
-  void set_temperature(float value);
   private:
-  float _internal_temperature() const;
-  void _internal_set_temperature(float value);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RangeRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RangeRecord";
+  }
+  protected:
+  explicit RangeRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInstanceFieldNumber = 1,
+    kDistanceMmFieldNumber = 2,
+  };
+  // uint32 instance = 1;
+  void clear_instance();
+  uint32_t instance() const;
+  void set_instance(uint32_t value);
+  private:
+  uint32_t _internal_instance() const;
+  void _internal_set_instance(uint32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:AltimeterData)
+  // uint32 distance_mm = 2;
+  void clear_distance_mm();
+  uint32_t distance_mm() const;
+  void set_distance_mm(uint32_t value);
+  private:
+  uint32_t _internal_distance_mm() const;
+  void _internal_set_distance_mm(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RangeRecord)
  private:
   class _Internal;
 
@@ -572,13 +782,12 @@ class AltimeterData final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    float pressure_;
-    float altitude_;
-    float temperature_;
+    uint32_t instance_;
+    uint32_t distance_mm_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
-  friend struct ::TableStruct_shared_2fproto_2fsensor_5fdata_2eproto;
+  friend struct ::TableStruct_sensor_5fdata_2eproto;
 };
 // -------------------------------------------------------------------
 
@@ -630,7 +839,7 @@ class SensorPacket final :
                &_SensorPacket_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(SensorPacket& a, SensorPacket& b) {
     a.Swap(&b);
@@ -703,53 +912,101 @@ class SensorPacket final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kImuDataFieldNumber = 2,
-    kAltimeterDataFieldNumber = 3,
-    kTimestampFieldNumber = 1,
+    kImusFieldNumber = 5,
+    kRangesFieldNumber = 6,
+    kImuFieldNumber = 3,
+    kRcFieldNumber = 4,
+    kTimestampUsFieldNumber = 1,
+    kLidarMmFieldNumber = 2,
   };
-  // .ImuData imu_data = 2;
-  bool has_imu_data() const;
+  // repeated .ImuRecord imus = 5;
+  int imus_size() const;
+  private:
+  int _internal_imus_size() const;
+  public:
+  void clear_imus();
+  ::ImuRecord* mutable_imus(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ImuRecord >*
+      mutable_imus();
+  private:
+  const ::ImuRecord& _internal_imus(int index) const;
+  ::ImuRecord* _internal_add_imus();
+  public:
+  const ::ImuRecord& imus(int index) const;
+  ::ImuRecord* add_imus();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ImuRecord >&
+      imus() const;
+
+  // repeated .RangeRecord ranges = 6;
+  int ranges_size() const;
   private:
-  bool _internal_has_imu_data() const;
+  int _internal_ranges_size() const;
   public:
-  void clear_imu_data();
-  const ::ImuData& imu_data() const;
-  PROTOBUF_NODISCARD ::ImuData* release_imu_data();
-  ::ImuData* mutable_imu_data();
-  void set_allocated_imu_data(::ImuData* imu_data);
+  void clear_ranges();
+  ::RangeRecord* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RangeRecord >*
+      mutable_ranges();
   private:
-  const ::ImuData& _internal_imu_data() const;
-  ::ImuData* _internal_mutable_imu_data();
+  const ::RangeRecord& _internal_ranges(int index) const;
+  ::RangeRecord* _internal_add_ranges();
   public:
-  void unsafe_arena_set_allocated_imu_data(
-      ::ImuData* imu_data);
-  ::ImuData* unsafe_arena_release_imu_data();
+  const ::RangeRecord& ranges(int index) const;
+  ::RangeRecord* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RangeRecord >&
+      ranges() const;
 
-  // .AltimeterData altimeter_data = 3;
-  bool has_altimeter_data() const;
+  // .ImuPayload imu = 3;
+  bool has_imu() const;
   private:
-  bool _internal_has_altimeter_data() const;
+  bool _internal_has_imu() const;
   public:
-  void clear_altimeter_data();
-  const ::AltimeterData& altimeter_data() const;
-  PROTOBUF_NODISCARD ::AltimeterData* release_altimeter_data();
-  ::AltimeterData* mutable_altimeter_data();
-  void set_allocated_altimeter_data(::AltimeterData* altimeter_data);
+  void clear_imu();
+  const ::ImuPayload& imu() const;
+  PROTOBUF_NODISCARD ::ImuPayload* release_imu();
+  ::ImuPayload* mutable_imu();
+  void set_allocated_imu(::ImuPayload* imu);
   private:
-  const ::AltimeterData& _internal_altimeter_data() const;
-  ::AltimeterData* _internal_mutable_altimeter_data();
+  const ::ImuPayload& _internal_imu() const;
+  ::ImuPayload* _internal_mutable_imu();
   public:
-  void unsafe_arena_set_allocated_altimeter_data(
-      ::AltimeterData* altimeter_data);
-  ::AltimeterData* unsafe_arena_release_altimeter_data();
-
-  // uint32 timestamp = 1;
-  void clear_timestamp();
-  uint32_t timestamp() const;
-  void set_timestamp(uint32_t value);
+  void unsafe_arena_set_allocated_imu(
+      ::ImuPayload* imu);
+  ::ImuPayload* unsafe_arena_release_imu();
+
+  // .RcPayload rc = 4;
+  bool has_rc() const;
+  private:
+  bool _internal_has_rc() const;
+  public:
+  void clear_rc();
+  const ::RcPayload& rc() const;
+  PROTOBUF_NODISCARD ::RcPayload* release_rc();
+  ::RcPayload* mutable_rc();
+  void set_allocated_rc(::RcPayload* rc);
+  private:
+  const ::RcPayload& _internal_rc() const;
+  ::RcPayload* _internal_mutable_rc();
+  public:
+  void unsafe_arena_set_allocated_rc(
+      ::RcPayload* rc);
+  ::RcPayload* unsafe_arena_release_rc();
+
+  // uint32 timestamp_us = 1;
+  void clear_timestamp_us();
+  uint32_t timestamp_us() const;
+  void set_timestamp_us(uint32_t value);
+  private:
+  uint32_t _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(uint32_t value);
+  public:
+
+  // uint32 lidar_mm = 2;
+  void clear_lidar_mm();
+  uint32_t lidar_mm() const;
+  void set_lidar_mm(uint32_t value);
   private:
-  uint32_t _internal_timestamp() const;
-  void _internal_set_timestamp(uint32_t value);
+  uint32_t _internal_lidar_mm() const;
+  void _internal_set_lidar_mm(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:SensorPacket)
@@ -760,13 +1017,16 @@ class SensorPacket final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::ImuData* imu_data_;
-    ::AltimeterData* altimeter_data_;
-    uint32_t timestamp_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ImuRecord > imus_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RangeRecord > ranges_;
+    ::ImuPayload* imu_;
+    ::RcPayload* rc_;
+    uint32_t timestamp_us_;
+    uint32_t lidar_mm_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
-  friend struct ::TableStruct_shared_2fproto_2fsensor_5fdata_2eproto;
+  friend struct ::TableStruct_sensor_5fdata_2eproto;
 };
 // ===================================================================
 
@@ -777,201 +1037,295 @@ class SensorPacket final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
-// Vector3D
+// ImuPayload
 
-// float x = 1;
-inline void Vector3D::clear_x() {
-  _impl_.x_ = 0;
+// sint32 gyro_x = 1;
+inline void ImuPayload::clear_gyro_x() {
+  _impl_.gyro_x_ = 0;
 }
-inline float Vector3D::_internal_x() const {
-  return _impl_.x_;
+inline int32_t ImuPayload::_internal_gyro_x() const {
+  return _impl_.gyro_x_;
 }
-inline float Vector3D::x() const {
-  // @@protoc_insertion_point(field_get:Vector3D.x)
-  return _internal_x();
+inline int32_t ImuPayload::gyro_x() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.gyro_x)
+  return _internal_gyro_x();
 }
-inline void Vector3D::_internal_set_x(float value) {
+inline void ImuPayload::_internal_set_gyro_x(int32_t value) {
   
-  _impl_.x_ = value;
+  _impl_.gyro_x_ = value;
 }
-inline void Vector3D::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:Vector3D.x)
+inline void ImuPayload::set_gyro_x(int32_t value) {
+  _internal_set_gyro_x(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.gyro_x)
 }
 
-// float y = 2;
-inline void Vector3D::clear_y() {
-  _impl_.y_ = 0;
+// sint32 gyro_y = 2;
+inline void ImuPayload::clear_gyro_y() {
+  _impl_.gyro_y_ = 0;
 }
-inline float Vector3D::_internal_y() const {
-  return _impl_.y_;
+inline int32_t ImuPayload::_internal_gyro_y() const {
+  return _impl_.gyro_y_;
 }
-inline float Vector3D::y() const {
-  // @@protoc_insertion_point(field_get:Vector3D.y)
-  return _internal_y();
+inline int32_t ImuPayload::gyro_y() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.gyro_y)
+  return _internal_gyro_y();
 }
-inline void Vector3D::_internal_set_y(float value) {
+inline void ImuPayload::_internal_set_gyro_y(int32_t value) {
   
-  _impl_.y_ = value;
+  _impl_.gyro_y_ = value;
 }
-inline void Vector3D::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:Vector3D.y)
+inline void ImuPayload::set_gyro_y(int32_t value) {
+  _internal_set_gyro_y(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.gyro_y)
 }
 
-// float z = 3;
-inline void Vector3D::clear_z() {
-  _impl_.z_ = 0;
+// sint32 gyro_z = 3;
+inline void ImuPayload::clear_gyro_z() {
+  _impl_.gyro_z_ = 0;
 }
-inline float Vector3D::_internal_z() const {
-  return _impl_.z_;
+inline int32_t ImuPayload::_internal_gyro_z() const {
+  return _impl_.gyro_z_;
 }
-inline float Vector3D::z() const {
-  // @@protoc_insertion_point(field_get:Vector3D.z)
-  return _internal_z();
+inline int32_t ImuPayload::gyro_z() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.gyro_z)
+  return _internal_gyro_z();
 }
-inline void Vector3D::_internal_set_z(float value) {
+inline void ImuPayload::_internal_set_gyro_z(int32_t value) {
   
-  _impl_.z_ = value;
+  _impl_.gyro_z_ = value;
 }
-inline void Vector3D::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:Vector3D.z)
+inline void ImuPayload::set_gyro_z(int32_t value) {
+  _internal_set_gyro_z(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.gyro_z)
 }
 
-// -------------------------------------------------------------------
+// sint32 euler_x = 4;
+inline void ImuPayload::clear_euler_x() {
+  _impl_.euler_x_ = 0;
+}
+inline int32_t ImuPayload::_internal_euler_x() const {
+  return _impl_.euler_x_;
+}
+inline int32_t ImuPayload::euler_x() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.euler_x)
+  return _internal_euler_x();
+}
+inline void ImuPayload::_internal_set_euler_x(int32_t value) {
+  
+  _impl_.euler_x_ = value;
+}
+inline void ImuPayload::set_euler_x(int32_t value) {
+  _internal_set_euler_x(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.euler_x)
+}
 
-// ImuData
+// sint32 euler_y = 5;
+inline void ImuPayload::clear_euler_y() {
+  _impl_.euler_y_ = 0;
+}
+inline int32_t ImuPayload::_internal_euler_y() const {
+  return _impl_.euler_y_;
+}
+inline int32_t ImuPayload::euler_y() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.euler_y)
+  return _internal_euler_y();
+}
+inline void ImuPayload::_internal_set_euler_y(int32_t value) {
+  
+  _impl_.euler_y_ = value;
+}
+inline void ImuPayload::set_euler_y(int32_t value) {
+  _internal_set_euler_y(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.euler_y)
+}
 
-// .Vector3D acceleration = 1;
-inline bool ImuData::_internal_has_acceleration() const {
-  return this != internal_default_instance() && _impl_.acceleration_ != nullptr;
+// sint32 euler_z = 6;
+inline void ImuPayload::clear_euler_z() {
+  _impl_.euler_z_ = 0;
 }
-inline bool ImuData::has_acceleration() const {
-  return _internal_has_acceleration();
+inline int32_t ImuPayload::_internal_euler_z() const {
+  return _impl_.euler_z_;
 }
-inline void ImuData::clear_acceleration() {
-  if (GetArenaForAllocation() == nullptr && _impl_.acceleration_ != nullptr) {
-    delete _impl_.acceleration_;
-  }
-  _impl_.acceleration_ = nullptr;
+inline int32_t ImuPayload::euler_z() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.euler_z)
+  return _internal_euler_z();
 }
-inline const ::Vector3D& ImuData::_internal_acceleration() const {
-  const ::Vector3D* p = _impl_.acceleration_;
-  return p != nullptr ? *p : reinterpret_cast<const ::Vector3D&>(
-      ::_Vector3D_default_instance_);
+inline void ImuPayload::_internal_set_euler_z(int32_t value) {
+  
+  _impl_.euler_z_ = value;
 }
-inline const ::Vector3D& ImuData::acceleration() const {
-  // @@protoc_insertion_point(field_get:ImuData.acceleration)
-  return _internal_acceleration();
+inline void ImuPayload::set_euler_z(int32_t value) {
+  _internal_set_euler_z(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.euler_z)
 }
-inline void ImuData::unsafe_arena_set_allocated_acceleration(
-    ::Vector3D* acceleration) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acceleration_);
-  }
-  _impl_.acceleration_ = acceleration;
-  if (acceleration) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ImuData.acceleration)
+
+// sint32 lin_acc_x = 7;
+inline void ImuPayload::clear_lin_acc_x() {
+  _impl_.lin_acc_x_ = 0;
+}
+inline int32_t ImuPayload::_internal_lin_acc_x() const {
+  return _impl_.lin_acc_x_;
 }
-inline ::Vector3D* ImuData::release_acceleration() {
+inline int32_t ImuPayload::lin_acc_x() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.lin_acc_x)
+  return _internal_lin_acc_x();
+}
+inline void ImuPayload::_internal_set_lin_acc_x(int32_t value) {
   
-  ::Vector3D* temp = _impl_.acceleration_;
-  _impl_.acceleration_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.lin_acc_x_ = value;
+}
+inline void ImuPayload::set_lin_acc_x(int32_t value) {
+  _internal_set_lin_acc_x(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.lin_acc_x)
+}
+
+// sint32 lin_acc_y = 8;
+inline void ImuPayload::clear_lin_acc_y() {
+  _impl_.lin_acc_y_ = 0;
 }
-inline ::Vector3D* ImuData::unsafe_arena_release_acceleration() {
-  // @@protoc_insertion_point(field_release:ImuData.acceleration)
+inline int32_t ImuPayload::_internal_lin_acc_y() const {
+  return _impl_.lin_acc_y_;
+}
+inline int32_t ImuPayload::lin_acc_y() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.lin_acc_y)
+  return _internal_lin_acc_y();
+}
+inline void ImuPayload::_internal_set_lin_acc_y(int32_t value) {
   
-  ::Vector3D* temp = _impl_.acceleration_;
-  _impl_.acceleration_ = nullptr;
-  return temp;
+  _impl_.lin_acc_y_ = value;
+}
+inline void ImuPayload::set_lin_acc_y(int32_t value) {
+  _internal_set_lin_acc_y(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.lin_acc_y)
 }
-inline ::Vector3D* ImuData::_internal_mutable_acceleration() {
+
+// sint32 lin_acc_z = 9;
+inline void ImuPayload::clear_lin_acc_z() {
+  _impl_.lin_acc_z_ = 0;
+}
+inline int32_t ImuPayload::_internal_lin_acc_z() const {
+  return _impl_.lin_acc_z_;
+}
+inline int32_t ImuPayload::lin_acc_z() const {
+  // @@protoc_insertion_point(field_get:ImuPayload.lin_acc_z)
+  return _internal_lin_acc_z();
+}
+inline void ImuPayload::_internal_set_lin_acc_z(int32_t value) {
   
-  if (_impl_.acceleration_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Vector3D>(GetArenaForAllocation());
-    _impl_.acceleration_ = p;
-  }
-  return _impl_.acceleration_;
+  _impl_.lin_acc_z_ = value;
 }
-inline ::Vector3D* ImuData::mutable_acceleration() {
-  ::Vector3D* _msg = _internal_mutable_acceleration();
-  // @@protoc_insertion_point(field_mutable:ImuData.acceleration)
-  return _msg;
+inline void ImuPayload::set_lin_acc_z(int32_t value) {
+  _internal_set_lin_acc_z(value);
+  // @@protoc_insertion_point(field_set:ImuPayload.lin_acc_z)
 }
-inline void ImuData::set_allocated_acceleration(::Vector3D* acceleration) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.acceleration_;
-  }
-  if (acceleration) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acceleration);
-    if (message_arena != submessage_arena) {
-      acceleration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, acceleration, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.acceleration_ = acceleration;
-  // @@protoc_insertion_point(field_set_allocated:ImuData.acceleration)
+
+// -------------------------------------------------------------------
+
+// RcPayload
+
+// sint32 vertical = 1;
+inline void RcPayload::clear_vertical() {
+  _impl_.vertical_ = 0;
+}
+inline int32_t RcPayload::_internal_vertical() const {
+  return _impl_.vertical_;
+}
+inline int32_t RcPayload::vertical() const {
+  // @@protoc_insertion_point(field_get:RcPayload.vertical)
+  return _internal_vertical();
+}
+inline void RcPayload::_internal_set_vertical(int32_t value) {
+  
+  _impl_.vertical_ = value;
+}
+inline void RcPayload::set_vertical(int32_t value) {
+  _internal_set_vertical(value);
+  // @@protoc_insertion_point(field_set:RcPayload.vertical)
+}
+
+// sint32 horizontal = 2;
+inline void RcPayload::clear_horizontal() {
+  _impl_.horizontal_ = 0;
+}
+inline int32_t RcPayload::_internal_horizontal() const {
+  return _impl_.horizontal_;
+}
+inline int32_t RcPayload::horizontal() const {
+  // @@protoc_insertion_point(field_get:RcPayload.horizontal)
+  return _internal_horizontal();
+}
+inline void RcPayload::_internal_set_horizontal(int32_t value) {
+  
+  _impl_.horizontal_ = value;
+}
+inline void RcPayload::set_horizontal(int32_t value) {
+  _internal_set_horizontal(value);
+  // @@protoc_insertion_point(field_set:RcPayload.horizontal)
+}
+
+// -------------------------------------------------------------------
+
+// ImuRecord
+
+// uint32 instance = 1;
+inline void ImuRecord::clear_instance() {
+  _impl_.instance_ = 0u;
+}
+inline uint32_t ImuRecord::_internal_instance() const {
+  return _impl_.instance_;
+}
+inline uint32_t ImuRecord::instance() const {
+  // @@protoc_insertion_point(field_get:ImuRecord.instance)
+  return _internal_instance();
+}
+inline void ImuRecord::_internal_set_instance(uint32_t value) {
+  
+  _impl_.instance_ = value;
+}
+inline void ImuRecord::set_instance(uint32_t value) {
+  _internal_set_instance(value);
+  // @@protoc_insertion_point(field_set:ImuRecord.instance)
 }
 
-// .Vector3D angular_velocity = 2;
-inline bool ImuData::_internal_has_angular_velocity() const {
-  return this != internal_default_instance() && _impl_.angular_velocity_ != nullptr;
+// .ImuPayload imu = 2;
+inline bool ImuRecord::_internal_has_imu() const {
+  return this != internal_default_instance() && _impl_.imu_ != nullptr;
 }
-inline bool ImuData::has_angular_velocity() const {
-  return _internal_has_angular_velocity();
+inline bool ImuRecord::has_imu() const {
+  return _internal_has_imu();
 }
-inline void ImuData::clear_angular_velocity() {
-  if (GetArenaForAllocation() == nullptr && _impl_.angular_velocity_ != nullptr) {
-    delete _impl_.angular_velocity_;
+inline void ImuRecord::clear_imu() {
+  if (GetArenaForAllocation() == nullptr && _impl_.imu_ != nullptr) {
+    delete _impl_.imu_;
   }
-  _impl_.angular_velocity_ = nullptr;
+  _impl_.imu_ = nullptr;
 }
-inline const ::Vector3D& ImuData::_internal_angular_velocity() const {
-  const ::Vector3D* p = _impl_.angular_velocity_;
-  return p != nullptr ? *p : reinterpret_cast<const ::Vector3D&>(
-      ::_Vector3D_default_instance_);
+inline const ::ImuPayload& ImuRecord::_internal_imu() const {
+  const ::ImuPayload* p = _impl_.imu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ImuPayload&>(
+      ::_ImuPayload_default_instance_);
 }
-inline const ::Vector3D& ImuData::angular_velocity() const {
-  // @@protoc_insertion_point(field_get:ImuData.angular_velocity)
-  return _internal_angular_velocity();
+inline const ::ImuPayload& ImuRecord::imu() const {
+  // @@protoc_insertion_point(field_get:ImuRecord.imu)
+  return _internal_imu();
 }
-inline void ImuData::unsafe_arena_set_allocated_angular_velocity(
-    ::Vector3D* angular_velocity) {
+inline void ImuRecord::unsafe_arena_set_allocated_imu(
+    ::ImuPayload* imu) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angular_velocity_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.imu_);
   }
-  _impl_.angular_velocity_ = angular_velocity;
-  if (angular_velocity) {
+  _impl_.imu_ = imu;
+  if (imu) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ImuData.angular_velocity)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ImuRecord.imu)
 }
-inline ::Vector3D* ImuData::release_angular_velocity() {
+inline ::ImuPayload* ImuRecord::release_imu() {
   
-  ::Vector3D* temp = _impl_.angular_velocity_;
-  _impl_.angular_velocity_ = nullptr;
+  ::ImuPayload* temp = _impl_.imu_;
+  _impl_.imu_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -983,173 +1337,173 @@ inline ::Vector3D* ImuData::release_angular_velocity() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::Vector3D* ImuData::unsafe_arena_release_angular_velocity() {
-  // @@protoc_insertion_point(field_release:ImuData.angular_velocity)
+inline ::ImuPayload* ImuRecord::unsafe_arena_release_imu() {
+  // @@protoc_insertion_point(field_release:ImuRecord.imu)
   
-  ::Vector3D* temp = _impl_.angular_velocity_;
-  _impl_.angular_velocity_ = nullptr;
+  ::ImuPayload* temp = _impl_.imu_;
+  _impl_.imu_ = nullptr;
   return temp;
 }
-inline ::Vector3D* ImuData::_internal_mutable_angular_velocity() {
+inline ::ImuPayload* ImuRecord::_internal_mutable_imu() {
   
-  if (_impl_.angular_velocity_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Vector3D>(GetArenaForAllocation());
-    _impl_.angular_velocity_ = p;
+  if (_impl_.imu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ImuPayload>(GetArenaForAllocation());
+    _impl_.imu_ = p;
   }
-  return _impl_.angular_velocity_;
+  return _impl_.imu_;
 }
-inline ::Vector3D* ImuData::mutable_angular_velocity() {
-  ::Vector3D* _msg = _internal_mutable_angular_velocity();
-  // @@protoc_insertion_point(field_mutable:ImuData.angular_velocity)
+inline ::ImuPayload* ImuRecord::mutable_imu() {
+  ::ImuPayload* _msg = _internal_mutable_imu();
+  // @@protoc_insertion_point(field_mutable:ImuRecord.imu)
   return _msg;
 }
-inline void ImuData::set_allocated_angular_velocity(::Vector3D* angular_velocity) {
+inline void ImuRecord::set_allocated_imu(::ImuPayload* imu) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.angular_velocity_;
+    delete _impl_.imu_;
   }
-  if (angular_velocity) {
+  if (imu) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(angular_velocity);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(imu);
     if (message_arena != submessage_arena) {
-      angular_velocity = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, angular_velocity, submessage_arena);
+      imu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, imu, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.angular_velocity_ = angular_velocity;
-  // @@protoc_insertion_point(field_set_allocated:ImuData.angular_velocity)
+  _impl_.imu_ = imu;
+  // @@protoc_insertion_point(field_set_allocated:ImuRecord.imu)
 }
 
 // -------------------------------------------------------------------
 
-// AltimeterData
+// RangeRecord
 
-// float pressure = 1;
-inline void AltimeterData::clear_pressure() {
-  _impl_.pressure_ = 0;
+// uint32 instance = 1;
+inline void RangeRecord::clear_instance() {
+  _impl_.instance_ = 0u;
 }
-inline float AltimeterData::_internal_pressure() const {
-  return _impl_.pressure_;
+inline uint32_t RangeRecord::_internal_instance() const {
+  return _impl_.instance_;
 }
-inline float AltimeterData::pressure() const {
-  // @@protoc_insertion_point(field_get:AltimeterData.pressure)
-  return _internal_pressure();
+inline uint32_t RangeRecord::instance() const {
+  // @@protoc_insertion_point(field_get:RangeRecord.instance)
+  return _internal_instance();
 }
-inline void AltimeterData::_internal_set_pressure(float value) {
+inline void RangeRecord::_internal_set_instance(uint32_t value) {
   
-  _impl_.pressure_ = value;
+  _impl_.instance_ = value;
 }
-inline void AltimeterData::set_pressure(float value) {
-  _internal_set_pressure(value);
-  // @@protoc_insertion_point(field_set:AltimeterData.pressure)
+inline void RangeRecord::set_instance(uint32_t value) {
+  _internal_set_instance(value);
+  // @@protoc_insertion_point(field_set:RangeRecord.instance)
 }
 
-// float altitude = 2;
-inline void AltimeterData::clear_altitude() {
-  _impl_.altitude_ = 0;
+// uint32 distance_mm = 2;
+inline void RangeRecord::clear_distance_mm() {
+  _impl_.distance_mm_ = 0u;
 }
-inline float AltimeterData::_internal_altitude() const {
-  return _impl_.altitude_;
+inline uint32_t RangeRecord::_internal_distance_mm() const {
+  return _impl_.distance_mm_;
 }
-inline float AltimeterData::altitude() const {
-  // @@protoc_insertion_point(field_get:AltimeterData.altitude)
-  return _internal_altitude();
+inline uint32_t RangeRecord::distance_mm() const {
+  // @@protoc_insertion_point(field_get:RangeRecord.distance_mm)
+  return _internal_distance_mm();
 }
-inline void AltimeterData::_internal_set_altitude(float value) {
+inline void RangeRecord::_internal_set_distance_mm(uint32_t value) {
   
-  _impl_.altitude_ = value;
+  _impl_.distance_mm_ = value;
 }
-inline void AltimeterData::set_altitude(float value) {
-  _internal_set_altitude(value);
-  // @@protoc_insertion_point(field_set:AltimeterData.altitude)
+inline void RangeRecord::set_distance_mm(uint32_t value) {
+  _internal_set_distance_mm(value);
+  // @@protoc_insertion_point(field_set:RangeRecord.distance_mm)
 }
 
-// float temperature = 3;
-inline void AltimeterData::clear_temperature() {
-  _impl_.temperature_ = 0;
+// -------------------------------------------------------------------
+
+// SensorPacket
+
+// uint32 timestamp_us = 1;
+inline void SensorPacket::clear_timestamp_us() {
+  _impl_.timestamp_us_ = 0u;
 }
-inline float AltimeterData::_internal_temperature() const {
-  return _impl_.temperature_;
+inline uint32_t SensorPacket::_internal_timestamp_us() const {
+  return _impl_.timestamp_us_;
 }
-inline float AltimeterData::temperature() const {
-  // @@protoc_insertion_point(field_get:AltimeterData.temperature)
-  return _internal_temperature();
+inline uint32_t SensorPacket::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:SensorPacket.timestamp_us)
+  return _internal_timestamp_us();
 }
-inline void AltimeterData::_internal_set_temperature(float value) {
+inline void SensorPacket::_internal_set_timestamp_us(uint32_t value) {
   
-  _impl_.temperature_ = value;
+  _impl_.timestamp_us_ = value;
 }
-inline void AltimeterData::set_temperature(float value) {
-  _internal_set_temperature(value);
-  // @@protoc_insertion_point(field_set:AltimeterData.temperature)
+inline void SensorPacket::set_timestamp_us(uint32_t value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:SensorPacket.timestamp_us)
 }
 
-// -------------------------------------------------------------------
-
-// SensorPacket
-
-// uint32 timestamp = 1;
-inline void SensorPacket::clear_timestamp() {
-  _impl_.timestamp_ = 0u;
+// uint32 lidar_mm = 2;
+inline void SensorPacket::clear_lidar_mm() {
+  _impl_.lidar_mm_ = 0u;
 }
-inline uint32_t SensorPacket::_internal_timestamp() const {
-  return _impl_.timestamp_;
+inline uint32_t SensorPacket::_internal_lidar_mm() const {
+  return _impl_.lidar_mm_;
 }
-inline uint32_t SensorPacket::timestamp() const {
-  // @@protoc_insertion_point(field_get:SensorPacket.timestamp)
-  return _internal_timestamp();
+inline uint32_t SensorPacket::lidar_mm() const {
+  // @@protoc_insertion_point(field_get:SensorPacket.lidar_mm)
+  return _internal_lidar_mm();
 }
-inline void SensorPacket::_internal_set_timestamp(uint32_t value) {
+inline void SensorPacket::_internal_set_lidar_mm(uint32_t value) {
   
-  _impl_.timestamp_ = value;
+  _impl_.lidar_mm_ = value;
 }
-inline void SensorPacket::set_timestamp(uint32_t value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:SensorPacket.timestamp)
+inline void SensorPacket::set_lidar_mm(uint32_t value) {
+  _internal_set_lidar_mm(value);
+  // @@protoc_insertion_point(field_set:SensorPacket.lidar_mm)
 }
 
-// .ImuData imu_data = 2;
-inline bool SensorPacket::_internal_has_imu_data() const {
-  return this != internal_default_instance() && _impl_.imu_data_ != nullptr;
+// .ImuPayload imu = 3;
+inline bool SensorPacket::_internal_has_imu() const {
+  return this != internal_default_instance() && _impl_.imu_ != nullptr;
 }
-inline bool SensorPacket::has_imu_data() const {
-  return _internal_has_imu_data();
+inline bool SensorPacket::has_imu() const {
+  return _internal_has_imu();
 }
-inline void SensorPacket::clear_imu_data() {
-  if (GetArenaForAllocation() == nullptr && _impl_.imu_data_ != nullptr) {
-    delete _impl_.imu_data_;
+inline void SensorPacket::clear_imu() {
+  if (GetArenaForAllocation() == nullptr && _impl_.imu_ != nullptr) {
+    delete _impl_.imu_;
   }
-  _impl_.imu_data_ = nullptr;
+  _impl_.imu_ = nullptr;
 }
-inline const ::ImuData& SensorPacket::_internal_imu_data() const {
-  const ::ImuData* p = _impl_.imu_data_;
-  return p != nullptr ? *p : reinterpret_cast<const ::ImuData&>(
-      ::_ImuData_default_instance_);
+inline const ::ImuPayload& SensorPacket::_internal_imu() const {
+  const ::ImuPayload* p = _impl_.imu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ImuPayload&>(
+      ::_ImuPayload_default_instance_);
 }
-inline const ::ImuData& SensorPacket::imu_data() const {
-  // @@protoc_insertion_point(field_get:SensorPacket.imu_data)
-  return _internal_imu_data();
+inline const ::ImuPayload& SensorPacket::imu() const {
+  // @@protoc_insertion_point(field_get:SensorPacket.imu)
+  return _internal_imu();
 }
-inline void SensorPacket::unsafe_arena_set_allocated_imu_data(
-    ::ImuData* imu_data) {
+inline void SensorPacket::unsafe_arena_set_allocated_imu(
+    ::ImuPayload* imu) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.imu_data_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.imu_);
   }
-  _impl_.imu_data_ = imu_data;
-  if (imu_data) {
+  _impl_.imu_ = imu;
+  if (imu) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SensorPacket.imu_data)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SensorPacket.imu)
 }
-inline ::ImuData* SensorPacket::release_imu_data() {
+inline ::ImuPayload* SensorPacket::release_imu() {
   
-  ::ImuData* temp = _impl_.imu_data_;
-  _impl_.imu_data_ = nullptr;
+  ::ImuPayload* temp = _impl_.imu_;
+  _impl_.imu_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1161,85 +1515,85 @@ inline ::ImuData* SensorPacket::release_imu_data() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::ImuData* SensorPacket::unsafe_arena_release_imu_data() {
-  // @@protoc_insertion_point(field_release:SensorPacket.imu_data)
+inline ::ImuPayload* SensorPacket::unsafe_arena_release_imu() {
+  // @@protoc_insertion_point(field_release:SensorPacket.imu)
   
-  ::ImuData* temp = _impl_.imu_data_;
-  _impl_.imu_data_ = nullptr;
+  ::ImuPayload* temp = _impl_.imu_;
+  _impl_.imu_ = nullptr;
   return temp;
 }
-inline ::ImuData* SensorPacket::_internal_mutable_imu_data() {
+inline ::ImuPayload* SensorPacket::_internal_mutable_imu() {
   
-  if (_impl_.imu_data_ == nullptr) {
-    auto* p = CreateMaybeMessage<::ImuData>(GetArenaForAllocation());
-    _impl_.imu_data_ = p;
+  if (_impl_.imu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ImuPayload>(GetArenaForAllocation());
+    _impl_.imu_ = p;
   }
-  return _impl_.imu_data_;
+  return _impl_.imu_;
 }
-inline ::ImuData* SensorPacket::mutable_imu_data() {
-  ::ImuData* _msg = _internal_mutable_imu_data();
-  // @@protoc_insertion_point(field_mutable:SensorPacket.imu_data)
+inline ::ImuPayload* SensorPacket::mutable_imu() {
+  ::ImuPayload* _msg = _internal_mutable_imu();
+  // @@protoc_insertion_point(field_mutable:SensorPacket.imu)
   return _msg;
 }
-inline void SensorPacket::set_allocated_imu_data(::ImuData* imu_data) {
+inline void SensorPacket::set_allocated_imu(::ImuPayload* imu) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.imu_data_;
+    delete _impl_.imu_;
   }
-  if (imu_data) {
+  if (imu) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(imu_data);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(imu);
     if (message_arena != submessage_arena) {
-      imu_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, imu_data, submessage_arena);
+      imu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, imu, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.imu_data_ = imu_data;
-  // @@protoc_insertion_point(field_set_allocated:SensorPacket.imu_data)
+  _impl_.imu_ = imu;
+  // @@protoc_insertion_point(field_set_allocated:SensorPacket.imu)
 }
 
-// .AltimeterData altimeter_data = 3;
-inline bool SensorPacket::_internal_has_altimeter_data() const {
-  return this != internal_default_instance() && _impl_.altimeter_data_ != nullptr;
+// .RcPayload rc = 4;
+inline bool SensorPacket::_internal_has_rc() const {
+  return this != internal_default_instance() && _impl_.rc_ != nullptr;
 }
-inline bool SensorPacket::has_altimeter_data() const {
-  return _internal_has_altimeter_data();
+inline bool SensorPacket::has_rc() const {
+  return _internal_has_rc();
 }
-inline void SensorPacket::clear_altimeter_data() {
-  if (GetArenaForAllocation() == nullptr && _impl_.altimeter_data_ != nullptr) {
-    delete _impl_.altimeter_data_;
+inline void SensorPacket::clear_rc() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rc_ != nullptr) {
+    delete _impl_.rc_;
   }
-  _impl_.altimeter_data_ = nullptr;
+  _impl_.rc_ = nullptr;
 }
-inline const ::AltimeterData& SensorPacket::_internal_altimeter_data() const {
-  const ::AltimeterData* p = _impl_.altimeter_data_;
-  return p != nullptr ? *p : reinterpret_cast<const ::AltimeterData&>(
-      ::_AltimeterData_default_instance_);
+inline const ::RcPayload& SensorPacket::_internal_rc() const {
+  const ::RcPayload* p = _impl_.rc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RcPayload&>(
+      ::_RcPayload_default_instance_);
 }
-inline const ::AltimeterData& SensorPacket::altimeter_data() const {
-  // @@protoc_insertion_point(field_get:SensorPacket.altimeter_data)
-  return _internal_altimeter_data();
+inline const ::RcPayload& SensorPacket::rc() const {
+  // @@protoc_insertion_point(field_get:SensorPacket.rc)
+  return _internal_rc();
 }
-inline void SensorPacket::unsafe_arena_set_allocated_altimeter_data(
-    ::AltimeterData* altimeter_data) {
+inline void SensorPacket::unsafe_arena_set_allocated_rc(
+    ::RcPayload* rc) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.altimeter_data_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rc_);
   }
-  _impl_.altimeter_data_ = altimeter_data;
-  if (altimeter_data) {
+  _impl_.rc_ = rc;
+  if (rc) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SensorPacket.altimeter_data)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SensorPacket.rc)
 }
-inline ::AltimeterData* SensorPacket::release_altimeter_data() {
+inline ::RcPayload* SensorPacket::release_rc() {
   
-  ::AltimeterData* temp = _impl_.altimeter_data_;
-  _impl_.altimeter_data_ = nullptr;
+  ::RcPayload* temp = _impl_.rc_;
+  _impl_.rc_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1251,44 +1605,124 @@ inline ::AltimeterData* SensorPacket::release_altimeter_data() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::AltimeterData* SensorPacket::unsafe_arena_release_altimeter_data() {
-  // @@protoc_insertion_point(field_release:SensorPacket.altimeter_data)
+inline ::RcPayload* SensorPacket::unsafe_arena_release_rc() {
+  // @@protoc_insertion_point(field_release:SensorPacket.rc)
   
-  ::AltimeterData* temp = _impl_.altimeter_data_;
-  _impl_.altimeter_data_ = nullptr;
+  ::RcPayload* temp = _impl_.rc_;
+  _impl_.rc_ = nullptr;
   return temp;
 }
-inline ::AltimeterData* SensorPacket::_internal_mutable_altimeter_data() {
+inline ::RcPayload* SensorPacket::_internal_mutable_rc() {
   
-  if (_impl_.altimeter_data_ == nullptr) {
-    auto* p = CreateMaybeMessage<::AltimeterData>(GetArenaForAllocation());
-    _impl_.altimeter_data_ = p;
+  if (_impl_.rc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RcPayload>(GetArenaForAllocation());
+    _impl_.rc_ = p;
   }
-  return _impl_.altimeter_data_;
+  return _impl_.rc_;
 }
-inline ::AltimeterData* SensorPacket::mutable_altimeter_data() {
-  ::AltimeterData* _msg = _internal_mutable_altimeter_data();
-  // @@protoc_insertion_point(field_mutable:SensorPacket.altimeter_data)
+inline ::RcPayload* SensorPacket::mutable_rc() {
+  ::RcPayload* _msg = _internal_mutable_rc();
+  // @@protoc_insertion_point(field_mutable:SensorPacket.rc)
   return _msg;
 }
-inline void SensorPacket::set_allocated_altimeter_data(::AltimeterData* altimeter_data) {
+inline void SensorPacket::set_allocated_rc(::RcPayload* rc) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.altimeter_data_;
+    delete _impl_.rc_;
   }
-  if (altimeter_data) {
+  if (rc) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(altimeter_data);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rc);
     if (message_arena != submessage_arena) {
-      altimeter_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, altimeter_data, submessage_arena);
+      rc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rc, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.altimeter_data_ = altimeter_data;
-  // @@protoc_insertion_point(field_set_allocated:SensorPacket.altimeter_data)
+  _impl_.rc_ = rc;
+  // @@protoc_insertion_point(field_set_allocated:SensorPacket.rc)
+}
+
+// repeated .ImuRecord imus = 5;
+inline int SensorPacket::_internal_imus_size() const {
+  return _impl_.imus_.size();
+}
+inline int SensorPacket::imus_size() const {
+  return _internal_imus_size();
+}
+inline void SensorPacket::clear_imus() {
+  _impl_.imus_.Clear();
+}
+inline ::ImuRecord* SensorPacket::mutable_imus(int index) {
+  // @@protoc_insertion_point(field_mutable:SensorPacket.imus)
+  return _impl_.imus_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ImuRecord >*
+SensorPacket::mutable_imus() {
+  // @@protoc_insertion_point(field_mutable_list:SensorPacket.imus)
+  return &_impl_.imus_;
+}
+inline const ::ImuRecord& SensorPacket::_internal_imus(int index) const {
+  return _impl_.imus_.Get(index);
+}
+inline const ::ImuRecord& SensorPacket::imus(int index) const {
+  // @@protoc_insertion_point(field_get:SensorPacket.imus)
+  return _internal_imus(index);
+}
+inline ::ImuRecord* SensorPacket::_internal_add_imus() {
+  return _impl_.imus_.Add();
+}
+inline ::ImuRecord* SensorPacket::add_imus() {
+  ::ImuRecord* _add = _internal_add_imus();
+  // @@protoc_insertion_point(field_add:SensorPacket.imus)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ImuRecord >&
+SensorPacket::imus() const {
+  // @@protoc_insertion_point(field_list:SensorPacket.imus)
+  return _impl_.imus_;
+}
+
+// repeated .RangeRecord ranges = 6;
+inline int SensorPacket::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
+}
+inline int SensorPacket::ranges_size() const {
+  return _internal_ranges_size();
+}
+inline void SensorPacket::clear_ranges() {
+  _impl_.ranges_.Clear();
+}
+inline ::RangeRecord* SensorPacket::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:SensorPacket.ranges)
+  return _impl_.ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RangeRecord >*
+SensorPacket::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:SensorPacket.ranges)
+  return &_impl_.ranges_;
+}
+inline const ::RangeRecord& SensorPacket::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
+}
+inline const ::RangeRecord& SensorPacket::ranges(int index) const {
+  // @@protoc_insertion_point(field_get:SensorPacket.ranges)
+  return _internal_ranges(index);
+}
+inline ::RangeRecord* SensorPacket::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
+}
+inline ::RangeRecord* SensorPacket::add_ranges() {
+  ::RangeRecord* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:SensorPacket.ranges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RangeRecord >&
+SensorPacket::ranges() const {
+  // @@protoc_insertion_point(field_list:SensorPacket.ranges)
+  return _impl_.ranges_;
 }
 
 #ifdef __GNUC__
@@ -1300,6 +1734,8 @@ inline void SensorPacket::set_allocated_altimeter_data(::AltimeterData* altimete
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1307,4 +1743,4 @@ inline void SensorPacket::set_allocated_altimeter_data(::AltimeterData* altimete
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_shared_2fproto_2fsensor_5fdata_2eproto
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sensor_5fdata_2eproto
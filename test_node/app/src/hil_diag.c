@@ -5,6 +5,8 @@
 
 #include "hil_diag.h"
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
 
 /* ── Backing atomics ─────────────────────────────────────────────────────── */
 static atomic_t diag_spi_rx          = ATOMIC_INIT(0);
@@ -13,6 +15,8 @@ static atomic_t diag_timer_inject    = ATOMIC_INIT(0);
 static atomic_t diag_sched_q_evict   = ATOMIC_INIT(0);
 static atomic_t diag_imu_read        = ATOMIC_INIT(0);
 static atomic_t diag_lidar_read      = ATOMIC_INIT(0);
+static atomic_t diag_superseded      = ATOMIC_INIT(0);
+static atomic_t diag_rc_drop         = ATOMIC_INIT(0);
 static atomic_t diag_last_inject_ts  = ATOMIC_INIT(0);
 static atomic_t diag_last_lidar_mm   = ATOMIC_INIT(0);
 static atomic_t diag_last_euler_x    = ATOMIC_INIT(0);
@@ -24,6 +28,8 @@ void hil_diag_inc_timer_inject(void)     { atomic_inc(&diag_timer_inject);  }
 void hil_diag_inc_scheduler_q_evict(void){ atomic_inc(&diag_sched_q_evict); }
 void hil_diag_inc_imu_read(void)         { atomic_inc(&diag_imu_read);      }
 void hil_diag_inc_lidar_read(void)       { atomic_inc(&diag_lidar_read);    }
+void hil_diag_add_superseded(uint32_t n) { atomic_add(&diag_superseded, (atomic_val_t)n); }
+void hil_diag_inc_rc_drop(void)          { atomic_inc(&diag_rc_drop);       }
 
 /* ── Value setters ───────────────────────────────────────────────────────── */
 void hil_diag_set_last_inject_ts(uint32_t ts_us) {
@@ -45,7 +51,44 @@ void hil_diag_get_snapshot(hil_diag_snapshot_t *out)
     out->scheduler_q_evict  = (uint32_t)atomic_get(&diag_sched_q_evict);
     out->imu_read_count     = (uint32_t)atomic_get(&diag_imu_read);
     out->lidar_read_count   = (uint32_t)atomic_get(&diag_lidar_read);
+    out->superseded_count   = (uint32_t)atomic_get(&diag_superseded);
+    out->rc_drop_count      = (uint32_t)atomic_get(&diag_rc_drop);
     out->last_inject_ts_us  = (uint32_t)atomic_get(&diag_last_inject_ts);
     out->last_lidar_mm      = (int32_t) atomic_get(&diag_last_lidar_mm);
     out->last_euler_x       = (int32_t) atomic_get(&diag_last_euler_x);
 }
+
+/* ── Latency histograms ──────────────────────────────────────────────────── */
+/* All-zero is the empty state (see hil_core/hist.h), so no init needed. */
+static struct hil_hist diag_hist[HIL_HIST_ID_COUNT];
+
+void hil_diag_hist_record(enum hil_hist_id id, uint32_t us)
+{
+    hil_hist_record(&diag_hist[id], us);
+}
+
+void hil_diag_hist_take(struct hil_hist_window out[HIL_HIST_ID_COUNT])
+{
+    for (int i = 0; i < HIL_HIST_ID_COUNT; i++) {
+        hil_hist_take(&diag_hist[i], &out[i]);
+    }
+}
+
+void hil_diag_hist_dump(const struct hil_hist_window w[HIL_HIST_ID_COUNT],
+                        uint32_t window_ms)
+{
+    static const char hex[] = "0123456789abcdef";
+    static uint8_t bin[HIL_HIST_DUMP_MAX(HIL_HIST_ID_COUNT)];
+    static char line[2U * sizeof(bin) + 1U];
+
+    size_t n = hil_hist_dump_encode((uint16_t)MIN(window_ms, UINT16_MAX), w,
+                                    HIL_HIST_ID_COUNT, bin, sizeof(bin));
+    for (size_t i = 0; i < n; i++) {
+        line[2U * i]      = hex[bin[i] >> 4];
+        line[2U * i + 1U] = hex[bin[i] & 0x0FU];
+    }
+    line[2U * n] = '\0';
+
+    /* One printk so the line is not split by other console output. */
+    printk(HIL_HIST_LINE_PREFIX "%s\n", line);
+}
@@ -9,11 +9,21 @@
  *   #include "hil_diag.h"
  *   hil_diag_inc_spi_rx();          // call after successful SPI decode
  *   hil_diag_inc_timer_inject();    // call in injection_timer_isr
- *   hil_diag_inc_imu_read();        // call in imu_read_requested_cb
- *   hil_diag_inc_lidar_read();      // call in lidar_read_requested_cb
+ *   hil_diag_inc_imu_read();        // call in the IMU on_read hook
+ *   hil_diag_inc_lidar_read();      // call in the LiDAR on_read hook
+ *   hil_diag_add_superseded(n);     // posted packets the sensor thread skipped
  *   hil_diag_set_last_lidar(mm);    // record last served LiDAR value
  *   hil_diag_set_last_euler_x(v);   // record last served IMU euler_x
  *   hil_diag_set_last_inject_ts(t); // record last injected timestamp
+ *   hil_diag_hist_record(HIL_HIST_INJECT_LATE, us);  // latency sample
+ *   hil_diag_hist_record(HIL_HIST_IMU_AGE, age);     // in the IMU on_pin hook
+ *
+ * Latency histograms
+ * ──────────────────
+ * One log2 histogram per pipeline stage (enum hil_hist_id in
+ * hil_core/hist.h).  Recording is lock-free and ISR-safe.  The diag thread
+ * takes one window per period, prints p99/max and dumps the whole window as
+ * one "#H <hex>" console line that lib/hil_core/tools/hil_hist renders.
  */
 
 #ifndef HIL_DIAG_H
@@ -22,14 +32,18 @@
 #include <zephyr/sys/atomic.h>
 #include <stdint.h>
 
+#include "hil_core/hist.h"
+
 /* ── Snapshot struct (returned by hil_diag_get_snapshot) ─────────────────── */
 typedef struct {
     uint32_t spi_rx_count;        /**< total successfully decoded SPI frames  */
-    uint32_t decode_fail_count;   /**< total nanopb decode failures           */
+    uint32_t decode_fail_count;   /**< total SensorPacket decode failures     */
     uint32_t timer_inject_count;  /**< total timer ISR injections             */
     uint32_t scheduler_q_evict;   /**< total scheduler_q oldest-evictions     */
     uint32_t imu_read_count;      /**< total I2C read_requested on IMU        */
     uint32_t lidar_read_count;    /**< total I2C read_requested on LiDAR      */
+    uint32_t superseded_count;    /**< injected packets never published       */
+    uint32_t rc_drop_count;       /**< RC commands invalid or TX ring full    */
     uint32_t last_inject_ts_us;   /**< timestamp_us of last injected packet   */
     int32_t  last_lidar_mm;       /**< last distance served to I2C bus        */
     int32_t  last_euler_x;        /**< last IMU euler_x served to I2C bus     */
@@ -42,6 +56,8 @@ void hil_diag_inc_timer_inject(void);
 void hil_diag_inc_scheduler_q_evict(void);
 void hil_diag_inc_imu_read(void);
 void hil_diag_inc_lidar_read(void);
+void hil_diag_add_superseded(uint32_t n);
+void hil_diag_inc_rc_drop(void);
 
 /* ── Value setters (ISR-safe) ────────────────────────────────────────────── */
 void hil_diag_set_last_inject_ts(uint32_t ts_us);
@@ -51,4 +67,16 @@ void hil_diag_set_last_euler_x(int32_t val);
 /* ── Snapshot reader (thread context only) ───────────────────────────────── */
 void hil_diag_get_snapshot(hil_diag_snapshot_t *out);
 
+/* ── Latency histograms ──────────────────────────────────────────────────── */
+
+/** @brief Record one latency sample in µs (ISR-safe). */
+void hil_diag_hist_record(enum hil_hist_id id, uint32_t us);
+
+/** @brief Take the current window of every histogram and reset them (thread context). */
+void hil_diag_hist_take(struct hil_hist_window out[HIL_HIST_ID_COUNT]);
+
+/** @brief Print windows as one HIL_HIST_LINE_PREFIX hex line (thread context). */
+void hil_diag_hist_dump(const struct hil_hist_window w[HIL_HIST_ID_COUNT],
+                        uint32_t window_ms);
+
 #endif /* HIL_DIAG_H */
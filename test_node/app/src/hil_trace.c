@@ -0,0 +1,117 @@
+/**
+ * @file hil_trace.c
+ * @brief Per-CPU trace rings and the thread that drains them to the console.
+ */
+
+#include "hil_trace.h"
+#include "threads/scheduler_test.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+/* ── Rings ───────────────────────────────────────────────────────────────── */
+static struct hil_trace trace_rings[CONFIG_MP_MAX_NUM_CPUS];
+
+static inline struct hil_trace *this_ring(void)
+{
+#if CONFIG_MP_MAX_NUM_CPUS > 1
+    /* A thread migrating after this read still lands in a valid ring: every
+     * ring takes any number of producers. */
+    return &trace_rings[arch_curr_cpu()->id];
+#else
+    return &trace_rings[0];
+#endif
+}
+
+void hil_trace_emit(enum hil_trace_event id, uint16_t a0, uint32_t a1, uint32_t a2)
+{
+    const struct hil_trace_rec rec = {
+        .ts = scheduler_now_us(),
+        .id = (uint16_t)id,
+        .a0 = a0,
+        .a1 = a1,
+        .a2 = a2,
+    };
+
+    hil_trace_put(this_ring(), &rec);
+}
+
+/* Before any interrupt can fire, so no record is lost to an unset ring. */
+static int hil_trace_rings_init(void)
+{
+    for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+        hil_trace_init(&trace_rings[i]);
+    }
+    return 0;
+}
+
+SYS_INIT(hil_trace_rings_init, PRE_KERNEL_1, 0);
+
+/* ── Drain thread ────────────────────────────────────────────────────────── */
+#define TRACE_STACK_SIZE   1024U
+#define TRACE_PRIORITY     (K_LOWEST_APPLICATION_THREAD_PRIO)   /* below the diag thread */
+#define TRACE_BATCH        16U     /* records per "#T" line */
+
+K_THREAD_STACK_DEFINE(trace_stack, TRACE_STACK_SIZE);
+static struct k_thread trace_thread_data;
+
+/* Prints one ring's next batch; returns the number of records printed. */
+static size_t drain_batch(uint8_t ring_id)
+{
+    static const char hex[] = "0123456789abcdef";
+    static struct hil_trace_rec rec[TRACE_BATCH];
+    static uint8_t bin[HIL_TRACE_DUMP_SIZE(TRACE_BATCH)];
+    static char line[2U * sizeof(bin) + 1U];
+
+    struct hil_trace *t = &trace_rings[ring_id];
+    size_t n = 0;
+
+    while (n < TRACE_BATCH && hil_trace_get(t, &rec[n])) {
+        n++;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    size_t len = hil_trace_dump_encode(ring_id, hil_trace_dropped(t), rec, n,
+                                       bin, sizeof(bin));
+    for (size_t i = 0; i < len; i++) {
+        line[2U * i]      = hex[bin[i] >> 4];
+        line[2U * i + 1U] = hex[bin[i] & 0x0FU];
+    }
+    line[2U * len] = '\0';
+
+    /* One printk so the line is not split by other console output. */
+    printk(HIL_TRACE_LINE_PREFIX "%s\n", line);
+    return n;
+}
+
+static void trace_thread(void *p1, void *p2, void *p3)
+{
+    ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
+
+    while (1) {
+        size_t printed = 0;
+
+        for (uint8_t i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+            printed += drain_batch(i);
+        }
+        /* Keep going while there is a backlog; otherwise poll slowly. */
+        if (printed == 0) {
+            k_sleep(K_MSEC(CONFIG_HIL_TRACE_DRAIN_MS));
+        }
+    }
+}
+
+void hil_trace_start(void)
+{
+    k_thread_create(&trace_thread_data,
+                    trace_stack,
+                    K_THREAD_STACK_SIZEOF(trace_stack),
+                    trace_thread,
+                    NULL, NULL, NULL,
+                    TRACE_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&trace_thread_data, "hil_trace");
+}
@@ -0,0 +1,51 @@
+/**
+ * @file hil_trace.h
+ * @brief Binary hot-path tracing for the HIL bridge.
+ *
+ * Text logging in the alarm ISR and the I2C target callbacks perturbs the
+ * very latencies the bridge measures.  Hot paths record fixed-size binary
+ * events instead (hil_core/trace.h); a lowest-priority thread drains them
+ * and prints "#T <hex>" console lines that lib/hil_core/tools/hil_trace
+ * turns back into text on the host.
+ *
+ * Usage in other modules:
+ *   #include "hil_trace.h"
+ *   HIL_TRACE(INJECT, range_mm, ts_us, euler_x);   // event HIL_TEV_INJECT
+ *
+ * a0 is truncated to 16 bits, a1 and a2 are 32 bits; the event's format in
+ * HIL_TRACE_EVENTS says how the host prints them.  One ring per CPU; each
+ * record is timestamped with scheduler_now_us(), the packet timestamp epoch.
+ *
+ * With CONFIG_HIL_TRACE=n HIL_TRACE() compiles to nothing and its
+ * arguments are not evaluated.
+ */
+
+#ifndef HIL_TRACE_H
+#define HIL_TRACE_H
+
+#include <stdint.h>
+
+#include "hil_core/trace.h"
+
+#ifdef CONFIG_HIL_TRACE
+
+/** @brief Record one event (any context). */
+void hil_trace_emit(enum hil_trace_event id, uint16_t a0, uint32_t a1, uint32_t a2);
+
+#define HIL_TRACE(ev, a0, a1, a2) \
+    hil_trace_emit(HIL_TEV_##ev, (uint16_t)(a0), (uint32_t)(a1), (uint32_t)(a2))
+
+/** @brief Start the drain thread (call once from main). */
+void hil_trace_start(void);
+
+#else
+
+/* sizeof keeps the arguments referenced without evaluating them. */
+#define HIL_TRACE(ev, a0, a1, a2) \
+    do { (void)sizeof((a0) + (a1) + (a2)); } while (0)
+
+static inline void hil_trace_start(void) { }
+
+#endif /* CONFIG_HIL_TRACE */
+
+#endif /* HIL_TRACE_H */
@@ -5,38 +5,28 @@
  * Boot sequence
  * ─────────────
  *   1. Verify all required devices are ready.
- *   2. Perform the SPI clock-sync handshake with the Pi.
- *      The Pi sends a special SYNC frame; the STM32 records its own now_us()
- *      at the moment it receives it.  All subsequent packet timestamps are
- *      relative to that moment.
- *   3. Start sensor_emulation subsystem (registers I2C targets, starts thread).
- *   4. Start scheduler subsystem (starts SPI DMA loop + injection timer).
- *   5. Run diagnostic thread forever, printing stats every 2 s.
+ *   2. Start the RC UART (non-fatal: without it RC commands are dropped).
+ *      Start sensor_emulation subsystem (registers I2C targets, starts thread).
+ *   3. Start motor PWM capture (non-fatal: without it MISO carries no samples).
+ *      Start scheduler subsystem (starts SPI DMA loop + injection alarms).
+ *   4. Run diagnostic thread forever, printing stats every 2 s.
  *
- * ── CLOCK SYNC PROTOCOL ──────────────────────────────────────────────────────
+ * ── CLOCK SYNC ───────────────────────────────────────────────────────────────
  *
- *   Pi sends first (SYNC marker):
- *     [0xFF][0xFF][SYNC_MAGIC_0][SYNC_MAGIC_1][SYNC_MAGIC_2][SYNC_MAGIC_3]
- *     where SYNC_MAGIC = 0xC0FFEEEE (little-endian)
- *
- *   STM32 receives the 6-byte sync frame over SPI.
- *   STM32 records epoch_stm32_us = now_us() at reception.
- *   STM32 sends back 4 bytes = epoch_stm32_us (little-endian) on the next
- *   Pi-clocked SPI transaction.  (The Pi must initiate a 4-byte read.)
- *
- *   Pi receives the 4 bytes, computes:
- *     epoch_offset_us = epoch_stm32_us - pi_monotonic_us_at_sync
- *   Then all subsequent timestamp_us fields in SensorPacket are:
- *     (pi_sim_elapsed_us + epoch_stm32_us_at_sync)
- *
- *   For the test harness (pi_simulator.py), a simplified version is used:
- *   timestamps start at 0 and the STM32 clock-gates against its own elapsed
- *   time since main() started.  This is sufficient to validate the flow.
+ *   There is no handshake.  The injection counter starts at boot and its
+ *   value is the packet timestamp epoch.  Every SPI transfer returns a MISO
+ *   status (hil_core/miso.h) holding the node's 64-bit time of the previous
+ *   transfer; the Pi pairs it with its own time of that transfer and servos
+ *   offset and skew continuously (flight_sim NodeClock), so it can start
+ *   streaming at any time and follows crystal drift for the whole run.
  */
 
 #include "threads/sensor_emulation_test.h"
 #include "threads/scheduler_test.h"
+#include "threads/rc.h"
+#include "threads/pwm.h"
 #include "hil_diag.h"
+#include "hil_trace.h"
 
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/spi.h>
@@ -52,97 +42,10 @@ LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 /* static const struct device *i2c_imu   = DEVICE_DT_GET(DT_ALIAS(i2c_imu)); */
 /* static const struct device *spi_dev   = DEVICE_DT_GET(DT_ALIAS(spi_orchestrator)); */
 
-/* ── Clock sync ──────────────────────────────────────────────────────────── */
-#define SYNC_MAGIC        0xC0FFEEEEUL
-#define SYNC_FRAME_MARKER 0xFFFF
-
-/*
- * hil_epoch_stm32_us: the STM32's now_us() value at the moment the Pi's
- * SYNC frame was received.  All packet timestamps are relative to this.
- *
- * For the simplified test harness, this is set to 0 (Pi timestamps start at
- * 0 and the delay calculation still works because both sides count up from 0
- * simultaneously).
-*/
-
 extern atomic_t spi_err_count; //from scheduler_test.c
 static const struct gpio_dt_spec led =
     GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
 
-
-static uint32_t hil_epoch_stm32_us = 0;
-
-static inline uint32_t now_us(void)
-{
-    return k_cyc_to_us_near32(k_cycle_get_32());
-}
-
-/**
- * @brief Perform the SPI clock-sync handshake.
- *
- * This function blocks until the Pi sends the SYNC magic frame.
- * In the test harness, the Pi sends it as the very first SPI transaction.
- *
- * For the simplified test: if SYNC_SKIP is defined, we skip the handshake
- * and use epoch=0.  Define it in prj.conf for quick bring-up without a Pi.
- */
-/* static void clock_sync_handshake(void) */
-/* { */
-/* #ifdef CONFIG_HIL_SKIP_CLOCK_SYNC */
-/*     hil_epoch_stm32_us = now_us(); */
-/*     LOG_WRN("Clock sync SKIPPED (CONFIG_HIL_SKIP_CLOCK_SYNC=y)."); */
-/*     LOG_WRN("Timestamps will be relative to STM32 boot."); */
-/*     return; */
-/* #endif */
-
-/*     static uint8_t sync_rx_buf[8]; */
-/*     static struct spi_buf sync_spi_buf      = { .buf = sync_rx_buf, .len = 8 }; */
-/*     static struct spi_buf_set sync_spi_set  = { .buffers = &sync_spi_buf, .count = 1 }; */
-
-/*     static const struct spi_config sync_cfg = { */
-/*         .frequency = 10000000U, */
-/*         .operation = SPI_OP_MODE_SLAVE | SPI_TRANSFER_MSB | SPI_WORD_SET(8), */
-/*     }; */
-
-/*     LOG_INF("Waiting for Pi SYNC frame..."); */
-
-/*     /1* Spin until we receive the magic sync pattern. *1/ */
-/*     while (1) { */
-/*         memset(sync_rx_buf, 0, sizeof(sync_rx_buf)); */
-/*         if (spi_read(spi_dev, &sync_cfg, &sync_spi_set) != 0) { */
-/*             continue; */
-/*         } */
-
-/*         uint16_t marker = (uint16_t)sync_rx_buf[0] | ((uint16_t)sync_rx_buf[1] << 8); */
-/*         uint32_t magic  = (uint32_t)sync_rx_buf[2] */
-/*                         | ((uint32_t)sync_rx_buf[3] << 8) */
-/*                         | ((uint32_t)sync_rx_buf[4] << 16) */
-/*                         | ((uint32_t)sync_rx_buf[5] << 24); */
-
-/*         if (marker == SYNC_FRAME_MARKER && magic == SYNC_MAGIC) { */
-/*             hil_epoch_stm32_us = now_us(); */
-/*             LOG_INF("SYNC received! STM32 epoch = %u µs", hil_epoch_stm32_us); */
-/*             break; */
-/*         } */
-/*         LOG_DBG("Waiting for SYNC... got marker=0x%04X magic=0x%08X", */
-/*                 marker, magic); */
-/*     } */
-
-/*     /1* Send our epoch back to the Pi so it can compute the offset. *1/ */
-/*     static uint8_t sync_tx_buf[4]; */
-/*     static struct spi_buf sync_tx_spi_buf  = { .buf = sync_tx_buf, .len = 4 }; */
-/*     static struct spi_buf_set sync_tx_set  = { .buffers = &sync_tx_spi_buf, .count = 1 }; */
-
-/*     sync_tx_buf[0] = (uint8_t)( hil_epoch_stm32_us        & 0xFF); */
-/*     sync_tx_buf[1] = (uint8_t)((hil_epoch_stm32_us >>  8) & 0xFF); */
-/*     sync_tx_buf[2] = (uint8_t)((hil_epoch_stm32_us >> 16) & 0xFF); */
-/*     sync_tx_buf[3] = (uint8_t)((hil_epoch_stm32_us >> 24) & 0xFF); */
-
-/*     /1* Pi will clock these 4 bytes out. *1/ */
-/*     (void)spi_write(spi_dev, &sync_cfg, &sync_tx_set); */
-/*     LOG_INF("Epoch sent to Pi: %u µs", hil_epoch_stm32_us); */
-/* } */
-
 /* ── Diagnostic thread ───────────────────────────────────────────────────── */
 #define DIAG_STACK_SIZE  2048U
 #define DIAG_PRIORITY    10     /* lowest priority: runs only when nothing else is ready */
@@ -158,13 +61,19 @@ static void diag_thread(void *p1, void *p2, void *p3)
 
     hil_diag_snapshot_t prev = {0};
     hil_diag_snapshot_t cur  = {0};
+    struct hil_sched_stats sched_st;
+    struct hil_hist_window hist[HIL_HIST_ID_COUNT];
 
     uint32_t prev_spi_err = 0;
+    uint32_t window_start_ms = k_uptime_get_32();
 
     while (1) {
         k_sleep(K_MSEC(DIAG_PERIOD_MS));
 
         hil_diag_get_snapshot(&cur);
+        scheduler_get_stats(&sched_st);
+        hil_diag_hist_take(hist);
+        uint32_t window_end_ms = k_uptime_get_32();
         uint32_t cur_spi_err = (uint32_t)atomic_get(&spi_err_count);
 
         /* ── Rates over last 2 s ───────────────────────────── */
@@ -180,12 +89,32 @@ static void diag_thread(void *p1, void *p2, void *p3)
 
         /* ── Single line: easy to read at speed ────────────── */
         printk("[t=%5us] SPI rx=%u/s inj=%u/s I2C imu=%u/s lidar=%u/s "
-               "| fails=%u evict=%u spi_err=%u\n",
+               "| fails=%u evict=%u superseded=%u rc_drop=%u spi_err=%u\n",
                k_uptime_get_32() / 1000,
                rx_rate, inj_rate, imu_rate, lidar_rate,
                cur.decode_fail_count,
                cur.scheduler_q_evict,
+               cur.superseded_count,
+               cur.rc_drop_count,
                cur_spi_err);
+        /* p99/max per stage; the "#H" line carries the full distribution. */
+        printk("          p99/max us rx->enq=%u/%u enq->inj=%u/%u late=%u/%u "
+               "pub=%u/%u age imu=%u/%u lidar=%u/%u coalesced=%u\n",
+               hil_hist_pct(&hist[HIL_HIST_RX_TO_ENQUEUE], 99),
+               hist[HIL_HIST_RX_TO_ENQUEUE].max,
+               hil_hist_pct(&hist[HIL_HIST_ENQUEUE_TO_INJECT], 99),
+               hist[HIL_HIST_ENQUEUE_TO_INJECT].max,
+               hil_hist_pct(&hist[HIL_HIST_INJECT_LATE], 99),
+               hist[HIL_HIST_INJECT_LATE].max,
+               hil_hist_pct(&hist[HIL_HIST_PUBLISH_LATE], 99),
+               hist[HIL_HIST_PUBLISH_LATE].max,
+               hil_hist_pct(&hist[HIL_HIST_IMU_AGE], 99),
+               hist[HIL_HIST_IMU_AGE].max,
+               hil_hist_pct(&hist[HIL_HIST_LIDAR_AGE], 99),
+               hist[HIL_HIST_LIDAR_AGE].max,
+               sched_st.coalesced);
+        hil_diag_hist_dump(hist, window_end_ms - window_start_ms);
+        window_start_ms = window_end_ms;
 
         /* ── LED blink pattern encodes health ──────────────── */
         /* Green = healthy: slow 1s blink                       */
@@ -276,6 +205,7 @@ int main(void)
     const struct device *i2c_lidar = DEVICE_DT_GET(DT_ALIAS(i2c_lidar));
     const struct device *i2c_imu = DEVICE_DT_GET(DT_ALIAS(i2c_imu));
     const struct device *spi_dev = DEVICE_DT_GET(DT_ALIAS(spi_orchestrator));
+    const struct device *uart_rc = DEVICE_DT_GET(DT_ALIAS(uart_rc));
     while(1) {
     printk("\nHIL Nucleo HIL Bridge v1.0\n");
     LOG_INF("HIL Nucleo bridge starting...");
@@ -300,17 +230,25 @@ int main(void)
     }
     LOG_INF("I2C IMU bus ready");
 
-    /* ── Clock sync ─────────────────────────────────────────────────────── */
-    //clock_sync_handshake();
-
     /* ── Subsystem init ─────────────────────────────────────────────────── */
+    /* Trace drain first, so nothing the subsystems record is stuck unread. */
+    hil_trace_start();
+
     /*
-     * sensor_emulation MUST be started before the scheduler so that the I2C
-     * target callbacks are registered before the first timer injection fires.
+     * RC and sensor_emulation MUST be started before the scheduler so that
+     * the UART and the I2C target callbacks are ready before the first timer
+     * injection fires.
      */
+    if (rc_init(uart_rc) < 0) {
+        LOG_WRN("RC UART unavailable — RC commands will be dropped");
+    }
     sensor_emulation_init(i2c_lidar, i2c_imu);
     LOG_INF("Sensor emulation subsystem started");
 
+    if (pwm_init() < 0) {
+        LOG_WRN("PWM capture unavailable — no motor samples on MISO");
+    }
+
     scheduler_init();
     LOG_INF("Scheduler subsystem started");
 
@@ -0,0 +1,133 @@
+/**
+ * @file i2c_emulator.c  [TEST-INSTRUMENTED VERSION]
+ * @brief Shared I2C target callbacks for every table-driven sensor emulator.
+ *
+ * Additions vs base:
+ *   + HIL_TRACE records for read starts, register writes and stops, tagged
+ *     with the emulator's (kind, instance).
+ *   + LOG_DBG on every byte, compiled out unless
+ *     CONFIG_HIL_HOT_PATH_LOG_LEVEL_DBG=y (it changes the bus timing).
+ *   Per-sensor diagnostics (read counters, data age) live in each sensor's
+ *   on_read / on_pin hooks.
+ */
+
+#include "threads/i2c_emulator_test.h"
+#include "threads/sensor_emulation_test.h"
+#include "hil_trace.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(i2c_emulator, CONFIG_HIL_HOT_PATH_LOG_LEVEL);
+
+static inline struct i2c_emulator *to_emulator(struct i2c_target_config *config)
+{
+    return CONTAINER_OF(config, struct i2c_emulator, config);
+}
+
+/* Trace "target" argument: record kind in the high byte, instance in the low. */
+static inline uint32_t trace_target(const struct i2c_emulator *em)
+{
+    return ((uint32_t)em->kind << 8) | em->instance;
+}
+
+/* ── I2C Callbacks (ISR context) ─────────────────────────────────────────── */
+static int emu_write_requested_cb(struct i2c_target_config *config)
+{
+    hil_regemu_write_start(&to_emulator(config)->emu);
+    return 0;
+}
+
+static int emu_write_received_cb(struct i2c_target_config *config, uint8_t val)
+{
+    struct i2c_emulator *em = to_emulator(config);
+    uint8_t reg = em->emu.reg;
+    bool    is_addr = em->emu.expect_reg;
+
+    hil_regemu_write_byte(&em->emu, val);
+
+    if (is_addr) {
+        LOG_DBG("[%s%u] DUT set reg=0x%02X", em->name, em->instance, val);
+    } else {
+        HIL_TRACE(I2C_WRITE, reg, trace_target(em), val);
+        LOG_DBG("[%s%u] DUT wrote val=0x%02X to page %u reg=0x%02X",
+                em->name, em->instance, val, em->emu.page, reg);
+    }
+    return 0;
+}
+
+static int emu_read_requested_cb(struct i2c_target_config *config, uint8_t *val)
+{
+    struct i2c_emulator *em = to_emulator(config);
+    uint8_t reg = em->emu.reg;
+
+    *val = hil_regemu_read_start(&em->emu);
+    HIL_TRACE(I2C_READ, reg, trace_target(em), hil_regemu_snap_idx(&em->emu, 0));
+    LOG_DBG("[%s%u READ_REQ] pkt=%u page=%u reg=0x%02X val=0x%02X",
+            em->name, em->instance, hil_regemu_snap_idx(&em->emu, 0), em->emu.page, reg, *val);
+    return 0;
+}
+
+static int emu_read_processed_cb(struct i2c_target_config *config, uint8_t *val)
+{
+    struct i2c_emulator *em = to_emulator(config);
+
+    *val = hil_regemu_read_next(&em->emu);
+    LOG_DBG("[%s%u READ_PROC] reg=0x%02X val=0x%02X",
+            em->name, em->instance, (em->emu.reg - 1U) & (HIL_REGEMU_REGS - 1U), *val);
+    return 0;
+}
+
+static int emu_stop_cb(struct i2c_target_config *config)
+{
+    struct i2c_emulator *em = to_emulator(config);
+
+    hil_regemu_stop(&em->emu);
+    HIL_TRACE(I2C_STOP, em->emu.reg, trace_target(em), 0);
+    LOG_DBG("[%s%u STOP] transaction ended. Next reg=0x%02X",
+            em->name, em->instance, em->emu.reg);
+    return 0;
+}
+
+static const struct i2c_target_callbacks i2c_emulator_callbacks = {
+    .write_requested = emu_write_requested_cb,
+    .write_received  = emu_write_received_cb,
+    .read_requested  = emu_read_requested_cb,
+    .read_processed  = emu_read_processed_cb,
+    .stop            = emu_stop_cb,
+};
+
+/* ── Public API ──────────────────────────────────────────────────────────── */
+void i2c_emulator_init(struct i2c_emulator *em, const char *name,
+                       const struct hil_regemu_desc *desc, uint8_t *const images[],
+                       enum hil_rec kind, uint8_t instance)
+{
+    em->config.callbacks = &i2c_emulator_callbacks;
+    em->name     = name;
+    em->kind     = kind;
+    em->instance = instance;
+    hil_regemu_init(&em->emu, desc, images, hil_rec_offset(kind, instance),
+                    &packet_pool, em);
+}
+
+int i2c_emulator_register(struct i2c_emulator *em, const struct device *i2c_dev,
+                          uint16_t address)
+{
+    int ret;
+
+    em->config.address = address;
+    if (!device_is_ready(i2c_dev)) {
+        LOG_ERR("%s%u I2C device not ready", em->name, em->instance);
+        return -ENODEV;
+    }
+    ret = i2c_target_register(i2c_dev, &em->config);
+    if (ret < 0) {
+        LOG_ERR("Failed to register %s%u at 0x%02X (%d)",
+                em->name, em->instance, address, ret);
+        return ret;
+    }
+    LOG_INF("%s%u target registered at 0x%02X", em->name, em->instance, address);
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file i2c_emulator.h
+ * @brief Zephyr I2C target glue for the table-driven register emulator
+ *        (hil_core/regemu.h).
+ *
+ * One set of target callbacks serves every emulated sensor instance.  Each
+ * callback recovers its instance from the i2c_target_config it was
+ * registered with and forwards the bus event to the regemu engine, so the
+ * ISR path is the same audited code for the IMU, the LiDAR and any sensor
+ * added later, however many instances share a bus:
+ *
+ *   write_requested  →  hil_regemu_write_start()
+ *   write_received   →  hil_regemu_write_byte()     address, then data
+ *   read_requested   →  hil_regemu_read_start()     pins snapshot groups
+ *   read_processed   →  hil_regemu_read_next()      inline fast path
+ *   stop             →  hil_regemu_stop()           releases the pins
+ *
+ * Adding a sensor
+ * ───────────────
+ *   static const struct hil_reg_def baro_rows[] = { ... };
+ *   static const struct hil_reg_page baro_pages[] = {
+ *       { baro_rows, ARRAY_SIZE(baro_rows) },
+ *   };
+ *   static const struct hil_regemu_desc baro_desc = {
+ *       .pages = baro_pages, .n_pages = 1, .unmapped = 0xFF,
+ *   };
+ *
+ *   // per instance, plus a HIL_RECORDS row for its packet record
+ *   i2c_emulator_init(&baro[i].em, "BARO", &baro_desc, baro[i].images,
+ *                     HIL_REC_BARO, i);                 // then load the images
+ *   i2c_emulator_register(&baro[i].em, i2c_dev, addr);  // DUT sees it from here
+ *
+ * The injection ISR then publishes every packet that carries the
+ * instance's record (i2c_emulator_wants()).
+ *
+ * Targets per bus: the STM32 I2C peripheral answers two own addresses
+ * (OAR1 / OAR2), so a bus hosts at most two emulated targets there.
+ */
+
+#ifndef THREADS_I2C_EMULATOR_H
+#define THREADS_I2C_EMULATOR_H
+
+#include "hil_core/regemu.h"
+
+#include <zephyr/drivers/i2c.h>
+#include <stdint.h>
+
+/** @brief One emulated I2C target instance.  Embedded in the device's state. */
+struct i2c_emulator {
+    struct i2c_target_config config;
+    const char *name;           /**< model, for log messages */
+    enum hil_rec kind;          /**< packet record it serves … */
+    uint8_t instance;           /**< … and which instance of it */
+    struct hil_regemu emu;
+};
+
+/**
+ * @brief Reset the engine for one instance: no packet published, page 0,
+ *        all gates live, serving record (kind, instance).
+ *
+ * The register images are the device's own; load their reset values (and
+ * set page / gates through the hil_regemu helpers) after this call.
+ */
+void i2c_emulator_init(struct i2c_emulator *em, const char *name,
+                       const struct hil_regemu_desc *desc, uint8_t *const images[],
+                       enum hil_rec kind, uint8_t instance);
+
+/**
+ * @brief Register the target at address on i2c_dev.  Call once the images
+ *        are loaded, so the first DUT access already sees reset values.
+ *        Publishing works even if registration fails.
+ * @return 0, or a negative errno from the driver.
+ */
+int i2c_emulator_register(struct i2c_emulator *em, const struct device *i2c_dev,
+                          uint16_t address);
+
+/** @brief True if pkt carries the record this instance serves. */
+static inline bool i2c_emulator_wants(const struct i2c_emulator *em,
+                                      const device_update_packet_t *pkt)
+{
+    return (pkt->present[em->kind] & (1U << em->instance)) != 0;
+}
+
+/**
+ * @brief Serve pool slot pkt from now on.
+ *
+ * Takes its own reference; the caller keeps (and must release) its own.
+ * A read transaction already in progress finishes on the packet it pinned.
+ *
+ * @note Single writer: call from sensor_emulation_post() (injection alarm
+ *       ISR) only.
+ */
+static inline void i2c_emulator_publish(struct i2c_emulator *em, uint16_t pkt)
+{
+    hil_regemu_publish(&em->emu, pkt);
+}
+
+/** @brief The emulator owning a regemu instance, for device handlers. */
+static inline struct i2c_emulator *i2c_emulator_of(struct hil_regemu *e)
+{
+    return (struct i2c_emulator *)e->ctx;
+}
+
+#endif /* THREADS_I2C_EMULATOR_H */
@@ -1,156 +1,328 @@
 /**
  * @file imu_emulator.c  [TEST-INSTRUMENTED VERSION]
- * @brief BNO055 IMU emulator — ping-pong double buffer + diagnostics.
+ * @brief BNO055 IMU emulator — register map, reset image and mode side
+ *        effects for the table-driven I2C emulator + diagnostics.
  *
  * Additions vs base:
- *   + hil_diag_inc_imu_read() in read_requested_cb.
+ *   + hil_diag_inc_imu_read() in imu_on_read.
  *   + hil_diag_set_last_euler_x() stores the euler_x value being served.
- *   + LOG_DBG in read_requested_cb (deferred — safe in ISR).
- *   + LOG_INF in stop_cb to log end of each transaction.
+ *   + Data age: imu_on_pin records now − timestamp_us of the packet each
+ *     read transaction pins into HIL_HIST_IMU_AGE.
  */
 
 #include "threads/imu_emulator_test.h"
-#include "threads/sensor_emulation_test.h"
+#include "threads/i2c_emulator_test.h"
+#include "threads/scheduler_test.h"
 #include "hil_diag.h"
 
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/i2c.h>
-#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 #include <string.h>
 
 LOG_MODULE_REGISTER(imu_emulator, LOG_LEVEL_DBG);
 
-/* ── Ping-Pong Double Buffer ─────────────────────────────────────────────── */
-static imu_data_t imu_buf[2];
-static atomic_t   active_idx = ATOMIC_INIT(0);
+static const struct hil_regemu_desc imu_desc;
 
-/* ── I2C Transaction State ────────────────────────────────────────────────── */
-static uint8_t imu_current_reg  = 0x00;
-static int     imu_snap_buf_idx = 0;
+/* ── Instances ────────────────────────────────────────────────────────────── */
+/*
+ * One per emulated BNO055.  regs holds everything except the page-0 output
+ * data block, which is served from the pinned pool slot.  After init only
+ * the instance's I2C ISR writes regs, plus its mode-switch timer
+ * (SYS_STATUS, CHIP_ID).
+ */
+struct imu_dev {
+    struct i2c_emulator em;
+    uint8_t regs[2][IMU_PAGE_SIZE];
+    struct k_timer switch_timer;
+};
 
-/* ── Register byte servant ───────────────────────────────────────────────── */
-static uint8_t serve_imu_byte(int buf_idx, uint8_t reg)
+static struct imu_dev imu_devs[HIL_PKT_IMUS];
+
+static inline struct imu_dev *imu_of(struct hil_regemu *e)
 {
-    const imu_data_t *d = &imu_buf[buf_idx];
-    const uint8_t *raw;
-    uint8_t offset;
+    return CONTAINER_OF(e, struct imu_dev, em.emu);
+}
 
-    switch (reg) {
-    case IMU_REG_GYRO_X_LSB ... IMU_REG_GYRO_Z_MSB:
-        offset = reg - IMU_REG_GYRO_X_LSB;
-        raw    = (const uint8_t *)&d->gyro;
-        return raw[offset];
-    case IMU_REG_EUL_X_LSB ... IMU_REG_EUL_Z_MSB:
-        offset = reg - IMU_REG_EUL_X_LSB;
-        raw    = (const uint8_t *)&d->euler_angles;
-        return raw[offset];
-    case IMU_REG_LIA_X_LSB ... IMU_REG_LIA_Z_MSB:
-        offset = reg - IMU_REG_LIA_X_LSB;
-        raw    = (const uint8_t *)&d->linear_acceleration;
-        return raw[offset];
-    default:
-        return 0xFF;
+/* ── Register image ───────────────────────────────────────────────────────── */
+static void imu_regs_reset(struct imu_dev *d)
+{
+    uint8_t *p0 = d->regs[0];
+    uint8_t *p1 = d->regs[1];
+
+    memset(d->regs, 0, sizeof(d->regs));
+    hil_regemu_set_page(&d->em.emu, 0);
+
+    p0[IMU_REG_CHIP_ID]        = IMU_CHIP_ID;
+    p0[IMU_REG_ACC_ID]         = IMU_ACC_ID;
+    p0[IMU_REG_MAG_ID]         = IMU_MAG_ID;
+    p0[IMU_REG_GYR_ID]         = IMU_GYR_ID;
+    p0[IMU_REG_SW_REV_LSB]     = 0x11;   /* firmware 3.11 */
+    p0[IMU_REG_SW_REV_MSB]     = 0x03;
+    p0[IMU_REG_BL_REV]         = 0x15;
+    p0[IMU_REG_TEMP]           = 25;     /* °C */
+    p0[IMU_REG_CALIB_STAT]     = 0xFF;   /* SYS/GYR/ACC/MAG fully calibrated */
+    p0[IMU_REG_ST_RESULT]      = 0x0F;   /* MCU, GYR, MAG, ACC self-test passed */
+    p0[IMU_REG_UNIT_SEL]       = 0x80;
+    p0[IMU_REG_AXIS_MAP_CONFIG] = 0x24;
+    /* SIC matrix = identity (0x4000 on the diagonal). */
+    p0[IMU_REG_SIC_MATRIX + 1]  = 0x40;
+    p0[IMU_REG_SIC_MATRIX + 9]  = 0x40;
+    p0[IMU_REG_SIC_MATRIX + 17] = 0x40;
+    p0[IMU_REG_ACC_RADIUS_LSB]     = 0xE8;   /* 1000 */
+    p0[IMU_REG_ACC_RADIUS_LSB + 1] = 0x03;
+    p0[IMU_REG_MAG_RADIUS_LSB]     = 0xE0;   /* 480 */
+    p0[IMU_REG_MAG_RADIUS_LSB + 1] = 0x01;
+
+    p1[IMU_REG_PAGE_ID]        = 1;
+    p1[IMU_REG_ACC_CONFIG]     = 0x0D;
+    p1[IMU_REG_MAG_CONFIG]     = 0x6D;
+    p1[IMU_REG_GYR_CONFIG_0]   = 0x38;
+    p1[IMU_REG_ACC_AM_THRES]   = 0x14;
+    p1[IMU_REG_ACC_INT_SET]    = 0x03;
+    p1[IMU_REG_ACC_HG_DUR]     = 0x0F;
+    p1[IMU_REG_ACC_HG_THRES]   = 0xC0;
+    p1[IMU_REG_ACC_NM_THRES]   = 0x0A;
+    p1[IMU_REG_ACC_NM_SET]     = 0x0B;
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        p1[IMU_REG_GYR_HR_X_SET + 2 * axis]     = 0x01;
+        p1[IMU_REG_GYR_HR_X_SET + 2 * axis + 1] = 0x19;
+    }
+    p1[IMU_REG_GYR_AM_THRES]   = 0x04;
+    p1[IMU_REG_GYR_AM_SET]     = 0x0A;
+    for (uint8_t k = 0; k < 16; k++) {
+        p1[IMU_REG_UNIQUE_ID + k] = (uint8_t)(0xA0 + k);
     }
 }
 
-/* ── Public write API (thread context) ───────────────────────────────────── */
-void imu_emulator_update_data(const imu_data_t *new_data)
+/* ── Operating mode ───────────────────────────────────────────────────────── */
+/* Output blocks, used as the SNAP rows' gate bits. */
+enum imu_blk {
+    IMU_BLK_ACC, IMU_BLK_MAG, IMU_BLK_GYR,
+    IMU_BLK_EUL, IMU_BLK_QUA, IMU_BLK_LIA, IMU_BLK_GRV,
+    IMU_BLK_COUNT,
+};
+
+#define IMU_BLKS_FUSION  (BIT(IMU_BLK_EUL) | BIT(IMU_BLK_QUA) | \
+                          BIT(IMU_BLK_LIA) | BIT(IMU_BLK_GRV))
+
+/* Output blocks each OPR_MODE drives (datasheet table 3-3). */
+static const uint8_t imu_mode_blks[IMU_MODE_MASK + 1] = {
+    [IMU_MODE_ACCONLY]      = BIT(IMU_BLK_ACC),
+    [IMU_MODE_MAGONLY]      = BIT(IMU_BLK_MAG),
+    [IMU_MODE_GYRONLY]      = BIT(IMU_BLK_GYR),
+    [IMU_MODE_ACCMAG]       = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG),
+    [IMU_MODE_ACCGYRO]      = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_GYR),
+    [IMU_MODE_MAGGYRO]      = BIT(IMU_BLK_MAG) | BIT(IMU_BLK_GYR),
+    [IMU_MODE_AMG]          = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG) | BIT(IMU_BLK_GYR),
+    [IMU_MODE_IMU]          = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_GYR) | IMU_BLKS_FUSION,
+    [IMU_MODE_COMPASS]      = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG) | IMU_BLKS_FUSION,
+    [IMU_MODE_M4G]          = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG) | IMU_BLKS_FUSION,
+    [IMU_MODE_NDOF_FMC_OFF] = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG) | BIT(IMU_BLK_GYR)
+                            | IMU_BLKS_FUSION,
+    [IMU_MODE_NDOF]         = BIT(IMU_BLK_ACC) | BIT(IMU_BLK_MAG) | BIT(IMU_BLK_GYR)
+                            | IMU_BLKS_FUSION,
+};
+
+static bool imu_in_config(const struct imu_dev *d)
 {
-    int active   = (int)atomic_get(&active_idx);
-    int inactive = 1 - active;
-    memcpy(&imu_buf[inactive], new_data, sizeof(imu_data_t));
-    __DMB();
-    atomic_set(&active_idx, (atomic_val_t)inactive);
+    return (d->regs[0][IMU_REG_OPR_MODE] & IMU_MODE_MASK) == IMU_MODE_CONFIG;
 }
 
-/* ── I2C Callbacks (ISR context) ─────────────────────────────────────────── */
-static int imu_write_requested_cb(struct i2c_target_config *config)
+/** Mode the image asks for once any switch has completed. */
+static uint8_t imu_target_mode(const struct imu_dev *d)
 {
-    ARG_UNUSED(config);
-    return 0;
+    if ((d->regs[0][IMU_REG_PWR_MODE] & 0x03U) == IMU_PWR_SUSPEND) {
+        return IMU_MODE_CONFIG;   /* sensors off: no output */
+    }
+    return d->regs[0][IMU_REG_OPR_MODE] & IMU_MODE_MASK;
 }
 
-static int imu_write_received_cb(struct i2c_target_config *config, uint8_t val)
+/* Gating the SNAP rows is one store; the engine re-derives the runs. */
+static void imu_view_apply(struct imu_dev *d, uint8_t mode)
 {
-    ARG_UNUSED(config);
-    imu_current_reg = val;
-    LOG_DBG("[IMU] DUT set reg=0x%02X", val);
-    return 0;
+    uint8_t live = imu_mode_blks[mode];
+
+    hil_regemu_set_live(&d->em.emu, live);
+    d->regs[0][IMU_REG_SYS_STATUS] = (live == 0)              ? IMU_SYS_IDLE
+                                   : (live & IMU_BLKS_FUSION) ? IMU_SYS_FUSION
+                                                              : IMU_SYS_NO_FUSION;
 }
 
-static int imu_read_requested_cb(struct i2c_target_config *config, uint8_t *val)
+/**
+ * Output stops (and SYS_STATUS reads idle) for the switch time, then the
+ * timer applies whatever mode the image holds by then — so a second write
+ * during the switch simply restarts it with the latest mode.
+ */
+static void imu_begin_switch(struct imu_dev *d, uint32_t ms)
 {
-    ARG_UNUSED(config);
+    imu_view_apply(d, IMU_MODE_CONFIG);
+    k_timer_start(&d->switch_timer, K_MSEC(ms), K_NO_WAIT);
+}
 
-    /* Snapshot the active buffer index for this entire transaction. */
-    imu_snap_buf_idx = (int)atomic_get(&active_idx);
-    *val = serve_imu_byte(imu_snap_buf_idx, imu_current_reg);
+/* Context: system timer ISR. */
+static void imu_switch_done(struct k_timer *timer)
+{
+    struct imu_dev *d = CONTAINER_OF(timer, struct imu_dev, switch_timer);
 
-    hil_diag_inc_imu_read();
+    d->regs[0][IMU_REG_CHIP_ID] = IMU_CHIP_ID;   /* boot after RST_SYS done */
+    imu_view_apply(d, imu_target_mode(d));
+}
 
-    /* Store euler_x (LSB + MSB pair at 0x1A, 0x1B) for diagnostic display. */
-    if (imu_current_reg == IMU_REG_EUL_X_LSB) {
-        int16_t ex = (int16_t)(
-            (uint16_t)serve_imu_byte(imu_snap_buf_idx, IMU_REG_EUL_X_LSB) |
-            ((uint16_t)serve_imu_byte(imu_snap_buf_idx, IMU_REG_EUL_X_MSB) << 8));
-        hil_diag_set_last_euler_x((int32_t)ex);
+/* ── Write handlers (I2C ISR) ─────────────────────────────────────────────── */
+/* PAGE_ID, both pages. */
+static void imu_write_page(struct hil_regemu *e, uint8_t reg, uint8_t val)
+{
+    struct imu_dev *d = imu_of(e);
+    uint8_t page = val & 1U;
+
+    d->regs[0][reg] = page;
+    d->regs[1][reg] = page;
+    hil_regemu_set_page(e, page);
+}
+
+/* Configuration registers: writable in CONFIG mode only, as on the part. */
+static void imu_write_config(struct hil_regemu *e, uint8_t reg, uint8_t val)
+{
+    if (imu_in_config(imu_of(e))) {
+        hil_regemu_store(e, reg, val);
     }
+}
 
-    LOG_DBG("[IMU READ_REQ] buf=%d reg=0x%02X val=0x%02X",
-            imu_snap_buf_idx, imu_current_reg, *val);
+/* OPR_MODE, PWR_MODE and SYS_TRIGGER (page 0). */
+static void imu_write_control(struct hil_regemu *e, uint8_t reg, uint8_t val)
+{
+    struct imu_dev *d = imu_of(e);
+    uint8_t *p0 = d->regs[0];
 
-    imu_current_reg++;
-    return 0;
+    switch (reg) {
+    case IMU_REG_OPR_MODE: {
+        uint8_t from = p0[IMU_REG_OPR_MODE] & IMU_MODE_MASK;
+        uint8_t to   = val & IMU_MODE_MASK;
+        p0[IMU_REG_OPR_MODE] = to;
+        if (to != from) {
+            imu_begin_switch(d, from == IMU_MODE_CONFIG ? IMU_SWITCH_FROM_CONFIG_MS
+                                                        : IMU_SWITCH_TO_CONFIG_MS);
+        }
+        break;
+    }
+    case IMU_REG_PWR_MODE:
+        imu_write_config(e, reg, val & 0x03U);
+        break;
+    case IMU_REG_SYS_TRIGGER:
+        if (val & IMU_TRIG_RST_SYS) {
+            imu_regs_reset(d);
+            p0[IMU_REG_CHIP_ID] = 0x00;   /* not answering as a BNO055 until booted */
+            imu_begin_switch(d, IMU_RESET_MS);
+            return;
+        }
+        if (val & IMU_TRIG_SELF_TEST) {
+            p0[IMU_REG_ST_RESULT] = 0x0F;
+        }
+        if (val & IMU_TRIG_RST_INT) {
+            p0[IMU_REG_INT_STA] = 0x00;
+        }
+        p0[IMU_REG_SYS_TRIGGER] = val & IMU_TRIG_CLK_SEL;
+        break;
+    }
 }
 
-static int imu_read_processed_cb(struct i2c_target_config *config, uint8_t *val)
+/* ── Diagnostics hooks (I2C ISR) ──────────────────────────────────────────── */
+/* Age of the image a whole read transaction is served from. */
+static void imu_on_pin(struct hil_regemu *e, uint8_t group)
 {
-    ARG_UNUSED(config);
-    *val = serve_imu_byte(imu_snap_buf_idx, imu_current_reg);
-    LOG_DBG("[IMU READ_PROC] buf=%d reg=0x%02X val=0x%02X",
-            imu_snap_buf_idx, imu_current_reg, *val);
-    imu_current_reg++;
-    return 0;
+    uint16_t idx = hil_regemu_snap_idx(e, group);
+
+    if (idx != HIL_POOL_NONE) {
+        hil_diag_hist_record(HIL_HIST_IMU_AGE,
+                             scheduler_now_us() - hil_pool_pkt(e->pool, idx)->timestamp_us);
+    }
 }
 
-static int imu_stop_cb(struct i2c_target_config *config)
+static void imu_on_read(struct hil_regemu *e, uint8_t reg)
 {
-    ARG_UNUSED(config);
-    /* Log registers that were read during this transaction */
-    uint8_t start_reg = imu_current_reg;   /* already incremented past last byte */
-    LOG_DBG("[IMU STOP] transaction ended. Last reg=0x%02X", start_reg - 1);
-    imu_current_reg  = 0x00;
-    imu_snap_buf_idx = 0;
-    return 0;
+    hil_diag_inc_imu_read();
+
+    /* Store euler_x (LSB + MSB pair at 0x1A, 0x1B) for diagnostic display. */
+    if (e->page == 0 && reg == IMU_REG_EUL_X_LSB) {
+        const imu_data_t *imu = (const imu_data_t *)hil_regemu_snap_rec(e, 0);
+        const i2c_imu_data_16_t *x = &imu->euler_angles.x;
+        int16_t ex = (int16_t)((uint16_t)(uint8_t)x->lsb | ((uint16_t)(uint8_t)x->msb << 8));
+        hil_diag_set_last_euler_x((int32_t)ex);
+    }
 }
 
-/* ── Registration ────────────────────────────────────────────────────────── */
-static struct i2c_target_callbacks imu_callbacks = {
-    .write_requested = imu_write_requested_cb,
-    .write_received  = imu_write_received_cb,
-    .read_requested  = imu_read_requested_cb,
-    .read_processed  = imu_read_processed_cb,
-    .stop            = imu_stop_cb,
+/* ── Register map ─────────────────────────────────────────────────────────── */
+#define IMU_RO(first, len) \
+    { (first), (len), HIL_REG_IMAGE, HIL_REG_RO, 0, 0, 0, NULL, NULL }
+#define IMU_RW(first, len, handler) \
+    { (first), (len), HIL_REG_IMAGE, 0, 0, 0, 0, NULL, (handler) }
+/* Output block: bytes of the instance's imu record, live only in modes
+ * that drive blk. */
+#define IMU_OUT(blk, first, len) \
+    { (first), (len), HIL_REG_SNAP, 0, 0, (blk), \
+      (first) - IMU_REG_DATA_FIRST, NULL, NULL }
+
+static const struct hil_reg_def imu_page0_rows[] = {
+    IMU_RO (0x00, 7),                                   /* IDs, revisions    */
+    IMU_RW (IMU_REG_PAGE_ID, 1, imu_write_page),
+    IMU_OUT(IMU_BLK_ACC, 0x08, 6),
+    IMU_OUT(IMU_BLK_MAG, 0x0E, 6),
+    IMU_OUT(IMU_BLK_GYR, 0x14, 6),
+    IMU_OUT(IMU_BLK_EUL, 0x1A, 6),
+    IMU_OUT(IMU_BLK_QUA, 0x20, 8),
+    IMU_OUT(IMU_BLK_LIA, 0x28, 6),
+    IMU_OUT(IMU_BLK_GRV, 0x2E, 6),
+    IMU_RO (IMU_REG_TEMP, 7),                           /* TEMP … SYS_ERR    */
+    IMU_RW (IMU_REG_UNIT_SEL, 2, imu_write_config),
+    IMU_RW (IMU_REG_OPR_MODE, 3, imu_write_control),
+    IMU_RW (IMU_REG_TEMP_SOURCE, 0x6B - 0x40, imu_write_config),  /* … MAG_RADIUS */
+    IMU_RO (0x6B, 0x80 - 0x6B),                         /* reserved          */
 };
 
-static struct i2c_target_config imu_config = {
-    .address   = IMU_ADDRESS,
-    .callbacks = &imu_callbacks,
+static const struct hil_reg_def imu_page1_rows[] = {
+    IMU_RW (0x00, 7, imu_write_config),
+    IMU_RW (IMU_REG_PAGE_ID, 1, imu_write_page),
+    IMU_RW (IMU_REG_ACC_CONFIG, 7, imu_write_config),
+    IMU_RW (IMU_REG_INT_MSK, 2, NULL),                  /* any mode          */
+    IMU_RW (IMU_REG_ACC_AM_THRES, IMU_REG_UNIQUE_ID - IMU_REG_ACC_AM_THRES,
+            imu_write_config),
+    IMU_RO (IMU_REG_UNIQUE_ID, 0x80 - IMU_REG_UNIQUE_ID),
 };
 
-void imu_emulator_init(const struct device *i2c_dev)
-{
-    memset(imu_buf, 0, sizeof(imu_buf));
-    atomic_set(&active_idx, 0);
+static const struct hil_reg_page imu_pages[] = {
+    { imu_page0_rows, ARRAY_SIZE(imu_page0_rows) },
+    { imu_page1_rows, ARRAY_SIZE(imu_page1_rows) },
+};
 
-    if (!device_is_ready(i2c_dev)) {
-        LOG_ERR("IMU I2C device not ready");
-        return;
-    }
-    if (i2c_target_register(i2c_dev, &imu_config) < 0) {
-        LOG_ERR("Failed to register IMU at 0x%02X", IMU_ADDRESS);
-        return;
+static const struct hil_regemu_desc imu_desc = {
+    .pages    = imu_pages,
+    .n_pages  = ARRAY_SIZE(imu_pages),
+    .unmapped = 0x00,
+    .on_read  = imu_on_read,
+    .on_pin   = imu_on_pin,
+};
+
+_Static_assert(IMU_PAGE_SIZE == HIL_REGEMU_REGS, "BNO055 page is 128 registers");
+
+/* ── Public API ──────────────────────────────────────────────────────────── */
+struct i2c_emulator *imu_emulator_init(uint8_t instance, const struct device *i2c_dev,
+                                       uint16_t address)
+{
+    if (instance >= HIL_PKT_IMUS) {
+        LOG_ERR("IMU%u: only %u instance(s) configured", instance, HIL_PKT_IMUS);
+        return NULL;
     }
-    LOG_INF("IMU target registered at 0x%02X", IMU_ADDRESS);
+
+    struct imu_dev *d = &imu_devs[instance];
+    uint8_t *const images[] = { d->regs[0], d->regs[1] };
+
+    k_timer_init(&d->switch_timer, imu_switch_done, NULL);
+    i2c_emulator_init(&d->em, "IMU", &imu_desc, images, HIL_REC_IMU, instance);
+    imu_regs_reset(d);
+    d->regs[0][IMU_REG_OPR_MODE] = CONFIG_HIL_IMU_BOOT_MODE;
+    imu_view_apply(d, imu_target_mode(d));
+    i2c_emulator_register(&d->em, i2c_dev, address);
+    return &d->em;
 }
@@ -2,110 +2,212 @@
  * @file imu_emulator.h
  * @brief Emulates a BNO055 IMU as an I2C target device.
  *
- * Synchronisation strategy: Ping-Pong Double Buffer
- * ──────────────────────────────────────────────────
- * Two complete copies of the 18-byte imu_data_t register image are kept.
- * At any moment one buffer is "active" (safe for the I2C ISR to read) and
- * the other is "inactive" (safe for the sensor thread to write).
- *
- * Write path  (sensor emulation thread — thread context only):
- *   1. inactive = 1 - atomic_get(&active_idx)
- *   2. memcpy new imu_data_t into imu_buf[inactive]
- *   3. __DMB()  — drain Cortex-M store buffer before publishing
- *   4. atomic_set(&active_idx, inactive)  — flip; new buffer is now active
- *
- * Read path  (I2C target callbacks — ISR context):
- *   read_requested_cb:   snap = atomic_get(&active_idx)   ← snapshot ONCE
- *   read_processed_cb:   serve bytes from imu_buf[snap]   ← same snapshot
- *   stop_cb:             reset register pointer
+ * The emulator is a register map for the shared table-driven I2C target
+ * (threads/i2c_emulator_test.h, hil_core/regemu.h); this file only holds the
+ * BNO055-specific parts — the map, the reset image and the side effects of
+ * writes.
+ *
+ * Synchronisation strategy: refcounted pool snapshot
+ * ───────────────────────────────────────────────────
+ * The output data block is never copied.  Its map rows are SNAP rows over
+ * the instance's imu[] record of the packet the engine pins in packet_pool
+ * (hil_core/pool.h):
+ *
+ *   i2c_emulator_publish(em, idx)  injection ISR: get(idx), swap active, put(old)
+ *   read_requested              I2C ISR: pin active for the transaction
+ *   read_processed              serve bytes from the pinned slot
+ *   stop                        put(pin)
  *
  * Guarantees:
- *   • No struct tearing — ISR reads a single coherent 18-byte snapshot.
+ *   • No struct tearing — a pinned slot cannot be reused, so a transaction
+ *     reads one coherent image however many packets are published meanwhile.
  *   • No blocking       — zero mutexes or spinlocks in the ISR path.
- *   • No starvation     — writer never waits for a reader to finish.
- *
- * Known residual race (double-write):
- *   If the sensor thread writes twice between one read_requested_cb and its
- *   matching stop_cb, the second write lands on the buffer the ISR is
- *   currently reading (because flip #1 made it inactive, flip #2 made it
- *   active again, flip #3 makes it inactive again — now the writer targets
- *   the ISR's buffer).  At 400 kHz I2C (18 bytes ≈ 405 µs per transaction)
- *   and 500 µs sensor thread sleep, this window is narrow but non-zero.
- *   See ANALYSIS.md §W2 for the triple-buffer mitigation.
- *
- * BNO055 register map (subset emulated)
- * ──────────────────────────────────────
- *   0x14 – 0x19   GYR_DATA_X/Y/Z   (gyro,  6 bytes)
- *   0x1A – 0x1F   EUL_DATA_X/Y/Z   (euler, 6 bytes)
- *   0x20 – 0x27   QUA_DATA_W/X/Y/Z (quaternion — NOT emulated, returns 0xFF)
- *   0x28 – 0x2D   LIA_DATA_X/Y/Z   (linear accel, 6 bytes)
- *
- * The DUT must issue separate read transactions for register groups that
- * are not contiguous (e.g. euler then linear_accel — there is an 8-byte
- * quaternion gap between 0x1F and 0x28).
+ *   • No starvation     — the writer never waits for a reader to finish.
+ *
+ * Every pin records the age of the pinned packet (HIL_HIST_IMU_AGE).
+ *
+ * BNO055 register map — full page 0 and page 1
+ * ─────────────────────────────────────────────
+ * Two 128-byte images, kept in BNO055 register order and preloaded with the
+ * datasheet reset values (CHIP_ID 0xA0, sub-chip IDs, revisions, SIC
+ * matrix, page-1 sensor config), so the flight controller's unmodified
+ * bno055 driver can run its init sequence against the emulator.
+ *
+ *   page 0  0x00 – 0x07   IDs, revisions, PAGE_ID        static image
+ *           0x08 – 0x33   ACC … GRV output data          pool slot imu[instance]
+ *           0x34 – 0x7F   TEMP, status, config, offsets  static image
+ *   page 1  0x00 – 0x7F   sensor config, UNIQUE_ID       static image
+ *
+ * PAGE_ID (0x07 on both pages) selects the page.
+ *
+ * Instances
+ * ─────────
+ * Up to HIL_PKT_IMUS BNO055s, each with its own images, mode and switch
+ * timer, serving imu[instance] of every packet that carries it.  A BNO055
+ * answers at 0x28 (COM3 low) or 0x29 (COM3 high), so two fit on one bus.
+ *
+ * Register writes and operating modes
+ * ───────────────────────────────────
+ * Writes land in the image unless the register is read-only (IDs, output
+ * data, status, UNIQUE_ID) or locked: outside CONFIG mode only OPR_MODE,
+ * PAGE_ID, SYS_TRIGGER and the page-1 INT_MSK / INT_EN accept writes, as
+ * on the real part.  Side effects:
+ *
+ *   OPR_MODE     selects which output blocks are live (below); the new
+ *                mode takes effect after the datasheet switch time —
+ *                7 ms out of CONFIG, 19 ms into it — during which the
+ *                output data reads 0 and SYS_STATUS reads idle.
+ *   PWR_MODE     SUSPEND stops all output until NORMAL / LOW_POWER.
+ *   SYS_TRIGGER  RST_SYS reloads the reset image and reads CHIP_ID as 0
+ *                for the 650 ms boot time; SELF_TEST rewrites ST_RESULT;
+ *                RST_INT clears INT_STA; CLK_SEL is kept.  The
+ *                action bits read back as 0.
+ *
+ * Output selection per mode:
+ *   non-fusion (ACCONLY … AMG)  only the enabled raw sensors; EUL, QUA,
+ *                               LIA and GRV read 0; SYS_STATUS = 6
+ *   fusion (IMU … NDOF)         enabled raw sensors + all fusion outputs;
+ *                               SYS_STATUS = 5
+ *
+ * Each output block is its own map row gated by one bit; a mode switch
+ * stores that mode's block mask (one word) and the engine serves disabled
+ * blocks from zeros.
+ *
+ * Burst reads
+ * ───────────
+ * The engine's fast path: adjacent rows backed by adjacent memory form one
+ * run, served by pointer post-increment, so a burst may span any registers,
+ * e.g. 0x00 – 0x35 in one transaction, and only run boundaries go back
+ * through the (table-indexed) register decode.
  */
 
 #ifndef THREADS_IMU_EMULATOR_H
 #define THREADS_IMU_EMULATOR_H
 
 #include "threads/sensor_emulation_test.h"
+#include "threads/i2c_emulator_test.h"
 #include <zephyr/drivers/i2c.h>
 
-/* ── BNO055 register addresses (subset emulated) ──────────────────────────── */
-
-/* Gyroscope data — 6 bytes */
-#define IMU_REG_GYRO_X_LSB   0x14
-#define IMU_REG_GYRO_X_MSB   0x15
-#define IMU_REG_GYRO_Y_LSB   0x16
-#define IMU_REG_GYRO_Y_MSB   0x17
-#define IMU_REG_GYRO_Z_LSB   0x18
-#define IMU_REG_GYRO_Z_MSB   0x19
-
-/* Euler angles — 6 bytes */
-#define IMU_REG_EUL_X_LSB    0x1A
-#define IMU_REG_EUL_X_MSB    0x1B
-#define IMU_REG_EUL_Y_LSB    0x1C
-#define IMU_REG_EUL_Y_MSB    0x1D
-#define IMU_REG_EUL_Z_LSB    0x1E
-#define IMU_REG_EUL_Z_MSB    0x1F
-
-/* Quaternion 0x20–0x27 — NOT emulated, serve_imu_byte() returns 0xFF */
-
-/* Linear acceleration — 6 bytes */
-#define IMU_REG_LIA_X_LSB    0x28
-#define IMU_REG_LIA_X_MSB    0x29
-#define IMU_REG_LIA_Y_LSB    0x2A
-#define IMU_REG_LIA_Y_MSB    0x2B
-#define IMU_REG_LIA_Z_LSB    0x2C
-#define IMU_REG_LIA_Z_MSB    0x2D
+/* ── BNO055 registers ─────────────────────────────────────────────────────── */
 
-/* ── Public API ───────────────────────────────────────────────────────────── */
+#define IMU_PAGE_SIZE         128U
 
-/**
- * @brief Initialise the IMU emulator and register the I2C target at IMU_ADDRESS.
- *
- * Zero-fills both ping-pong buffers so the DUT reads plausible zeros before
- * the first physics packet arrives.
- *
- * @param i2c_dev  Zephyr I2C device handle (from DT_ALIAS(i2c_imu) in main.c).
- */
-void imu_emulator_init(const struct device *i2c_dev);
+/* Page 0 — identification */
+#define IMU_REG_CHIP_ID       0x00
+#define IMU_REG_ACC_ID        0x01
+#define IMU_REG_MAG_ID        0x02
+#define IMU_REG_GYR_ID        0x03
+#define IMU_REG_SW_REV_LSB    0x04
+#define IMU_REG_SW_REV_MSB    0x05
+#define IMU_REG_BL_REV        0x06
+#define IMU_REG_PAGE_ID       0x07   /**< both pages */
+
+/* Page 0 — output data (served from the pool slot, see imu_data_t) */
+#define IMU_REG_DATA_FIRST    HIL_IMU_DATA_REG_FIRST
+#define IMU_REG_GYRO_X_LSB    0x14
+#define IMU_REG_EUL_X_LSB     0x1A
+#define IMU_REG_EUL_X_MSB     0x1B
+#define IMU_REG_QUA_W_LSB     0x20
+#define IMU_REG_LIA_X_LSB     0x28
+#define IMU_REG_GRV_X_LSB     0x2E
+#define IMU_REG_DATA_END      HIL_IMU_DATA_REG_END
+
+/* Page 0 — status and configuration */
+#define IMU_REG_TEMP          0x34
+#define IMU_REG_CALIB_STAT    0x35
+#define IMU_REG_ST_RESULT     0x36
+#define IMU_REG_INT_STA       0x37
+#define IMU_REG_SYS_CLK_STAT  0x38
+#define IMU_REG_SYS_STATUS    0x39
+#define IMU_REG_SYS_ERR       0x3A
+#define IMU_REG_UNIT_SEL      0x3B
+#define IMU_REG_OPR_MODE      0x3D
+#define IMU_REG_PWR_MODE      0x3E
+#define IMU_REG_SYS_TRIGGER   0x3F
+#define IMU_REG_TEMP_SOURCE   0x40
+#define IMU_REG_AXIS_MAP_CONFIG 0x41
+#define IMU_REG_AXIS_MAP_SIGN 0x42
+#define IMU_REG_SIC_MATRIX    0x43   /**< 9 × int16, 0x43 – 0x54 */
+#define IMU_REG_ACC_RADIUS_LSB 0x67
+#define IMU_REG_MAG_RADIUS_LSB 0x69
+
+/* Page 1 — sensor configuration */
+#define IMU_REG_ACC_CONFIG    0x08
+#define IMU_REG_MAG_CONFIG    0x09
+#define IMU_REG_GYR_CONFIG_0  0x0A
+#define IMU_REG_GYR_CONFIG_1  0x0B
+#define IMU_REG_ACC_AM_THRES  0x11
+#define IMU_REG_ACC_INT_SET   0x12
+#define IMU_REG_ACC_HG_DUR    0x13
+#define IMU_REG_ACC_HG_THRES  0x14
+#define IMU_REG_ACC_NM_THRES  0x15
+#define IMU_REG_ACC_NM_SET    0x16
+#define IMU_REG_GYR_HR_X_SET  0x18   /**< HR_SET / DUR pairs for X, Y, Z */
+#define IMU_REG_GYR_AM_THRES  0x1E
+#define IMU_REG_GYR_AM_SET    0x1F
+#define IMU_REG_INT_MSK       0x0F
+#define IMU_REG_INT_EN        0x10
+#define IMU_REG_UNIQUE_ID     0x50   /**< 16 bytes, 0x50 – 0x5F */
+
+/* OPR_MODE values */
+#define IMU_MODE_CONFIG       0x00
+#define IMU_MODE_ACCONLY      0x01
+#define IMU_MODE_MAGONLY      0x02
+#define IMU_MODE_GYRONLY      0x03
+#define IMU_MODE_ACCMAG       0x04
+#define IMU_MODE_ACCGYRO      0x05
+#define IMU_MODE_MAGGYRO      0x06
+#define IMU_MODE_AMG          0x07
+#define IMU_MODE_IMU          0x08
+#define IMU_MODE_COMPASS      0x09
+#define IMU_MODE_M4G          0x0A
+#define IMU_MODE_NDOF_FMC_OFF 0x0B
+#define IMU_MODE_NDOF         0x0C
+#define IMU_MODE_MASK         0x0F
+
+/* PWR_MODE values */
+#define IMU_PWR_NORMAL        0x00
+#define IMU_PWR_LOW_POWER     0x01
+#define IMU_PWR_SUSPEND       0x02
+
+/* SYS_TRIGGER bits */
+#define IMU_TRIG_SELF_TEST    BIT(0)
+#define IMU_TRIG_RST_SYS      BIT(5)
+#define IMU_TRIG_RST_INT      BIT(6)
+#define IMU_TRIG_CLK_SEL      BIT(7)
+
+/* SYS_STATUS values */
+#define IMU_SYS_IDLE          0x00
+#define IMU_SYS_FUSION        0x05
+#define IMU_SYS_NO_FUSION     0x06
+
+/* Datasheet timings (ms) */
+#define IMU_SWITCH_FROM_CONFIG_MS  7
+#define IMU_SWITCH_TO_CONFIG_MS    19
+#define IMU_RESET_MS               650
+
+/* Reset values */
+#define IMU_CHIP_ID           0xA0
+#define IMU_ACC_ID            0xFB
+#define IMU_MAG_ID            0x32
+#define IMU_GYR_ID            0x0F
+
+/* ── Public API ───────────────────────────────────────────────────────────── */
 
 /**
- * @brief Write a new IMU state into the inactive ping-pong buffer and publish it.
- *
- * After this call returns, the I2C ISR will read the new data on the next
- * transaction (or the current one, if a flip races with an ongoing read —
- * see the double-write note in the file header).
+ * @brief Initialise IMU instance and register its I2C target at address.
  *
- * @param new_data  Pointer to a complete, valid imu_data_t.  The contents
- *                  are copied into the inactive buffer; the caller may free
- *                  or reuse new_data immediately after this call returns.
+ * Loads the reset values into both register pages.  Until the first physics
+ * packet carrying imu[instance] is published the output data block reads
+ * as zeros.
  *
- * @note MUST be called from thread context only.  memcpy of 18 bytes is not
- *       safe from ISR context because it is not guaranteed to be atomic and
- *       may be preempted mid-copy on some Cortex-M implementations.
+ * @param instance  record index in device_update_packet_t.imu, < HIL_PKT_IMUS.
+ * @param i2c_dev   Zephyr I2C device handle (from DT_ALIAS(i2c_imu) in main.c).
+ * @param address   7-bit target address (IMU_ADDRESS / IMU_ADDRESS_ALT).
+ * @return the instance's emulator, to publish to, or NULL if instance is
+ *         out of range.
  */
-void imu_emulator_update_data(const imu_data_t *new_data);
+struct i2c_emulator *imu_emulator_init(uint8_t instance, const struct device *i2c_dev,
+                                       uint16_t address);
 
 #endif /* THREADS_IMU_EMULATOR_H */
@@ -2,26 +2,32 @@
  * @file lidar_emulator.h
  * @brief Emulates a LIDAR-Lite v3 distance sensor as an I2C target device.
  *
- * Synchronisation strategy: atomic_t backing store + per-transaction snapshot
+ * The emulator is a four-row register map for the shared table-driven I2C
+ * target (threads/i2c_emulator_test.h, hil_core/regemu.h).
+ *
+ * Synchronisation strategy: latched pool snapshot
  * ─────────────────────────────────────────────────────────────────────────────
- * The simulated distance is held in a 32-bit atomic_t (lower 16 bits used).
- * The sensor emulation thread writes with atomic_set(); the I2C ISR reads
- * with atomic_get().  Both operations are single LDREX/STREX instructions on
- * Cortex-M — fully atomic, no masking required.
+ * The distance is served straight from the instance's range_mm[] record of
+ * the packet in packet_pool (hil_core/pool.h) the engine has pinned — the
+ * same scheme as the IMU, with no copy of the distance.
  *
- * Two-byte tearing prevention (transaction snapshot cache):
+ * Two-byte tearing prevention:
  *   LIDAR-Lite distance spans two consecutive registers:
  *     0x0F  FULL_DELAY_HIGH  — MSB, DUT reads this FIRST
  *     0x10  FULL_DELAY_LOW   — LSB, DUT reads this SECOND
  *
- *   If the backing atomic were read independently for each byte, a write
+ *   If the published packet were read independently for each byte, a publish
  *   between the two reads would produce a corrupted measurement (MSB from
  *   distance N, LSB from distance N+1).
  *
- *   Fix: the ISR freezes the distance into transaction_distance_cache when
- *   it serves FULL_DELAY_HIGH (the first byte of the pair).  The LOW byte
- *   is then served from this frozen cache — both bytes always belong to the
- *   same sample, regardless of how many writes occur in between.
+ *   Fix: FULL_DELAY_HIGH is a HIL_REG_LATCH row.  Reading it pins the
+ *   active packet, and the pin is held until the next HIGH read — so LOW
+ *   belongs to the same sample even when the DUT reads the pair in two
+ *   transactions.  Each latch records the sample's age into
+ *   HIL_HIST_LIDAR_AGE.
+ *
+ * Register addresses wrap at 7 bits, so the v3 auto-increment form 0x8F
+ * reads the same pair as 0x0F.
  *
  * LIDAR-Lite v3 measurement sequence (as performed by the DUT)
  * ─────────────────────────────────────────────────────────────
@@ -37,14 +43,18 @@
  *   0x00 (bit 0 = 0, "ready").  ACQ_COMMAND writes are silently absorbed.
  *
  * Emulation of steps 4–6:
- *   read_requested_cb serves HIGH and snapshots the cache.
- *   read_processed_cb auto-increments the register pointer to LOW and serves
- *   from the same frozen cache.
+ *   The HIGH read latches the snapshot; the engine auto-increments to LOW
+ *   and serves it from the same pinned packet.
+ *
+ * Instances: up to HIL_PKT_RANGES, one per range_mm[] record, each at its
+ * own address (the v3's I2C_ID registers let the DUT move it off 0x62).
  */
 
 #ifndef THREADS_LIDAR_EMULATOR_H
 #define THREADS_LIDAR_EMULATOR_H
 
+#include "threads/i2c_emulator_test.h"
+
 #include <zephyr/drivers/i2c.h>
 #include <stdint.h>
 
@@ -59,32 +69,25 @@
 /** Distance MSB — snapshot point.  Read this first. */
 #define LIDAR_REG_FULL_DELAY_HIGH  0x0F
 
-/** Distance LSB — served from frozen snapshot cache.  Read this second. */
+/** Distance LSB — served from the latched snapshot.  Read this second. */
 #define LIDAR_REG_FULL_DELAY_LOW   0x10
 
 /* ── Public API ───────────────────────────────────────────────────────────── */
 
 /**
- * @brief Initialise the LiDAR emulator and register the I2C target.
- *
- * Clears the backing store and snapshot cache to 0, then calls
- * i2c_target_register() on i2c_dev at address LIDAR_ADDRESS (0x62).
- *
- * @param i2c_dev  Zephyr I2C device handle (from DT_ALIAS(i2c_lidar) in main.c).
- */
-void lidar_emulator_init(const struct device *i2c_dev);
-
-/**
- * @brief Update the simulated distance.
- *
- * Writes new_distance_mm into the atomic backing store.  The I2C ISR will
- * serve this value (or a later one) on the DUT's next measurement read.
+ * @brief Initialise LiDAR instance and register its I2C target at address.
  *
- * This function is ISR-safe — atomic_set() is a single STREX instruction.
- * It may be called from either thread or ISR context.
+ * Until the first packet carrying range_mm[instance] is published the
+ * distance reads as 0.
  *
- * @param new_distance_mm  Distance in millimetres (0 – 65535).
+ * @param instance  record index in device_update_packet_t.range_mm,
+ *                  < HIL_PKT_RANGES.
+ * @param i2c_dev   Zephyr I2C device handle (from DT_ALIAS(i2c_lidar) in main.c).
+ * @param address   7-bit target address (LIDAR_ADDRESS is the v3 default).
+ * @return the instance's emulator, to publish to, or NULL if instance is
+ *         out of range.
  */
-void lidar_emulator_update_distance(uint16_t new_distance_mm);
+struct i2c_emulator *lidar_emulator_init(uint8_t instance, const struct device *i2c_dev,
+                                         uint16_t address);
 
 #endif /* THREADS_LIDAR_EMULATOR_H */
@@ -1,71 +1,110 @@
 #include "pwm.h"
+#include "threads/scheduler_test.h"
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/pwm.h>
 #include <zephyr/logging/log.h>
 
-LOG_MODULE_REGISTER(pwm_thread, LOG_LEVEL_INF);
+LOG_MODULE_REGISTER(pwm_capture, LOG_LEVEL_INF);
 
-const struct device *pwm_input_dev1 = DEVICE_DT_GET(DT_ALIAS(pwm_input1));
-const struct device *pwm_input_dev2 = DEVICE_DT_GET(DT_ALIAS(pwm_input2));
-const struct device *pwm_input_dev3 = DEVICE_DT_GET(DT_ALIAS(pwm_input3));
-const struct device *pwm_input_dev4 = DEVICE_DT_GET(DT_ALIAS(pwm_input4));
+struct pwm_input {
+    const struct device *dev;
+    uint64_t cycles_per_sec;
+    uint8_t motor;
+};
+
+static struct pwm_input pwm_inputs[HIL_MOTORS] = {
+    { .dev = DEVICE_DT_GET(DT_ALIAS(pwm_input1)), .motor = 0 },
+    { .dev = DEVICE_DT_GET(DT_ALIAS(pwm_input2)), .motor = 1 },
+    { .dev = DEVICE_DT_GET(DT_ALIAS(pwm_input3)), .motor = 2 },
+    { .dev = DEVICE_DT_GET(DT_ALIAS(pwm_input4)), .motor = 3 },
+};
 const struct device *pwm_output_dev = NULL; // TODO: assign correct device
 
-K_THREAD_STACK_DEFINE(pwm_stack, PWM_STACK_SIZE);
-struct k_thread pwm_thread_data;
-
-void pwm_thread(void*, void*, void*) {
-    uint64_t pwm_period1;
-    uint64_t pwm_pulse1;
-    uint64_t pwm_period2;
-    uint64_t pwm_pulse2;
-    uint64_t pwm_period3;
-    uint64_t pwm_pulse3;
-    uint64_t pwm_period4;
-    uint64_t pwm_pulse4;
-
-    while(1) {
-        if(pwm_capture_usec(pwm_input_dev1, 0, &pwm_period1, &pwm_pulse1) == 0 &&
-           pwm_capture_usec(pwm_input_dev2, 0, &pwm_period2, &pwm_pulse2) == 0 &&
-           pwm_capture_usec(pwm_input_dev3, 0, &pwm_period3, &pwm_pulse3) == 0 &&
-           pwm_capture_usec(pwm_input_dev4, 0, &pwm_period4, &pwm_pulse4) == 0) {
-            // dummy printing for sanity
-            LOG_INF("PWM captured: period = %llu us, pulse = %llu us", pwm_period, pwm_pulse);
-
-            double duty_cycle1 = (double)pwm_pulse1 / (double)pwm_period1;
-            double avg_voltage1 = duty_cycle1 * VOLTAGE_HIGH;
-            double duty_cycle2 = (double)pwm_pulse2 / (double)pwm_period2;
-            double avg_voltage2 = duty_cycle2 * VOLTAGE_HIGH;
-            double duty_cycle3 = (double)pwm_pulse3 / (double)pwm_period3;
-            double avg_voltage3 = duty_cycle3 * VOLTAGE_HIGH;
-            double duty_cycle4 = (double)pwm_pulse4 / (double)pwm_period4;
-            double avg_voltage4 = duty_cycle4 * VOLTAGE_HIGH;
-            
-            // eventually, we will send the output on the output device, but we don't
-            // have the output device set up yet
-        } else {
-            LOG_ERR("Failed to capture PWM signal");
-        }
+// All-zero is a valid empty state, so the sample calls below work even if
+// pwm_init() failed.
+static struct hil_motor motor_samples;
+
+// Samples sent to the Pi: committed, and tentative until the transfer succeeds.
+static uint32_t sent_cursor;
+static uint32_t sent_lost;
+static uint32_t next_cursor;
+static uint32_t next_lost;
+
+// Capture ISR, once per PWM period per input.
+static void pwm_capture_cb(const struct device *dev, uint32_t channel,
+                           uint32_t period_cycles, uint32_t pulse_cycles,
+                           int status, void *user_data) {
+    ARG_UNUSED(dev);
+    ARG_UNUSED(channel);
+    const struct pwm_input *in = user_data;
+
+    if (status != 0) {
+        // No sample from this motor; the next aligned sample marks it stale.
+        return;
     }
+
+    uint32_t now_us = scheduler_now_us();
+    uint64_t period_us = (uint64_t)period_cycles * USEC_PER_SEC / in->cycles_per_sec;
+    uint16_t duty = hil_motor_duty_q16(pulse_cycles, period_cycles);
+
+    // The four timer IRQs may differ in priority; the merge must not nest.
+    unsigned int key = irq_lock();
+    hil_motor_on_capture(&motor_samples, in->motor, duty,
+                         (uint16_t)MIN(period_us, UINT16_MAX), now_us);
+    irq_unlock(key);
 }
 
-void pwm_init() {
-    if (!device_is_ready(pwm_input_dev1) ||
-        !device_is_ready(pwm_input_dev2) ||
-        !device_is_ready(pwm_input_dev3) ||
-        !device_is_ready(pwm_input_dev4)) {
-        LOG_ERR("PWM input device is not ready");
-        return;
+size_t pwm_samples_peek(struct hil_motor_sample *out, size_t max, uint32_t *lost) {
+    next_cursor = sent_cursor;
+    next_lost = sent_lost;
+    size_t n = hil_motor_read(&motor_samples, &next_cursor, out, max, &next_lost);
+
+    *lost = next_lost;
+    return n;
+}
+
+void pwm_samples_commit(void) {
+    sent_cursor = next_cursor;
+    sent_lost = next_lost;
+}
+
+bool pwm_samples_latest(struct hil_motor_sample *out) {
+    return hil_motor_latest(&motor_samples, out);
+}
+
+int pwm_init(void) {
+    hil_motor_init(&motor_samples);
+
+    for (size_t i = 0; i < ARRAY_SIZE(pwm_inputs); i++) {
+        struct pwm_input *in = &pwm_inputs[i];
+
+        if (!device_is_ready(in->dev)) {
+            LOG_ERR("PWM input %u is not ready", in->motor + 1);
+            return -ENODEV;
+        }
+        int ret = pwm_get_cycles_per_sec(in->dev, PWM_CAPTURE_CHANNEL, &in->cycles_per_sec);
+        if (ret == 0 && in->cycles_per_sec == 0) {
+            ret = -EINVAL;
+        }
+        if (ret == 0) {
+            ret = pwm_configure_capture(in->dev, PWM_CAPTURE_CHANNEL, PWM_CAPTURE_FLAGS,
+                                        pwm_capture_cb, in);
+        }
+        if (ret < 0) {
+            LOG_ERR("PWM input %u: capture setup failed: %d", in->motor + 1, ret);
+            return ret;
+        }
     }
 
-    if(!device_is_ready(pwm_output_dev)) {
-        LOG_ERR("PWM output device is not ready");
-        return;
+    // Start all four back to back so their first periods line up.
+    for (size_t i = 0; i < ARRAY_SIZE(pwm_inputs); i++) {
+        int ret = pwm_enable_capture(pwm_inputs[i].dev, PWM_CAPTURE_CHANNEL);
+        if (ret < 0) {
+            LOG_ERR("PWM input %u: capture start failed: %d", (unsigned int)i + 1, ret);
+            return ret;
+        }
     }
 
-    k_thread_create(&pwm_thread_data, pwm_stack, 
-                    K_THREAD_STACK_SIZEOF(pwm_stack),
-                    pwm_thread, 
-                    NULL, NULL, NULL,
-                    PWM_PRIORITY, 0, K_NO_WAIT);
-}
\ No newline at end of file
+    LOG_INF("PWM capture running on %u inputs", HIL_MOTORS);
+    return 0;
+}
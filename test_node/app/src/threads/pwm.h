@@ -1,21 +1,35 @@
 #ifndef PWM_H
 #define PWM_H
 #include <zephyr/drivers/pwm.h>
+#include "hil_core/motor.h"
 
-#define PWM_STACK_SIZE (10 * 1024)
-#define PWM_PRIORITY 5
-#define VOLTAGE_HIGH 3.3
 #define PWM_CAPTURE_CHANNEL 1
-#define PWM_CAPTURE_FLAGS PWM_CAPTURE_TYPE_BOTH
-#define PWM_CAPTURE_TIMEOUT K_USEC(1500) // 1.5 ms timeout for capture (longer than expected period to avoid spurious timeouts)
+#define PWM_CAPTURE_FLAGS (PWM_CAPTURE_TYPE_BOTH | PWM_CAPTURE_MODE_CONTINUOUS)
 
 /*
 * NOTE: the currently defined PWM period on DUT's end is 1ms (1 kHz frequency)
 *  in the future, this means that FS can read at most 1kHz, but probably slightly slower because the period isn't perfect
 *  and other calculations + setup require cycles.
 *
+* All four inputs (aliases pwm-input1..4) capture continuously in hardware;
+* each period ends in a capture interrupt that turns it into a Q0.16 duty.
+* hil_core/motor.h merges the four into one time-aligned sample per ESC
+* update and queues it; the scheduler sends the queue to the Pi in its MISO
+* status frame (hil_core/miso.h), in the same transfer that brings the next
+* SensorPacket in.
+*
+* Needs CONFIG_PWM and CONFIG_PWM_CAPTURE.
 */
 
-void pwm_init();
+int pwm_init(void);
+
+// Scheduler thread only.  Peek copies up to max samples not yet sent and
+// the running lost count; commit once the transfer carrying them succeeded.
+// Without a commit the next peek returns the same samples again.
+size_t pwm_samples_peek(struct hil_motor_sample *out, size_t max, uint32_t *lost);
+void pwm_samples_commit(void);
+
+// Newest sample, sent or not.  False until the first one.
+bool pwm_samples_latest(struct hil_motor_sample *out);
 
-#endif
\ No newline at end of file
+#endif
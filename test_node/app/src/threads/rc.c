@@ -1,36 +1,83 @@
 #include "threads/rc.h"
-#include "threads/sensor_emulation.h" 
+#include "hil_diag.h"
+#include "hil_trace.h"
 #include <zephyr/drivers/uart.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/ring_buffer.h>
 
 // register logging module
 LOG_MODULE_REGISTER(rc_thread, LOG_LEVEL_INF);
 static const struct device* uart_dev;
 
+// Producers: the alarm ISR (and rc_init).  Consumer: the UART TX ISR.
+RING_BUF_DECLARE(rc_tx_ring, RC_TX_BUF_SIZE);
+static struct k_spinlock rc_tx_lock;
+
+// UART interrupt: move as much of the ring into the TX FIFO as it takes,
+// and switch the TX interrupt off once the ring is empty.
+static void rc_uart_isr(const struct device* dev, void* user_data) {
+    ARG_UNUSED(user_data);
+
+    if (!uart_irq_update(dev) || !uart_irq_tx_ready(dev)) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&rc_tx_lock);
+    uint8_t* data;
+    uint32_t len = ring_buf_get_claim(&rc_tx_ring, &data, RC_TX_BUF_SIZE);
+
+    if (len == 0) {
+        uart_irq_tx_disable(dev);
+    } else {
+        int sent = uart_fifo_fill(dev, data, (int)len);
+        ring_buf_get_finish(&rc_tx_ring, sent > 0 ? (uint32_t)sent : 0);
+    }
+    k_spin_unlock(&rc_tx_lock, key);
+}
+
+// Whole commands only: a partial one would desync the DUT's parser.
+static bool rc_queue(const uint8_t cmd[RC_CMD_LEN]) {
+    k_spinlock_key_t key = k_spin_lock(&rc_tx_lock);
+    bool fits = ring_buf_space_get(&rc_tx_ring) >= RC_CMD_LEN;
+
+    if (fits) {
+        ring_buf_put(&rc_tx_ring, cmd, RC_CMD_LEN);
+    }
+    k_spin_unlock(&rc_tx_lock, key);
+
+    if (fits) {
+        uart_irq_tx_enable(uart_dev);
+    }
+    return fits;
+}
+
 bool rc_command_received(rc_data_t command) {
     // check to ensure all of the characters in the command are valid (F/B/L/R for horiz, U/D for vert)
-    if((command.rc_horiz != 'F' && command.rc_horiz != 'B' && command.rc_horiz != 'L' && command.rc_horiz != 'R' && command.rc_horiz != 'I') || 
+    if(uart_dev == NULL ||
+       (command.rc_horiz != 'F' && command.rc_horiz != 'B' && command.rc_horiz != 'L' && command.rc_horiz != 'R' && command.rc_horiz != 'I') ||
        (command.rc_vert != 'U' && command.rc_vert != 'D' && command.rc_vert != 'I')) {
-        LOG_ERR("Invalid RC command received: horiz = %c, vert = %c", command.rc_horiz, command.rc_vert);
+        hil_diag_inc_rc_drop();
         return false;
     }
-    // store latest command in atomic variable
-    // atomic_set(&latest_rc_command, (atomic_t));
-    // send the command over the UART interface
     // 'I' means idle
     // order should (i think) be 1. [U/D] 2. [L/R] 3. [F/B]
-
-    uart_poll_out(uart_dev, command.rc_vert);
+    uint8_t cmd[RC_CMD_LEN] = { (uint8_t)command.rc_vert };
 
     if(command.rc_horiz == 'F' || command.rc_horiz == 'B') {
-        uart_poll_out(uart_dev, 'I');
-        uart_poll_out(uart_dev, command.rc_horiz);
+        cmd[1] = 'I';
+        cmd[2] = (uint8_t)command.rc_horiz;
     } else {
-        uart_poll_out(uart_dev, command.rc_horiz);
-        uart_poll_out(uart_dev, 'I');
+        cmd[1] = (uint8_t)command.rc_horiz;
+        cmd[2] = 'I';
     }
 
-    return true;
+    bool queued = rc_queue(cmd);
+
+    HIL_TRACE(RC_TX, command.rc_vert, command.rc_horiz, queued);
+    if (!queued) {
+        hil_diag_inc_rc_drop();
+    }
+    return queued;
 }
 
 int rc_init(const struct device* dev) {
@@ -40,11 +87,17 @@ int rc_init(const struct device* dev) {
         return -1;
     }
 
-    // send an initial UP command to DUT to start in hover state
-    uart_poll_out(dev, 'U');
-    uart_poll_out(dev, 'I');
-    uart_poll_out(dev, 'I');
-
+    int ret = uart_irq_callback_user_data_set(dev, rc_uart_isr, NULL);
+    if (ret < 0) {
+        LOG_ERR("UART for RC has no interrupt-driven API: %d", ret);
+        return ret;
+    }
+    uart_irq_rx_disable(dev);
+    uart_irq_tx_disable(dev);
     uart_dev = dev;
+
+    // send an initial UP command to DUT to start in hover state
+    static const uint8_t hover[RC_CMD_LEN] = { 'U', 'I', 'I' };
+    (void)rc_queue(hover);
     return 0;
 }
@@ -1,8 +1,26 @@
 #ifndef RC_H
 #define RC_H
 #include <zephyr/kernel.h>
-#include "threads/sensor_emulation.h"
+#include "hil_core/packet.h"
 
+/*
+ * RC commands go to the DUT as 3-byte UART commands: [U/D/I] then the
+ * horizontal pair ([L/R] I or I [F/B]).  rc_data_t carries these letters;
+ * 'I' means idle on that axis.
+ *
+ * rc_command_received() never waits on the UART.  It queues the whole
+ * command on a TX ring and returns; the UART TX interrupt drains the ring.
+ * The injection alarm ISR calls it from sensor_emulation_post(), so a
+ * command leaves at its packet's timestamp like the IMU/LiDAR data does.
+ *
+ * Needs CONFIG_UART_INTERRUPT_DRIVEN.
+ */
+
+#define RC_CMD_LEN         3
+#define RC_TX_BUF_SIZE     64   // ~21 queued commands; the UART drains one in ~260 us at 115200
+
+// Queue command for the DUT.  ISR-safe, non-blocking.  Returns false (and
+// counts a drop) if the command is invalid, the ring is full or rc_init failed.
 bool rc_command_received(rc_data_t command);
 int rc_init(const struct device* dev);
 
@@ -1,83 +1,151 @@
 /**
  * @file scheduler.c
- * @brief Scheduler thread: SPI receive, protobuf decode, and timer-based
- *        causality gating of physics engine updates.
+ * @brief Scheduler thread: SPI receive, SensorPacket decode (hil_core), and
+ *        hardware-counter causality gating of physics engine updates.
  *
- * SPI approach — synchronous spi_read() in a dedicated thread
- * ────────────────────────────────────────────────────────────
+ * SPI approach — synchronous spi_transceive() in a dedicated thread
+ * ──────────────────────────────────────────────────────────────────
  * The STM32 SPI driver (spi_ll_stm32.c) does not reliably support async
  * transfers in slave mode — it uses a 1-second timeout internally and
  * reconfigures the peripheral on every transaction, making spi_read_signal /
  * spi_read_async unsuitable.
  *
- * Instead we call blocking spi_read() from a dedicated Zephyr thread.
+ * Instead we call blocking spi_transceive() from a dedicated Zephyr thread.
  * While this thread sleeps waiting for the Pi to clock in a frame, Zephyr's
- * scheduler runs all other threads (sensor emulation, I2C ISRs, timer ISR)
+ * scheduler runs all other threads (sensor emulation, I2C ISRs, alarm ISR)
  * normally.  There is no system-wide block.
  *
- * The re-arm gap (window where a Pi frame can be missed) equals the protobuf
- * decode time ≈ 15–30 µs at 240 MHz.  At a Pi send rate of 20–100 Hz this
- * is a 0.03–0.3% miss window — acceptable for HIL.
+ * The re-arm gap (window where a Pi frame can be missed) is the time from
+ * spi_transceive() returning to the next call: hil_sched_on_frame() (the
+ * hand-written SensorPacket decode and the ring push) plus the MISO fill.
+ * hil_replay reports the on_frame part on the host; on target the whole gap
+ * is a few µs, far below the Pi frame period, so a missed frame is rare
+ * enough for HIL.
+ *
+ * MISO — node status back to the Pi
+ * ─────────────────────────────────
+ * Every transfer is full duplex: while the Pi clocks the next SensorPacket
+ * in, tx_buf goes out as a status frame (hil_core/miso.h) with the motor
+ * PWM samples captured since the last transfer (pwm.h), the newest sample,
+ * the hil_diag counters and two node timestamps.  tx_buf is filled just
+ * before the transfer is armed, so a sample waits at most one frame
+ * period; one frame carries HIL_MISO_MAX_SAMPLES of them, so the Pi must
+ * clock at least ESC rate / HIL_MISO_MAX_SAMPLES frames per second or the
+ * oldest are lost (and counted).  Samples are only consumed once their
+ * transfer succeeded.
+ *
+ * rx_done_us in the status is when the previous successful transfer
+ * returned here, read right after spi_transceive() as 64-bit time
+ * (scheduler_now_us64()).  The Pi pairs it with its own end time of that
+ * transfer; its clock servo tracks offset and skew from those pairs, so
+ * no sync handshake is needed and drift is followed for the whole run.
  *
  * Packet model — combined frame
  * ──────────────────────────────
  * Every SPI frame contains IMU + LiDAR + RC together.  There is no sensor_id
  * tag and no union.  All fields in device_update_packet_t are always valid.
  *
+ * Core / shim split
+ * ────────────────
+ * Framing, decode, the staging ring and alarm arming live in the
+ * hardware-independent core (lib/hil_core, see hil_core/sched.h) so they can
+ * be built and replayed on a host.  This file is the thin Zephyr shim: it
+ * owns the SPI device, the injection counter and the hand-off to the sensor
+ * thread, and exposes them to the core through struct hil_sched_port.
+ *
+ * Zero-copy
+ * ─────────
+ * Each frame is decoded once, straight from rx_buf into a packet_pool slot.
+ * The ring, the sensor thread mailbox and the emulators pass that slot's
+ * index around with a pool reference; nothing downstream copies the packet.
+ *
+ * Injection clock — absolute counter alarms
+ * ─────────────────────────────────────────
+ * A k_timer rounds every delay up to whole system ticks and, armed with a
+ * delay computed from now, adds the ISR entry latency of the previous
+ * expiry to the next one.  Instead a free-running 32-bit hardware counter
+ * (alias injection-counter, TIM5 on the H563) runs at exactly 1 MHz, so one
+ * counter tick is one µs and the counter value IS the STM32 epoch: it wraps
+ * at 2^32 µs exactly like packet.timestamp_us.  Alarms are set with
+ * COUNTER_ALARM_CFG_ABSOLUTE at the packet's timestamp, and with
+ * EXPIRE_WHEN_LATE plus a half-range guard period so a timestamp that is
+ * already behind fires at once instead of after a wrap.
+ *
  * Wire frame format (2-byte LE length prefix)
  * ────────────────────────────────────────────
  *   [LEN_LOW][LEN_HIGH][protobuf payload ... ][zero-pad to 256 bytes]
- *   Max payload = 254 bytes.
+ *   Max payload = 254 bytes.  See hil_core/frame.h.
  *
  * Clock sync
  * ──────────
- * packet.timestamp_us is in the STM32's k_cyc_to_us_near32 epoch.
- * main.c runs the SPI clock-sync handshake before this thread starts.
- * Set CONFIG_HIL_SKIP_CLOCK_SYNC=y in prj.conf to skip during bring-up.
+ * packet.timestamp_us is in the injection counter epoch (scheduler_now_us()).
+ * The counter starts at boot (SYS_INIT).  The Pi servos its model of this
+ * clock from the MISO status (see above) and sends the low 32 bits; alarms
+ * compare modulo 2^32, so the counter wrapping every 71.6 min is harmless.
  *
  * Required prj.conf options
  * ─────────────────────────
  *   CONFIG_SPI=y
  *   CONFIG_SPI_SLAVE=y
+ *   CONFIG_COUNTER=y
  *   CONFIG_LOG=y
- *   CONFIG_LOG_MODE_DEFERRED=y   (needed for LOG_DBG inside timer ISR)
+ *   CONFIG_LOG_MODE_DEFERRED=y   (text logs never format on the hot path)
+ *
+ * Hot-path logging
+ * ────────────────
+ * Every received frame and every injection is recorded with HIL_TRACE
+ * (binary, ISR-safe, see hil_trace.h) rather than LOG_*, so turning the
+ * trace on does not move the latencies the histograms measure.
  */
 
 #include "threads/scheduler_test.h"
 #include "threads/sensor_emulation_test.h"
+#include "threads/pwm.h"
 #include "hil_diag.h"
+#include "hil_trace.h"
 
-#include <sensor_data.pb.h>
-#include <pb_decode.h>
+#include "hil_core/clock.h"
+#include "hil_core/miso.h"
+#include "hil_core/sched.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/counter.h>
 #include <zephyr/drivers/spi.h>
 #include <zephyr/sys/atomic.h>
-#include <zephyr/sys/util.h>        /* CLAMP */
 #include <zephyr/logging/log.h>
 #include <string.h>
 #include <stdbool.h>
 
-LOG_MODULE_REGISTER(scheduler, LOG_LEVEL_DBG);
+LOG_MODULE_REGISTER(scheduler, CONFIG_HIL_HOT_PATH_LOG_LEVEL);
 
 /* ── Device tree ──────────────────────────────────────────────────────────── */
-#define SPI_DEV_NODE  DT_ALIAS(spi_orchestrator)
-static const struct device *const spi_dev = DEVICE_DT_GET(SPI_DEV_NODE);
+#define SPI_DEV_NODE      DT_ALIAS(spi_orchestrator)
+#define COUNTER_DEV_NODE  DT_ALIAS(injection_counter)
+static const struct device *const spi_dev     = DEVICE_DT_GET(SPI_DEV_NODE);
+static const struct device *const counter_dev = DEVICE_DT_GET(COUNTER_DEV_NODE);
 
-/* ── SPI buffer ───────────────────────────────────────────────────────────── */
+/* ── SPI buffers ──────────────────────────────────────────────────────────── */
 /*
- * Single static buffer — no double-buffering needed with synchronous spi_read.
- * spi_read() returns only after the Pi has clocked in a complete 256-byte
- * frame, so the buffer is safe to decode from the moment the call returns.
+ * Single static buffer each way — no double-buffering needed with a
+ * synchronous transfer.  spi_transceive() returns only after the Pi has
+ * clocked a complete 256-byte frame, so rx_buf is safe to decode and
+ * tx_buf safe to refill from the moment the call returns.
  */
-#define SPI_BUF_SIZE        256U
-#define SPI_FRAME_HDR_SIZE  2U                          /* 2-byte LE length prefix */
-#define SPI_MAX_PAYLOAD     (SPI_BUF_SIZE - SPI_FRAME_HDR_SIZE)  /* 254 bytes */
+#define SPI_BUF_SIZE        HIL_FRAME_SIZE
+#define SPI_MAX_PAYLOAD     HIL_FRAME_MAX_PAYLOAD
 
 static uint8_t rx_buf[SPI_BUF_SIZE];
+static uint8_t tx_buf[SPI_BUF_SIZE];
+
+/* Successful transfers so far and when the last one returned (MISO status). */
+static uint32_t xfer_seq;
+static uint64_t xfer_done_us;
 
 static struct spi_buf     spi_rx_desc = { .buf = rx_buf, .len = SPI_BUF_SIZE };
 static struct spi_buf_set spi_rx_set  = { .buffers = &spi_rx_desc, .count = 1 };
+static struct spi_buf     spi_tx_desc = { .buf = tx_buf, .len = SPI_BUF_SIZE };
+static struct spi_buf_set spi_tx_set  = { .buffers = &spi_tx_desc, .count = 1 };
 
 /*
  * SPI slave configuration.
@@ -90,194 +158,200 @@ static const struct spi_config spi_cfg = {
     .operation = SPI_OP_MODE_SLAVE | SPI_TRANSFER_MSB | SPI_WORD_SET(8),
 };
 
-/* ── Staging ring buffer ──────────────────────────────────────────────────── */
-/*
- * N-slot ring buffer between the scheduler thread and the injection timer ISR.
- * When full, the OLDEST packet is evicted so the ISR always sees the most
- * recent physics state rather than running perpetually behind the Pi.
- */
-K_MSGQ_DEFINE(scheduler_q, sizeof(device_update_packet_t), SCHEDULER_Q_LEN, 4);
-
-/* ── Injection timer and armed flag ───────────────────────────────────────── */
-static struct k_timer injection_timer;
+/* ── Scheduler core and injection counter ─────────────────────────────────── */
+#define INJECTION_COUNTER_HZ    1000000U
+#define INJECTION_ALARM_CHAN    0U
 
-/*
- * atomic_t flag: 0 = timer idle, 1 = timer running.
- * Used by try_arm_timer() to prevent a race where both the scheduler thread
- * and the timer ISR attempt to start the timer simultaneously.
- * atomic_cas (compare-and-swap) ensures only one caller succeeds.
- */
-static atomic_t timer_armed = ATOMIC_INIT(0);
+static struct hil_sched sched;
+static bool counter_ok;
 
-atomic_t spi_err_count = ATOMIC_INIT(0);
+/* 64-bit extension of the counter; the timer keeps it current when nothing
+ * else reads the clock for a whole wrap (e.g. the Pi stopped for an hour). */
+#define CLOCK64_KEEPALIVE  K_MINUTES(10)
 
+static struct hil_clock64 clock64;
+static struct k_spinlock clock64_lock;
 
-/* ── Time helper ──────────────────────────────────────────────────────────── */
-static inline uint32_t now_us(void)
+static void clock64_keepalive(struct k_timer *timer)
 {
-    return k_cyc_to_us_near32(k_cycle_get_32());
+    ARG_UNUSED(timer);
+    (void)scheduler_now_us64();
 }
+K_TIMER_DEFINE(clock64_timer, clock64_keepalive, NULL);
+
+atomic_t spi_err_count = ATOMIC_INIT(0);
+
+static void injection_alarm_isr(const struct device *dev, uint8_t chan_id,
+                                uint32_t ticks, void *user_data);
 
-/* ── Injection timer ISR ──────────────────────────────────────────────────── */
 /**
- * Fires when the STM32 hardware clock has caught up to a packet's
- * timestamp_us — meaning that packet is no longer "in the future" and is
- * causally safe to serve to the DUT.
- *
- * Sequence:
- *   1. Pop the due packet from the staging ring.
- *   2. irq_lock  — make purge+put atomic against any peer ISR.
- *   3. Purge the 1-slot gate (sensor_update_q) — evict the stale entry.
- *   4. Put the fresh packet.
- *   5. irq_unlock.
- *   6. Peek at the next packet and re-arm for its timestamp.
- *
- * Context: k_timer expiry — executes in SysTick ISR.
- * Constraints: no blocking, no mutexes, no sleeping.
+ * Starts the injection counter at boot so the epoch is running before
+ * anything reads scheduler_now_us().
  */
-static void injection_timer_isr(struct k_timer *timer_id)
+static int injection_counter_start(void)
 {
-    ARG_UNUSED(timer_id);
+    if (!device_is_ready(counter_dev)) {
+        return -ENODEV;
+    }
+    /* 1 tick = 1 µs and a full 32-bit range, or timestamps and ticks drift. */
+    if (counter_get_frequency(counter_dev) != INJECTION_COUNTER_HZ ||
+        counter_get_top_value(counter_dev) != UINT32_MAX) {
+        return -ENOTSUP;
+    }
+    /* Anything up to half the range behind now counts as late, not future. */
+    (void)counter_set_guard_period(counter_dev, UINT32_MAX / 2U,
+                                   COUNTER_GUARD_PERIOD_LATE_TO_SET);
+    if (counter_start(counter_dev) != 0) {
+        return -EIO;
+    }
+    counter_ok = true;
+    k_timer_start(&clock64_timer, CLOCK64_KEEPALIVE, CLOCK64_KEEPALIVE);
+    return 0;
+}
+SYS_INIT(injection_counter_start, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
 
-    /* Clear the armed flag; we re-set it below if we re-arm. */
-    atomic_set(&timer_armed, 0);
+uint32_t scheduler_now_us(void)
+{
+    uint32_t ticks = 0;
+    (void)counter_get_value(counter_dev, &ticks);
+    return ticks;
+}
 
-    device_update_packet_t pkt;
-    if (k_msgq_get(&scheduler_q, &pkt, K_NO_WAIT) != 0) {
-        /* Ring drained unexpectedly — nothing to inject. */
-        return;
-    }
+uint64_t scheduler_now_us64(void)
+{
+    /* Read under the lock, or a later reading could be extended first and
+     * this older one would look like a wrap. */
+    k_spinlock_key_t key = k_spin_lock(&clock64_lock);
+    uint64_t now = hil_clock64_extend(&clock64, scheduler_now_us());
+    k_spin_unlock(&clock64_lock, key);
+    return now;
+}
 
-    /* ── Atomic gate update ─────────────────────────────────────────────── */
-    /*
-     * irq_lock sets PRIMASK=1 on Cortex-M, masking all configurable
-     * interrupts.  The purge→put window is O(1) ≈ 10–20 CPU cycles
-     * (< 100 ns at 240 MHz).  Any pending I2C ISR is deferred by this
-     * amount, which is well within I2C clock-stretch tolerance.
-     */
-    unsigned int irq_key = irq_lock();
-    k_msgq_purge(&sensor_update_q);
-    (void)k_msgq_put(&sensor_update_q, &pkt, K_NO_WAIT);
-    irq_unlock(irq_key);
+void scheduler_get_stats(struct hil_sched_stats *out)
+{
+    /* Counters are written from the alarm ISR; a torn read only skews one
+     * diagnostic line, so no lock. */
+    *out = sched.stats;
+}
 
-    /* Update diagnostics (atomic — ISR-safe) */
-    hil_diag_inc_timer_inject();
-    hil_diag_set_last_inject_ts(pkt.timestamp_us);
+/* ── Zephyr port for the core ─────────────────────────────────────────────── */
 
-    /* Reconstruct euler_x int16 from the LSB/MSB pair for the diag display. */
-    int16_t ex = (int16_t)(
-        (uint16_t)pkt.imu_data.euler_angles.x.lsb |
-        ((uint16_t)pkt.imu_data.euler_angles.x.msb << 8));
-    hil_diag_set_last_euler_x((int32_t)ex);
+static uint32_t port_now_us(void *ctx)
+{
+    ARG_UNUSED(ctx);
+    return scheduler_now_us();
+}
 
-    /*
-     * Deferred LOG is safe inside a k_timer ISR when CONFIG_LOG_MODE_DEFERRED=y.
-     * The message is written to a ring buffer; the logging thread flushes it.
-     */
-    LOG_DBG("[INJECT @%u µs] lidar=%u mm  euler_x=%d  rc=(%d,%d)",
-            pkt.timestamp_us,
-            pkt.lidar_distance_mm,
-            (int)ex,
-            pkt.rc_commands.rc_vert,
-            pkt.rc_commands.rc_horiz);
-
-    /* Schedule the timer for the next pending packet. */
-    device_update_packet_t next;
-    if (k_msgq_peek(&scheduler_q, &next) == 0) {
-        int32_t delay = (int32_t)(next.timestamp_us - now_us());
-        if (delay < 1) {
-            delay = 1;  /* Clamp — prevents uint32 underflow wrap */
-        }
-        k_timer_start(&injection_timer, K_USEC(delay), K_NO_WAIT);
-        atomic_set(&timer_armed, 1);
-    }
-    /* If the ring is empty, the timer stays idle until the scheduler thread
-     * pushes the next packet and calls try_arm_timer(). */
+static bool port_alarm_at(void *ctx, uint32_t target_us)
+{
+    ARG_UNUSED(ctx);
+
+    const struct counter_alarm_cfg cfg = {
+        .callback  = injection_alarm_isr,
+        .ticks     = target_us,
+        .user_data = NULL,
+        .flags     = COUNTER_ALARM_CFG_ABSOLUTE | COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE,
+    };
+    int err = counter_set_channel_alarm(counter_dev, INJECTION_ALARM_CHAN, &cfg);
+
+    /* -ETIME: target already passed; EXPIRE_WHEN_LATE fires it right away. */
+    return err == 0 || err == -ETIME;
 }
 
-/* ── Timer arm helper (scheduler thread context) ──────────────────────────── */
 /**
- * Arms the injection timer for the oldest pending packet in scheduler_q.
- * Uses atomic_cas to ensure only one caller (thread or ISR) starts the timer.
- * If the timer is already armed, this is a no-op.
+ * Injects a due packet: publishes it to the emulators and hands it to the
+ * sensor thread.
+ *
+ * The core passes its pool reference along with the index, and
+ * sensor_emulation_post() takes it over — one index swap per emulator plus
+ * one for the mailbox, no copy and no irq_lock.  The diagnostics below read the slot before the hand-off,
+ * while this ISR still owns it.
+ *
+ * Context: counter alarm callback — executes in the TIM5 ISR.
  */
-static void try_arm_timer(void)
+static void port_deliver(void *ctx, uint16_t idx)
 {
-    /* CAS: only proceed if timer_armed is 0 — atomically set it to 1. */
-    if (!atomic_cas(&timer_armed, 0, 1)) {
-        return;   /* Already armed by ISR or a prior call. */
-    }
+    ARG_UNUSED(ctx);
 
-    device_update_packet_t peek;
-    if (k_msgq_peek(&scheduler_q, &peek) != 0) {
-        /* Queue is empty — undo the flag we just set. */
-        atomic_set(&timer_armed, 0);
-        return;
-    }
+    const device_update_packet_t *pkt = hil_pool_pkt(&packet_pool, idx);
 
-    int32_t delay = (int32_t)(peek.timestamp_us - now_us());
-    if (delay < 1) {
-        delay = 1;
-    }
-    k_timer_start(&injection_timer, K_USEC(delay), K_NO_WAIT);
-    LOG_DBG("[TIMER ARM] next_ts=%u  delay=%d µs", peek.timestamp_us, delay);
-}
+    /* Update diagnostics (atomic — ISR-safe) */
+    uint32_t now = scheduler_now_us();
+    hil_diag_hist_record(HIL_HIST_ENQUEUE_TO_INJECT, now - pkt->enqueue_us);
+    hil_diag_hist_record(HIL_HIST_INJECT_LATE, now - pkt->timestamp_us);
+    hil_diag_inc_timer_inject();
+    hil_diag_set_last_inject_ts(pkt->timestamp_us);
 
-/* ── scheduler_q put with oldest-eviction ────────────────────────────────── */
-/**
- * Inserts pkt into scheduler_q.  If the queue is full, evicts the oldest
- * entry (the one furthest in the past) and inserts the newest.  This keeps
- * the ring current rather than perpetually stale.
- */
-static void scheduler_q_put_overwrite(const device_update_packet_t *pkt)
-{
-    if (k_msgq_put(&scheduler_q, pkt, K_NO_WAIT) == 0) {
-        return;   /* Fast path — queue had space. */
-    }
+    /* Reconstruct euler_x int16 from the LSB/MSB pair for the diag display. */
+    int16_t ex = (int16_t)(
+        (uint16_t)(uint8_t)pkt->imu[0].euler_angles.x.lsb |
+        ((uint16_t)(uint8_t)pkt->imu[0].euler_angles.x.msb << 8));
+    hil_diag_set_last_euler_x((int32_t)ex);
 
-    device_update_packet_t dropped;
-    if (k_msgq_get(&scheduler_q, &dropped, K_NO_WAIT) == 0) {
-        LOG_WRN("[EVICT] dropped ts=%u  inserting ts=%u",
-                dropped.timestamp_us, pkt->timestamp_us);
-        hil_diag_inc_scheduler_q_evict();
-        (void)k_msgq_put(&scheduler_q, pkt, K_NO_WAIT);
-    }
+    HIL_TRACE(INJECT, pkt->range_mm[0], pkt->timestamp_us, (int32_t)ex);
+
+    sensor_emulation_post(idx);
 }
 
-/* ── Framing helpers ──────────────────────────────────────────────────────── */
+static const struct hil_sched_port zephyr_port = {
+    .ctx      = NULL,
+    .now_us   = port_now_us,
+    .alarm_at = port_alarm_at,
+    .deliver  = port_deliver,
+};
 
+/* ── Injection alarm ISR ──────────────────────────────────────────────────── */
 /**
- * @brief Parse the 2-byte LE length prefix from a raw frame buffer.
- * @return Payload length in bytes, or 0 if the header is invalid.
+ * Fires when the injection counter reaches the oldest packet's
+ * timestamp_us — meaning that packet is no longer "in the future" and is
+ * causally safe to serve to the DUT.  The core drains every packet that is
+ * due by now, delivers only the newest through port_deliver(), records the
+ * lateness and re-arms at the next packet's timestamp.
+ *
+ * Context: counter alarm callback — executes in the TIM5 ISR.
+ * Constraints: no blocking, no mutexes, no sleeping.
  */
-static uint16_t frame_parse_len(const uint8_t *buf)
+static void injection_alarm_isr(const struct device *dev, uint8_t chan_id,
+                                uint32_t ticks, void *user_data)
 {
-    uint16_t len = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
-    if (len == 0 || len > SPI_MAX_PAYLOAD) {
-        return 0;
-    }
-    return len;
+    ARG_UNUSED(dev); ARG_UNUSED(chan_id); ARG_UNUSED(ticks); ARG_UNUSED(user_data);
+    hil_sched_on_timer(&sched);
 }
 
+/* ── Scheduler thread ─────────────────────────────────────────────────────── */
+K_THREAD_STACK_DEFINE(scheduler_stack, SCHEDULER_STACK_SIZE);
 /**
- * @brief Return true if buf contains the Pi's clock-sync magic frame.
- *
- * Sync frame layout:
- *   bytes [0..1] = 0xFFFF  (marker)
- *   bytes [2..5] = 0xC0FFEEEE  (little-endian magic)
+ * Builds the MISO status frame for the next transfer into tx_buf.  The
+ * samples it carries stay queued until pwm_samples_commit().
  */
-static bool frame_is_sync(const uint8_t *buf)
+static void miso_fill(void)
 {
-    uint16_t marker = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
-    uint32_t magic  = (uint32_t)buf[2]
-                    | ((uint32_t)buf[3] << 8)
-                    | ((uint32_t)buf[4] << 16)
-                    | ((uint32_t)buf[5] << 24);
-    return (marker == 0xFFFFU && magic == 0xC0FFEEEEUL);
+    struct hil_motor_sample samples[HIL_MISO_MAX_SAMPLES];
+    hil_diag_snapshot_t d;
+    hil_diag_get_snapshot(&d);
+
+    struct hil_miso_status st = {
+        .seq        = xfer_seq,
+        .rx_done_us = xfer_done_us,
+        .counters   = {
+            .spi_rx      = d.spi_rx_count,
+            .decode_fail = d.decode_fail_count,
+            .spi_err     = (uint32_t)atomic_get(&spi_err_count),
+            .inject      = d.timer_inject_count,
+            .sched_evict = d.scheduler_q_evict,
+            .superseded  = d.superseded_count,
+            .rc_drop     = d.rc_drop_count,
+            .imu_read    = d.imu_read_count,
+            .lidar_read  = d.lidar_read_count,
+        },
+    };
+    st.has_latest = pwm_samples_latest(&st.latest);
+    size_t n = pwm_samples_peek(samples, HIL_MISO_MAX_SAMPLES, &st.lost);
+    st.fill_us = scheduler_now_us64();
+
+    (void)hil_miso_encode(&st, samples, n, tx_buf);
 }
 
-/* ── Scheduler thread ─────────────────────────────────────────────────────── */
-K_THREAD_STACK_DEFINE(scheduler_stack, SCHEDULER_STACK_SIZE);
 static struct k_thread scheduler_data;
 
 static void scheduler_thread(void *p1, void *p2, void *p3)
@@ -289,7 +363,13 @@ static void scheduler_thread(void *p1, void *p2, void *p3)
         return;
     }
 
-    k_timer_init(&injection_timer, injection_timer_isr, NULL);
+    if (!counter_ok) {
+        LOG_ERR("Injection counter not running (needs %u Hz, 32-bit) — "
+                "scheduler thread exiting", INJECTION_COUNTER_HZ);
+        return;
+    }
+
+    hil_sched_init(&sched, &zephyr_port, &packet_pool);
 
     LOG_INF("Scheduler running  buf=%u B  max_payload=%u B  ring=%u slots",
             SPI_BUF_SIZE, SPI_MAX_PAYLOAD, SCHEDULER_Q_LEN);
@@ -299,143 +379,88 @@ static void scheduler_thread(void *p1, void *p2, void *p3)
     while (1) {
         /* ── Step 1: Block until the Pi clocks in a full 256-byte frame ─────
          *
-         * spi_read() suspends this thread at the Zephyr scheduler level.
-         * All other threads — sensor emulation, I2C ISRs, timer ISR — run
+         * The node status goes out on MISO in the same transfer; the motor
+         * samples in it are committed only if it succeeds.
+         *
+         * spi_transceive() suspends this thread at the Zephyr scheduler level.
+         * All other threads — sensor emulation, I2C ISRs, alarm ISR — run
          * normally while we wait.  There is no busy-wait and no CPU burn.
          *
          * The STM32 SPI slave hardware latches the NSS pin and fills the
-         * RX FIFO under DMA as the Pi clocks bytes.  spi_read() returns
-         * after exactly SPI_BUF_SIZE bytes have been received.
+         * RX FIFO under DMA as the Pi clocks bytes.  spi_transceive()
+         * returns after exactly SPI_BUF_SIZE bytes have been exchanged.
          */
-        int err = spi_read(spi_dev, &spi_cfg, &spi_rx_set);
-        /* if (err != 0) { */
-        /*     LOG_ERR("[#%u] spi_read error: %d — retrying in 1 ms", loop, err); */
-        /*     k_sleep(K_MSEC(1)); */
-        /*     continue; */
-        /* } */
-
-
-        if (err !=0) {
+        miso_fill();
+        int err = spi_transceive(spi_dev, &spi_cfg, &spi_tx_set, &spi_rx_set);
+        uint64_t rx_us64 = scheduler_now_us64();
+        uint32_t rx_us = (uint32_t)rx_us64;
+        if (err != 0) {
             atomic_inc(&spi_err_count);
             k_sleep(K_MSEC(1));
             continue;
         }
+        xfer_seq++;
+        xfer_done_us = rx_us64;
+        pwm_samples_commit();
 
         loop++;
 
-        /* ── Step 2: Reject clock-sync frames ───────────────────────────── */
-        /*
-         * The Pi sends a sync frame as its very first transmission.
-         * main.c handles the two-way handshake before starting this thread,
-         * but a re-sync or a late-arriving sync frame is silently ignored here.
+        /* ── Step 2: Hand the frame to the core ──────────────────────────────
+         *
+         * Sync rejection, length prefix, decode straight into a pool slot,
+         * ring push (oldest-eviction) and alarm arming all happen in
+         * hil_sched_on_frame().  No kernel calls, no irq_lock.  pkt_ref is
+         * an extra reference so the slot can be logged below even if the
+         * alarm has already injected it.
          */
-        if (frame_is_sync(rx_buf)) {
+        uint16_t pkt_ref;
+        bool evicted;
+        enum hil_frame_status st = hil_sched_on_frame(&sched, rx_buf, &pkt_ref, &evicted);
+
+        switch (st) {
+        case HIL_FRAME_SYNC:
+            /*
+             * Older Pi builds open with a sync frame.  The clock is tracked
+             * from the MISO status now, so it carries nothing we need.
+             */
             LOG_INF("[#%u] Sync frame received — ignoring in stream mode", loop);
             continue;
-        }
-
-        /* ── Step 3: Parse 2-byte LE length prefix ───────────────────────── */
-        uint16_t payload_len = frame_parse_len(rx_buf);
-        if (payload_len == 0) {
+        case HIL_FRAME_BAD_LEN:
             LOG_WRN("[#%u] Invalid frame header [%02X %02X] — skipping",
                     loop, rx_buf[0], rx_buf[1]);
             hil_diag_inc_decode_fail();
             continue;
-        }
-
-        /* ── Step 4: Decode protobuf payload ─────────────────────────────── */
-        SensorPacket proto = SensorPacket_init_zero;
-        pb_istream_t stream = pb_istream_from_buffer(
-            rx_buf + SPI_FRAME_HDR_SIZE, payload_len);
-
-        if (!pb_decode(&stream, SensorPacket_fields, &proto)) {
-            LOG_WRN("[#%u] pb_decode failed (plen=%u): %s",
-                    loop, payload_len, PB_GET_ERROR(&stream));
+        case HIL_FRAME_DECODE_FAIL:
+            LOG_WRN("[#%u] SensorPacket decode failed — skipping", loop);
             hil_diag_inc_decode_fail();
             continue;
+        case HIL_FRAME_NO_SLOT:
+            LOG_WRN("[#%u] Packet pool exhausted — frame dropped", loop);
+            continue;
+        case HIL_FRAME_OK:
+            break;
         }
 
+        const device_update_packet_t *pkt = hil_pool_pkt(&packet_pool, pkt_ref);
+        hil_diag_hist_record(HIL_HIST_RX_TO_ENQUEUE, pkt->enqueue_us - rx_us);
         hil_diag_inc_spi_rx();
+        if (evicted) {
+            hil_diag_inc_scheduler_q_evict();
+        }
 
-        /* ── Step 5: Log the decoded combined packet ─────────────────────── */
-        LOG_INF("[RX #%u] ts=%6u µs | "
-                "euler(%d,%d,%d)  gyro(%d,%d,%d)  la(%d,%d,%d) | "
-                "lidar=%u mm | rc(%d,%d)",
-                loop,
-                proto.timestamp_us,
-                proto.imu.euler_x,    proto.imu.euler_y,    proto.imu.euler_z,
-                proto.imu.gyro_x,     proto.imu.gyro_y,     proto.imu.gyro_z,
-                proto.imu.lin_acc_x,  proto.imu.lin_acc_y,  proto.imu.lin_acc_z,
-                proto.lidar_mm,
-                proto.rc.vertical,    proto.rc.horizontal);
-
-        hil_diag_set_last_lidar((int32_t)proto.lidar_mm);
-        hil_diag_set_last_euler_x(proto.imu.euler_x);
-
-        /* ── Step 6: Map proto fields → device_update_packet_t ───────────── */
-        /*
-         * Combined packet — IMU + LiDAR + RC all present in every frame.
-         * No sensor_id, no union, no has_imu flag.
-         */
-        device_update_packet_t pkt;
-        memset(&pkt, 0, sizeof(pkt));
-
-        pkt.timestamp_us      = proto.timestamp_us;
-        pkt.lidar_distance_mm = (uint16_t)(proto.lidar_mm & 0xFFFFU);
-
-        /* RC — clamp proto sint32 → int8 to guard against out-of-range values */
-        pkt.rc_commands.rc_vert  = (int8_t)CLAMP(proto.rc.vertical,   -127, 127);
-        pkt.rc_commands.rc_horiz = (int8_t)CLAMP(proto.rc.horizontal, -127, 127);
-
-        /* ── IMU field mapping ──────────────────────────────────────────────
-         *
-         * Each proto sint32 value is a signed 16-bit integer in BNO055
-         * register format.  We split it into the two consecutive register
-         * bytes that the I2C ISR will serve directly to the DUT.
-         *
-         * Bit operations:
-         *   lsb = value & 0xFF         (lower 8 bits)
-         *   msb = (value >> 8) & 0xFF  (upper 8 bits, sign-extended by >>)
-         *
-         * Casting to int8_t reinterprets the bit pattern without UB because
-         * we have already masked to 8 bits.
-         */
+        /* ── Step 3: Trace the decoded combined packet ───────────────────── */
+        HIL_TRACE(RX, loop, pkt->timestamp_us, pkt->range_mm[0]);
+        HIL_TRACE(RX_RC, hil_sched_ring_count(&sched),
+                  pkt->rc_commands.rc_vert, pkt->rc_commands.rc_horiz);
 
-        /* Euler angles — BNO055 regs 0x1A–0x1F */
-        pkt.imu_data.euler_angles.x.lsb = (int8_t)( proto.imu.euler_x        & 0xFF);
-        pkt.imu_data.euler_angles.x.msb = (int8_t)((proto.imu.euler_x  >> 8) & 0xFF);
-        pkt.imu_data.euler_angles.y.lsb = (int8_t)( proto.imu.euler_y        & 0xFF);
-        pkt.imu_data.euler_angles.y.msb = (int8_t)((proto.imu.euler_y  >> 8) & 0xFF);
-        pkt.imu_data.euler_angles.z.lsb = (int8_t)( proto.imu.euler_z        & 0xFF);
-        pkt.imu_data.euler_angles.z.msb = (int8_t)((proto.imu.euler_z  >> 8) & 0xFF);
-
-        /* Linear acceleration — BNO055 regs 0x28–0x2D */
-        pkt.imu_data.linear_acceleration.x.lsb = (int8_t)( proto.imu.lin_acc_x        & 0xFF);
-        pkt.imu_data.linear_acceleration.x.msb = (int8_t)((proto.imu.lin_acc_x  >> 8) & 0xFF);
-        pkt.imu_data.linear_acceleration.y.lsb = (int8_t)( proto.imu.lin_acc_y        & 0xFF);
-        pkt.imu_data.linear_acceleration.y.msb = (int8_t)((proto.imu.lin_acc_y  >> 8) & 0xFF);
-        pkt.imu_data.linear_acceleration.z.lsb = (int8_t)( proto.imu.lin_acc_z        & 0xFF);
-        pkt.imu_data.linear_acceleration.z.msb = (int8_t)((proto.imu.lin_acc_z  >> 8) & 0xFF);
-
-        /* Gyroscope — BNO055 regs 0x14–0x19 */
-        pkt.imu_data.gyro.x.lsb = (int8_t)( proto.imu.gyro_x        & 0xFF);
-        pkt.imu_data.gyro.x.msb = (int8_t)((proto.imu.gyro_x  >> 8) & 0xFF);
-        pkt.imu_data.gyro.y.lsb = (int8_t)( proto.imu.gyro_y        & 0xFF);
-        pkt.imu_data.gyro.y.msb = (int8_t)((proto.imu.gyro_y  >> 8) & 0xFF);
-        pkt.imu_data.gyro.z.lsb = (int8_t)( proto.imu.gyro_z        & 0xFF);
-        pkt.imu_data.gyro.z.msb = (int8_t)((proto.imu.gyro_z  >> 8) & 0xFF);
-
-        /* ── Step 7: Push to staging ring ────────────────────────────────── */
-        scheduler_q_put_overwrite(&pkt);
-
-        /* ── Step 8: Arm the injection timer if it is currently idle ─────── */
-        try_arm_timer();
+        hil_diag_set_last_lidar((int32_t)pkt->range_mm[0]);
+        hil_pool_put(&packet_pool, pkt_ref);
 
         /*
-         * Loop back to spi_read() immediately.  The only gap between the end
-         * of decode and the start of the next spi_read() is steps 6–8 above
-         * (memset + field assignments + queue push + CAS) ≈ 15–30 µs.
-         * At Pi send rates ≤ 1 kHz this causes negligible frame loss.
+         * Loop back to spi_transceive() immediately.  The only gap between
+         * the end of decode and the start of the next transfer is the core's
+         * queue push + CAS and the MISO fill ≈ a few µs.  At Pi send rates ≤ 1 kHz this
+         * causes negligible frame loss.
          */
     }
 }
@@ -1,6 +1,6 @@
 /**
  * @file scheduler.h
- * @brief Scheduler thread: SPI async receive, protobuf decode, and timer-based
+ * @brief Scheduler thread: SPI receive, SensorPacket decode, and counter-alarm
  *        causality gating of physics engine updates.
  *
  * Responsibilities
@@ -8,9 +8,9 @@
  *   1. Receive 256-byte framed SPI packets from the Pi (DMA-backed async).
  *   2. Decode each frame's protobuf payload (SensorPacket — combined IMU +
  *      LiDAR + RC, no sensor_id).
- *   3. Map proto fields → device_update_packet_t and push to scheduler_q.
- *   4. Fire the injection timer when the STM32 hardware clock reaches a
- *      packet's timestamp_us, enforcing the "Arrow of Time" constraint:
+ *   3. Map proto fields → device_update_packet_t and push to the staging ring.
+ *   4. Fire an absolute counter alarm when the STM32 hardware clock reaches
+ *      a packet's timestamp_us, enforcing the "Arrow of Time" constraint:
  *      the DUT is never served physics state from the future.
  *
  * Data flow
@@ -19,17 +19,20 @@
  *     │  DMA transfer → spi_rx_callback (ISR) → spi_rx_sem
  *     ▼
  *   scheduler_thread  (priority SCHEDULER_PRIORITY)
- *     │  2-byte LE length-prefix framing parse
- *     │  nanopb pb_decode → SensorPacket
- *     │  map all fields → device_update_packet_t
- *     │  scheduler_q_put_overwrite()  ← evicts oldest if ring is full
- *     │  try_arm_timer()
+ *     │  hil_sched_on_frame()  (lib/hil_core — host-buildable)
+ *     │    2-byte LE length-prefix framing parse
+ *     │    alloc packet_pool slot → SensorPacket decode in place (only copy)
+ *     │    push {timestamp, slot index} to the ring  ← evicts oldest if full
+ *     │    try_arm_timer()
  *     ▼
- *   injection_timer_isr  (k_timer expiry — SysTick ISR context)
- *     │  fires when now_us() ≥ packet.timestamp_us
- *     │  irq_lock → k_msgq_purge(sensor_update_q) → k_msgq_put → irq_unlock
+ *   injection_alarm_isr  (counter alarm — TIM5 ISR context)
+ *     │  fires when the 1 MHz counter reaches packet.timestamp_us
+ *     │  hil_sched_on_timer(): drain all due packets, keep the newest,
+ *     │  record lateness → port_deliver() → sensor_emulation_post(index)
+ *     │  i2c_emulator_publish(em, index) per present record, in this ISR
+ *     ├──► sensor thread mailbox  (1 index — RC forwarding, logging)
  *     ▼
- *   sensor_update_q  (1-slot gate queue — defined in sensor_emulation.h)
+ *   I2C ISRs serve register bytes straight from the pool slot
  *
  * Wire frame format
  * ─────────────────
@@ -39,16 +42,20 @@
  *
  * Clock epoch
  * ───────────
- *   packet.timestamp_us MUST be in the STM32's k_cyc_to_us_near32 epoch.
- *   The clock-sync handshake in main.c establishes this before streaming
- *   starts.  Use CONFIG_HIL_SKIP_CLOCK_SYNC=y (prj.conf) during bring-up
- *   to bypass the handshake and use STM32 boot time as epoch 0.
+ *   packet.timestamp_us MUST be in the injection counter epoch
+ *   (scheduler_now_us(): µs since boot, wrapping at 2^32).  There is no
+ *   handshake: every MISO status carries the node's 64-bit time of the
+ *   previous transfer (scheduler_now_us64()), and the Pi's clock servo
+ *   tracks offset and skew from those continuously and sends the low
+ *   32 bits of its node-time estimate.
  */
 
 #ifndef THREADS_SCHEDULER_H
 #define THREADS_SCHEDULER_H
 
 #include "threads/sensor_emulation_test.h"
+#include "hil_core/ring.h"
+#include "hil_core/sched.h"
 #include <zephyr/kernel.h>
 
 /* ── Thread configuration ─────────────────────────────────────────────────── */
@@ -67,39 +74,51 @@
 
 /**
  * @brief Depth of the ring buffer between the scheduler thread and the
- *        injection timer ISR.
+ *        injection alarm ISR.
  *
  * The Pi may transmit faster than the DUT polls (oversampling).  This ring
- * absorbs those bursts.  When full, the OLDEST packet is evicted and the
+ * of packet_pool indices absorbs those bursts.  When full, the OLDEST packet is evicted and the
  * newest is inserted so the ISR always works toward the most recent physics
  * state rather than running perpetually behind.
  *
- * Memory cost: SCHEDULER_Q_LEN × sizeof(device_update_packet_t)
- *   = 64 × ~26 bytes ≈ 1664 bytes of static RAM.
+ * The ring itself is the lock-free SPSC ring in the scheduler core
+ * (hil_core/ring.h).  One slot is kept free, so it holds SCHEDULER_Q_LEN − 1
+ * packets; override HIL_RING_LEN with a compile definition to resize it.
+ */
+#define SCHEDULER_Q_LEN  HIL_RING_LEN
+
+/* ── Public API ───────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Current time in the packet timestamp epoch (µs, wraps at 2^32).
  *
- * Reduce if RAM is constrained; increase if Pi burst rate is very high.
+ * Reads the injection counter, which starts at boot.  ISR-safe.
  */
-#define SCHEDULER_Q_LEN  (64U)
+uint32_t scheduler_now_us(void);
 
 /**
- * @brief The staging ring buffer.
+ * @brief Same clock extended to 64 bits (µs since boot, never wraps).
  *
- * Defined in scheduler.c.  Exposed here so injection_timer_isr (also in
- * scheduler.c) can peek at the next-due packet without making it a global.
- * External code should not write to this queue directly.
+ * For times that leave the node (MISO status) or span more than half a
+ * wrap.  ISR-safe.
  */
-extern struct k_msgq scheduler_q;
+uint64_t scheduler_now_us64(void);
 
-/* ── Public API ───────────────────────────────────────────────────────────── */
+/**
+ * @brief Copy of the scheduler core counters and lateness histogram.
+ *
+ * Thread context.  Not atomic with respect to the alarm ISR — diagnostics only.
+ */
+void scheduler_get_stats(struct hil_sched_stats *out);
 
 /**
  * @brief Create and start the scheduler thread.
  *
- * Initialises the injection timer and spawns the scheduler thread.  The
- * thread immediately begins waiting for SPI DMA completions.
+ * Spawns the scheduler thread, which initialises the core and packet_pool.
+ * The thread immediately begins waiting for SPI DMA completions.
  *
  * Call AFTER sensor_emulation_init() to guarantee the I2C targets are
- * registered and sensor_update_q exists before the first timer injection.
+ * registered before the first injection.
  */
 void scheduler_init(void);
 
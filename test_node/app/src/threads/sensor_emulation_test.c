@@ -1,26 +1,113 @@
 /**
  * @file sensor_emulation.c  [TEST-INSTRUMENTED VERSION]
- * @brief Sensor emulation thread: peek-loop routing timer packets to emulators.
+ * @brief Sensor emulation: publishes injected packets to the emulators and
+ *        queues their RC commands from the injection alarm ISR, by pool
+ *        index, and hands them on to the sensor thread for logging.
  *
- * No functional changes from base — the diagnostic instrumentation lives in the
- * individual emulators and the scheduler. This file just adds a startup log and
- * exposes the queue count in the periodic log message.
+ * Additions vs base:
+ *   + HIL_HIST_PUBLISH_LATE: publish time − timestamp_us of every packet.
+ *   + hil_diag_add_superseded(): packets the alarm ISR posted that the
+ *     thread never saw (a newer one replaced them first).
+ *   + RC commands go out from the alarm ISR too (rc_command_received() only
+ *     queues them for the UART interrupt), at the packet's timestamp.
+ *
+ * The rest of the instrumentation lives in the individual emulators and the
+ * scheduler.  This file owns the packet pool and the ISR → thread mailbox.
  */
 
 #include "threads/sensor_emulation_test.h"
 #include "threads/imu_emulator_test.h"
 #include "threads/lidar_emulator_test.h"
+#include "threads/scheduler_test.h"
+#include "threads/rc.h"
+#include "hil_diag.h"
+
+#include "hil_core/port.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
-LOG_MODULE_REGISTER(sensor_emulation, LOG_LEVEL_INF);
+LOG_MODULE_REGISTER(sensor_emulation, CONFIG_HIL_HOT_PATH_LOG_LEVEL);
+
+/* ── Emulated targets ───────────────────────────────────────────────────── */
+enum sensor_bus {
+    SENSOR_BUS_IMU,
+    SENSOR_BUS_LIDAR,
+};
+
+/* One row per emulated device: which packet record it serves, and where. */
+struct sensor_target {
+    enum hil_rec kind;
+    uint8_t      instance;
+    uint8_t      bus;        /**< enum sensor_bus */
+    uint16_t     address;
+};
+
+static const struct sensor_target sensor_targets[] = {
+    { HIL_REC_IMU,   0, SENSOR_BUS_IMU,   IMU_ADDRESS },
+#if HIL_PKT_IMUS > 1
+    { HIL_REC_IMU,   1, SENSOR_BUS_IMU,   IMU_ADDRESS_ALT },
+#endif
+    { HIL_REC_RANGE, 0, SENSOR_BUS_LIDAR, LIDAR_ADDRESS },
+#if HIL_PKT_RANGES > 1
+    { HIL_REC_RANGE, 1, SENSOR_BUS_LIDAR, CONFIG_HIL_RANGE1_ADDRESS },
+#endif
+};
+
+/* Filled by sensor_emulation_init() before the first injection; NULL if the
+ * instance failed.  Read-only afterwards, so the alarm ISR walks it freely. */
+static struct i2c_emulator *sensor_emulators[ARRAY_SIZE(sensor_targets)];
+
+/* ── Packet pool and ISR mailbox ────────────────────────────────────────── */
+struct hil_pool packet_pool;
+
+/*
+ * Newest injected packet: generation in the high half, pool index + 1 in
+ * the low half; 0 = nothing new.  One word, so the thread always sees a
+ * packet together with its own generation.
+ */
+static hil_atomic_t sensor_mailbox;
+
+#define MAIL_IDX(m)  ((uint16_t)(((uint32_t)(m) & 0xFFFFU) - 1U))
+#define MAIL_GEN(m)  ((uint16_t)((uint32_t)(m) >> 16))
+
+/* Packets posted so far, mod 2^16.  Alarm ISR only. */
+static uint16_t sensor_gen;
+static struct k_poll_signal sensor_signal;
+
+void sensor_emulation_post(uint16_t pkt)
+{
+    const device_update_packet_t *p = hil_pool_pkt(&packet_pool, pkt);
+
+    /*
+     * Publish first: each emulator swaps its active index here, so the DUT's
+     * next read transaction sees this packet from the injection instant on.
+     * Every emulator whose record the packet carries; the others keep
+     * serving their last one.  Each takes its own reference to the slot.
+     */
+    for (size_t i = 0; i < ARRAY_SIZE(sensor_emulators); i++) {
+        struct i2c_emulator *em = sensor_emulators[i];
+        if (em != NULL && i2c_emulator_wants(em, p)) {
+            i2c_emulator_publish(em, pkt);
+        }
+    }
+    /* RC rides the same injection instant; 0,0 is a no-op. */
+    if (p->rc_commands.rc_vert != 0 || p->rc_commands.rc_horiz != 0) {
+        (void)rc_command_received(p->rc_commands);
+    }
+    hil_diag_hist_record(HIL_HIST_PUBLISH_LATE, scheduler_now_us() - p->timestamp_us);
 
-/* ── 1-slot ISR gate queue ─────────────────────────────────────────────── */
-K_MSGQ_DEFINE(sensor_update_q,
-              sizeof(device_update_packet_t),
-              SENSOR_UPDATE_QUEUE_LEN,
-              4);
+    /* Then the thread's share — it takes over the caller's reference. */
+    sensor_gen++;
+    long old = hil_atomic_swap(&sensor_mailbox,
+                               (long)(((uint32_t)sensor_gen << 16) | (pkt + 1U)));
+    if (old != 0) {
+        hil_pool_put(&packet_pool, MAIL_IDX(old));
+    }
+    /* After the swap: a woken thread always finds this packet or a newer one. */
+    k_poll_signal_raise(&sensor_signal, 0);
+}
 
 /* ── Thread resources ───────────────────────────────────────────────────── */
 K_THREAD_STACK_DEFINE(sensor_emulation_stack, SENSOR_EMULATION_STACK_SIZE);
@@ -31,36 +118,57 @@ static void sensor_emulation_thread(void *p1, void *p2, void *p3)
 {
     ARG_UNUSED(p1); ARG_UNUSED(p2); ARG_UNUSED(p3);
 
-    device_update_packet_t pkt;
     uint32_t loop_count = 0;
+    uint16_t seen_gen   = 0;
+    struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL,
+                                                         K_POLL_MODE_NOTIFY_ONLY,
+                                                         &sensor_signal);
 
-    LOG_INF("Sensor emulation thread running");
+    LOG_INF("Sensor emulation thread running (event-driven)");
 
     while (1) {
-        if (k_msgq_peek(&sensor_update_q, &pkt) == 0) {
+        /* Sleeps until the alarm ISR posts; no polling, no fixed delay. */
+        (void)k_poll(&event, 1, K_FOREVER);
+
+        /*
+         * Re-arm BEFORE emptying the mailbox.  A post landing in between
+         * re-raises the signal, so the next k_poll returns at once and at
+         * worst finds the mailbox already empty — never a lost wake-up.
+         */
+        k_poll_signal_reset(&sensor_signal);
+        event.state = K_POLL_STATE_NOT_READY;
+
+        long mail = hil_atomic_swap(&sensor_mailbox, 0);
+        if (mail != 0) {
+            uint16_t idx = MAIL_IDX(mail);
+            uint16_t gen = MAIL_GEN(mail);
+            const device_update_packet_t *pkt = hil_pool_pkt(&packet_pool, idx);
             loop_count++;
 
-            /* All three sensors update every tick — no routing needed */
-            lidar_emulator_update_distance(pkt.lidar_distance_mm);
-            imu_emulator_update_data(&pkt.imu_data);
+            /* Every generation between the last one seen and this one was
+             * replaced in the mailbox before the thread ran. */
+            uint16_t skipped = (uint16_t)(gen - seen_gen - 1U);
+            if (skipped != 0) {
+                hil_diag_add_superseded(skipped);
+            }
+            seen_gen = gen;
 
-            /* RC forwarding — only act if at least one axis is non-zero */
-            if (pkt.rc_commands.rc_vert != 0 || pkt.rc_commands.rc_horiz != 0) {
-                /* TODO: forward rc_commands to RC subsystem */
+            /* RC was already queued for the DUT by sensor_emulation_post() */
+            if (pkt->rc_commands.rc_vert != 0 || pkt->rc_commands.rc_horiz != 0) {
                 LOG_DBG("[SEN_EMU #%u] RC vert=%d horiz=%d",
                         loop_count,
-                        pkt.rc_commands.rc_vert,
-                        pkt.rc_commands.rc_horiz);
+                        pkt->rc_commands.rc_vert,
+                        pkt->rc_commands.rc_horiz);
             }
 
             LOG_DBG("[SEN_EMU #%u] ts=%u lidar=%u mm euler_x_lsb=%d",
                     loop_count,
-                    pkt.timestamp_us,
-                    pkt.lidar_distance_mm,
-                    pkt.imu_data.euler_angles.x.lsb);
-        }
+                    pkt->timestamp_us,
+                    pkt->range_mm[0],
+                    pkt->imu[0].euler_angles.x.lsb);
 
-        k_sleep(K_USEC(500));
+            hil_pool_put(&packet_pool, idx);
+        }
     }
 }
 /* ── Public initialisation ──────────────────────────────────────────────── */
@@ -69,8 +177,21 @@ void sensor_emulation_init(const struct device *i2c_lidar,
 {
     LOG_INF("Initialising sensor emulation subsystem");
 
-    lidar_emulator_init(i2c_lidar);
-    imu_emulator_init(i2c_imu);
+    k_poll_signal_init(&sensor_signal);
+
+    const struct device *buses[] = {
+        [SENSOR_BUS_IMU]   = i2c_imu,
+        [SENSOR_BUS_LIDAR] = i2c_lidar,
+    };
+
+    for (size_t i = 0; i < ARRAY_SIZE(sensor_targets); i++) {
+        const struct sensor_target *t = &sensor_targets[i];
+        const struct device *bus = buses[t->bus];
+
+        sensor_emulators[i] = (t->kind == HIL_REC_IMU)
+            ? imu_emulator_init(t->instance, bus, t->address)
+            : lidar_emulator_init(t->instance, bus, t->address);
+    }
 
     k_thread_create(&sensor_emulation_data,
                     sensor_emulation_stack,
@@ -3,23 +3,58 @@
  * @brief Shared types and queue declarations for the HIL sensor emulation layer.
  *
  * Architecture overview:
- *   Scheduler Thread  ──(scheduler_q, N-slot ring)──►  Timer ISR
- *   Timer ISR         ──(sensor_update_q, 1-slot gate)──► Sensor Thread
- *   Sensor Thread     ──(direct fn calls)──► Emulator update fns
- *   I2C ISRs          ──(atomic / ping-pong read)──► DUT
+ *   Scheduler Thread  ──(hil_sched ring, N pool indices)──►  Timer ISR
+ *   Timer ISR         ──(sensor_emulation_post: publish by index)──► Emulators
+ *   Timer ISR         ──(rc_command_received: UART TX ring)──► DUT
+ *   Timer ISR         ──(1-index mailbox + signal)──► Sensor Thread (logs)
+ *   I2C ISRs          ──(refcounted snapshot)──► DUT
  *
  * Packet model:
- *   The Pi sends ONE combined packet per tick containing IMU + LiDAR + RC.
- *   There is no sensor_id routing tag and no union — every field is always
- *   present and always valid.  The sensor thread calls all three emulator
- *   update functions on every peek.
- *
- * Queue model:
- *   sensor_update_q has exactly 1 slot.  The timer ISR is the sole writer
- *   (irq_lock → purge → put → irq_unlock).  The sensor thread is the sole
- *   reader (k_msgq_peek only — never pops).  The slot is therefore always
- *   "full" after the first injection, giving the ISR a safe target to purge
- *   at any time without an empty-queue edge case.
+ *   The Pi sends ONE combined packet per tick containing RC plus one record
+ *   per IMU / LiDAR instance it simulates (hil_core/packet.h).  present[]
+ *   says which records the packet carries; the injection ISR hands it to
+ *   every emulator whose record is present and queues its RC command for
+ *   the UART.
+ *
+ * Publish from the ISR:
+ *   The slot was decoded by the scheduler thread long before it is due, so
+ *   publishing is only an index swap per emulator (hil_regemu_publish) —
+ *   cheap enough for the alarm ISR.  The data is visible on I2C from the
+ *   injection instant, with no thread hop in between.  The emulators' pin
+ *   (load active, then get) stays safe with an ISR publisher: a publish may
+ *   drop the last reference between the load and the get, but only thread
+ *   context allocates, so the slot cannot be reused before the pinning ISR
+ *   returns (hil_core/pool.h).
+ *
+ * Targets:
+ *   sensor_targets[] in sensor_emulation.c maps each record instance to a
+ *   bus and address — IMU 0 / 1 at 0x29 / 0x28 on the IMU bus, LiDAR 0 / 1
+ *   at 0x62 / CONFIG_HIL_RANGE1_ADDRESS on the LiDAR bus.  The STM32 I2C
+ *   peripheral answers two own addresses, so each bus carries up to two
+ *   targets; more sensors means another bus and another row.
+ *
+ * Zero-copy model:
+ *   The SPI frame is decoded once, into a slot of packet_pool
+ *   (hil_core/pool.h).  Every stage after that passes the 16-bit slot index
+ *   and a pool reference; the I2C ISRs serve register bytes straight out of
+ *   the slot.  A slot returns to the pool when the ring, the mailbox and
+ *   every emulator have let go of it.
+ *
+ * Mailbox model:
+ *   One atomic holding (generation, index + 1), 0 when empty.  The timer
+ *   ISR swaps the newest packet in and releases whatever it displaced, so
+ *   an unread packet is simply superseded.  The sensor thread swaps it back
+ *   to 0 and owns the reference it took out.
+ *
+ * Wake-up model:
+ *   The sensor thread only logs; it is not on the data path.  After
+ *   publishing, the alarm ISR bumps a 16-bit generation counter, stores it
+ *   in the mailbox word next to the index, and raises a k_poll_signal.  The
+ *   thread blocks in k_poll() and runs once per wake-up, so it costs nothing
+ *   between packets.  A jump of more than one generation counts the packets
+ *   superseded unseen.  How late the thread wakes (it yields to the
+ *   scheduler thread and anything above it) delays the log only; the data
+ *   age the DUT sees is the alarm-to-ISR latency plus the I2C read itself.
  */
 
 #ifndef THREADS_SENSOR_EMULATION_H
@@ -28,6 +63,8 @@
 #include <stdint.h>
 #include <zephyr/kernel.h>
 
+#include "hil_core/pool.h"
+
 /* ── Thread configuration ─────────────────────────────────────────────────── */
 #define SENSOR_EMULATION_STACK_SIZE  (10U * 1024U)
 /**
@@ -39,114 +76,47 @@
 
 /* ── I2C target addresses ─────────────────────────────────────────────────── */
 #define LIDAR_ADDRESS   0x62   /**< LIDAR-Lite v3 */
-#define IMU_ADDRESS     0x29   /**< BNO055        */
-
-/* ── IMU register-image types ─────────────────────────────────────────────── */
+#define IMU_ADDRESS     0x29   /**< BNO055, COM3 high (instance 0) */
+#define IMU_ADDRESS_ALT 0x28   /**< BNO055, COM3 low  (instance 1) */
 
-/**
- * @brief One 16-bit BNO055 field split into the LSB/MSB byte pair that maps
- *        directly onto two consecutive hardware registers.
- *
- * Example: GYR_DATA_X at registers 0x14 (LSB) and 0x15 (MSB).
- * The I2C ISR reads these bytes sequentially from the ping-pong buffer, so
- * the in-memory layout MUST match the register order.
+/* ── Packet types ─────────────────────────────────────────────────────────── */
+/*
+ * imu_data_t, rc_data_t and device_update_packet_t are defined in the
+ * hardware-independent core so the host replay harness can use them too.
  */
-typedef struct {
-    int8_t lsb;
-    int8_t msb;
-} i2c_imu_data_16_t;
+#include "hil_core/packet.h"
 
-/** @brief One axis triplet (X, Y, Z) — 6 bytes, maps to 6 consecutive regs. */
-typedef struct {
-    i2c_imu_data_16_t x;
-    i2c_imu_data_16_t y;
-    i2c_imu_data_16_t z;
-} i2c_imu_triplet_t;
+/* ── Packet pool and hand-off ─────────────────────────────────────────────── */
 
 /**
- * @brief Complete emulated IMU register image (18 bytes).
- *
- * Field ORDER IS LOAD-BEARING.  The ping-pong buffer in imu_emulator.c is
- * read byte-by-byte starting from whichever register address the DUT writes
- * before its read, so the struct layout must match the BNO055 register map.
+ * @brief Every decoded packet on the node lives here.
  *
- * BNO055 register map (subset emulated):
- *   euler_angles        0x1A – 0x1F  (6 bytes)
- *   linear_acceleration 0x28 – 0x2D  (6 bytes)  ← gap at 0x20–0x27 (quaternion)
- *   gyro                0x14 – 0x19  (6 bytes)
- *
- * @note The gap between euler (0x1F) and linear_accel (0x28) means the DUT
- *       must issue two separate I2C read transactions if it wants both groups
- *       contiguously.  Reads to unmapped registers return 0xFF.
+ * Initialised by the scheduler core (hil_sched_init); read by the
+ * injection ISR, the sensor thread and the emulator I2C ISRs through the
+ * indices they hold.
  */
-typedef struct {
-    i2c_imu_triplet_t euler_angles;         /**< regs 0x1A – 0x1F */
-    i2c_imu_triplet_t linear_acceleration;  /**< regs 0x28 – 0x2D */
-    i2c_imu_triplet_t gyro;                 /**< regs 0x14 – 0x19 */
-} imu_data_t;
-
-_Static_assert(sizeof(imu_data_t) == 18,
-               "imu_data_t must be exactly 18 bytes");
-
-/* ── RC command type ──────────────────────────────────────────────────────── */
+extern struct hil_pool packet_pool;
 
 /**
- * @brief RC axis commands decoded from the proto RcPayload.
- *
- * Range: -127 .. +127.  Both fields = 0 means no-op (hold current state).
- * The scheduler clamps the proto sint32 values to int8 on decode.
- */
-typedef struct {
-    int8_t rc_vert;   /**< Vertical   axis: negative = down, positive = up   */
-    int8_t rc_horiz;  /**< Horizontal axis: negative = left, positive = right */
-} rc_data_t;
-
-/* ── Combined update packet ───────────────────────────────────────────────── */
-
-/**
- * @brief Single packet carrying all sensor state for one simulation tick.
- *
- * The Pi sends IMU + LiDAR + RC together in every SPI frame.  All fields
- * are always populated — there is no sensor_id tag and no union.
- *
- * @note timestamp_us is expressed in the STM32's own µs epoch
- *       (k_cyc_to_us_near32(k_cycle_get_32())).  The Pi must synchronise
- *       to this epoch at startup via the SPI clock-sync handshake in main.c.
- *       If the epochs are misaligned, the injection timer will never fire
- *       (packets will always appear to be in the future).
- */
-typedef struct {
-    uint32_t   timestamp_us;       /**< STM32 µs epoch — causality gate value   */
-    imu_data_t imu_data;           /**< Full 18-byte BNO055 register image       */
-    uint16_t   lidar_distance_mm;  /**< LIDAR-Lite distance in millimetres       */
-    rc_data_t  rc_commands;        /**< RC axis commands (0,0 = no-op)           */
-} device_update_packet_t;
-
-/* ── 1-slot ISR gate queue ────────────────────────────────────────────────── */
-
-/**
- * @brief The causality gate between the injection timer ISR and the sensor thread.
- *
- * Exactly ONE slot.  Protocol:
- *   Writer (timer ISR only):  irq_lock → k_msgq_purge → k_msgq_put → irq_unlock
- *   Reader (sensor thread):   k_msgq_peek — NEVER k_msgq_get
+ * @brief Inject pool slot pkt: publish it to the emulators, then make it
+ *        the newest packet for the sensor thread.
  *
- * Keeping the slot permanently full (via peek-not-pop) means the ISR can
- * always safely call purge without checking for an empty queue first.
+ * The emulators take their own references.  The caller's reference goes to
+ * the thread's mailbox; a packet the thread has not picked up yet is
+ * released — only the newest state matters.
  *
- * Alignment 4: reduces internal padding and speeds up the memcpy inside
- * Zephyr's k_msgq internals on 32-bit Cortex-M.
+ * Context: injection alarm ISR, the emulators' only publisher.  Lock-free;
+ * wakes the sensor thread.
  */
-#define SENSOR_UPDATE_QUEUE_LEN  (1U)
-extern struct k_msgq sensor_update_q;
+void sensor_emulation_post(uint16_t pkt);
 
 /* ── Public API ───────────────────────────────────────────────────────────── */
 
 /**
  * @brief Initialise the sensor emulators and start the sensor emulation thread.
  *
- * Registers the I2C target callbacks for LiDAR (on i2c_lidar) and IMU
- * (on i2c_imu), then creates the sensor emulation thread.
+ * Registers one I2C target per configured IMU (on i2c_imu) and LiDAR (on
+ * i2c_lidar) instance, then creates the sensor emulation thread.
  *
  * Must be called BEFORE scheduler_init() so that the I2C targets are
  * registered before the first injection timer fires.
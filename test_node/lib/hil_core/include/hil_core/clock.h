@@ -0,0 +1,29 @@
+/**
+ * @file clock.h
+ * @brief 64-bit µs time from the free-running 32-bit injection counter.
+ *
+ * The counter wraps every 2^32 µs (≈ 71.6 min).  Packet timestamps and
+ * alarms stay 32-bit and compare modulo 2^32, which is exact for anything
+ * less than half a wrap apart.  Times that leave the node and must stay
+ * unambiguous over a multi-hour run (the MISO status timestamps the Pi
+ * servos its clock model on) use the extended value instead.
+ *
+ * Each call compares the raw value with the previous one and counts a wrap
+ * when it went backwards, so it must be called at least once per wrap.
+ * Not reentrant: the caller serialises calls (the shim holds a spinlock).
+ */
+
+#ifndef HIL_CORE_CLOCK_H
+#define HIL_CORE_CLOCK_H
+
+#include <stdint.h>
+
+struct hil_clock64 {
+    uint32_t last;  /**< raw counter value at the previous call */
+    uint32_t wraps; /**< completed 2^32 µs wraps                */
+};
+
+/** @brief Extend a raw counter reading taken now to 64 bits. */
+uint64_t hil_clock64_extend(struct hil_clock64 *c, uint32_t now);
+
+#endif /* HIL_CORE_CLOCK_H */
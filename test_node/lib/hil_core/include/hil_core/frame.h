@@ -0,0 +1,71 @@
+/**
+ * @file frame.h
+ * @brief SPI wire framing and SensorPacket decode.
+ *
+ * Wire frame format (2-byte LE length prefix)
+ * ────────────────────────────────────────────
+ *   [LEN_LOW][LEN_HIGH][protobuf payload ... ][zero-pad to 256 bytes]
+ *   Max payload = 254 bytes.
+ *
+ * Sync frame
+ * ──────────
+ *   bytes [0..1] = 0xFFFF  (marker)
+ *   bytes [2..5] = 0xC0FFEEEE  (little-endian magic)
+ *
+ * Decode
+ * ──────
+ *   The payload is a proto3 SensorPacket (shared/proto/sensor_data.proto).
+ *   The wire decoding is generated from the .proto by
+ *   tools/gen_proto_fields.py into sensor_data_pb.{h,c}; nanopb is only
+ *   available as a Zephyr module, and hil_core has to build the same
+ *   decoder on the host for hil_replay and the tests.  hil_frame_decode()
+ *   only maps the decoded SensorPacket onto device_update_packet_t.
+ */
+
+#ifndef HIL_CORE_FRAME_H
+#define HIL_CORE_FRAME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/packet.h"
+
+#define HIL_FRAME_SIZE         256U
+#define HIL_FRAME_HDR_SIZE     2U
+#define HIL_FRAME_MAX_PAYLOAD  (HIL_FRAME_SIZE - HIL_FRAME_HDR_SIZE)  /* 254 bytes */
+
+#define HIL_SYNC_MARKER  0xFFFFU
+#define HIL_SYNC_MAGIC   0xC0FFEEEEUL
+
+/**
+ * @brief Parse the 2-byte LE length prefix from a raw frame buffer.
+ * @return Payload length in bytes, or 0 if the header is invalid.
+ */
+uint16_t hil_frame_parse_len(const uint8_t *buf);
+
+/** @brief Return true if buf contains the Pi's clock-sync magic frame. */
+bool hil_frame_is_sync(const uint8_t *buf);
+
+/**
+ * @brief Decode a SensorPacket payload into a device update packet.
+ *
+ * Field mapping matches the scheduler's historical behaviour: each IMU
+ * sint32 is split into its BNO055 LSB/MSB register pair, lidar_mm is
+ * truncated to 16 bits and RC axes are clamped to -127..127.
+ *
+ * The legacy imu / lidar_mm fields fill instance 0; ImuRecord and
+ * RangeRecord entries fill the instance they name (a later one wins) and
+ * set its present[] bit; a record for instance 0 overrides the legacy
+ * fields wherever they sit in the payload.  Records for instances beyond HIL_PKT_IMUS /
+ * HIL_PKT_RANGES are skipped.
+ *
+ * @param payload  Protobuf bytes (after the length prefix).
+ * @param len      Payload length.
+ * @param out      Destination; zeroed first, so absent fields read as 0.
+ * @return true on success, false on malformed input.
+ */
+bool hil_frame_decode(const uint8_t *payload, size_t len,
+                      device_update_packet_t *out);
+
+#endif /* HIL_CORE_FRAME_H */
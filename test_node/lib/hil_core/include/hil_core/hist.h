@@ -0,0 +1,130 @@
+/**
+ * @file hist.h
+ * @brief Log2-bucketed latency histograms, ISR-safe to record into, plus the
+ *        compact binary dump the host tool (tools/hil_hist.c) renders.
+ *
+ * Buckets
+ * ───────
+ *   bucket 0      value 0
+ *   bucket k      values [2^(k-1), 2^k − 1]  µs
+ *   last bucket   everything ≥ 2^(HIL_HIST_BUCKETS-2)
+ *
+ * Power-of-two buckets cost one CLZ per sample and cover 1 µs to seconds in
+ * 24 counters; percentiles come back as the bucket's upper bound, which is
+ * plenty to see whether the tail is 10 µs or 1 ms.
+ *
+ * Windows
+ * ───────
+ *   Any context:   hil_hist_record(h, us);
+ *   Thread:        hil_hist_take(h, &w);   ← read and reset, one window
+ *
+ * take() swaps each counter to zero individually, so a sample recorded
+ * while it runs may land in this window or the next — never lost, never
+ * counted twice.  Its min/max may land in the other window than its count;
+ * take() clamps min/max into the lowest and highest non-empty bucket, so a
+ * window's extremes are always consistent with its counts, exact for every
+ * sample that did not race with take().
+ *
+ * Dump format (all integers little-endian)
+ * ────────────────────────────────────────
+ *   [0xD1][version=1][u16 window_ms][u8 n]  n × record  [u8 sum]
+ *   record:  [u8 id][u32 min][u32 max][u8 nb][nb × varint bucket count]
+ *   sum:     8-bit sum of every preceding byte
+ *
+ * nb stops at the highest non-empty bucket, so a quiet histogram costs
+ * 10 bytes.  On target the dump goes out hex-encoded on one console line
+ * prefixed "#H " so it survives being interleaved with log text.
+ */
+
+#ifndef HIL_CORE_HIST_H
+#define HIL_CORE_HIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/port.h"
+
+#define HIL_HIST_BUCKETS      (24U)
+#define HIL_HIST_DUMP_MAGIC   (0xD1U)
+#define HIL_HIST_DUMP_VERSION (1U)
+#define HIL_HIST_LINE_PREFIX  "#H "
+
+/** @brief Pipeline stage each histogram measures.  Values are wire ids. */
+enum hil_hist_id {
+    HIL_HIST_RX_TO_ENQUEUE = 0,  /**< SPI frame complete → published to ring */
+    HIL_HIST_ENQUEUE_TO_INJECT,  /**< published → delivered by the alarm     */
+    HIL_HIST_INJECT_LATE,        /**< delivered − packet.timestamp_us        */
+    HIL_HIST_IMU_AGE,            /**< IMU I2C read − served data timestamp   */
+    HIL_HIST_LIDAR_AGE,          /**< LiDAR I2C read − served data timestamp */
+    HIL_HIST_PUBLISH_LATE,       /**< sensor thread publish − packet.timestamp_us */
+    HIL_HIST_ID_COUNT,
+};
+
+/** @brief Short display name for id, or "?" if unknown. */
+const char *hil_hist_name(uint32_t id);
+
+/**
+ * @brief Live histogram.  All-zero is the empty state, so static storage
+ *        needs no init call.
+ */
+struct hil_hist {
+    hil_atomic_t bucket[HIL_HIST_BUCKETS];
+    hil_atomic_t min_inv;   /**< ~min, so the empty value is 0 */
+    hil_atomic_t max;
+};
+
+/** @brief One window's worth of samples, plain integers. */
+struct hil_hist_window {
+    uint32_t bucket[HIL_HIST_BUCKETS];
+    uint32_t min;   /**< UINT32_MAX if the window is empty */
+    uint32_t max;
+};
+
+void hil_hist_init(struct hil_hist *h);
+
+/** @brief Record one sample.  Lock-free; safe from ISRs. */
+void hil_hist_record(struct hil_hist *h, uint32_t us);
+
+/** @brief Move the samples recorded so far into out and start a new window. */
+void hil_hist_take(struct hil_hist *h, struct hil_hist_window *out);
+
+/** @brief Bucket index for a value. */
+static inline uint32_t hil_hist_bucket(uint32_t us)
+{
+    uint32_t k = (us == 0U) ? 0U : 32U - (uint32_t)__builtin_clz(us);
+    return (k < HIL_HIST_BUCKETS) ? k : HIL_HIST_BUCKETS - 1U;
+}
+
+/** @brief Largest value bucket k holds (UINT32_MAX for the last bucket). */
+uint32_t hil_hist_bucket_hi(uint32_t k);
+
+uint32_t hil_hist_count(const struct hil_hist_window *w);
+
+/**
+ * @brief Percentile as the upper bound of the bucket it falls in, clamped
+ *        to the window's max.  0 for an empty window.
+ */
+uint32_t hil_hist_pct(const struct hil_hist_window *w, uint32_t pct);
+
+/**
+ * @brief Encode n windows (wire id = array index) into buf.
+ * @return Bytes written, or 0 if cap is too small.
+ */
+size_t hil_hist_dump_encode(uint16_t window_ms, const struct hil_hist_window *w,
+                            size_t n, uint8_t *buf, size_t cap);
+
+/**
+ * @brief Decode a dump.  Records with id ≥ max_n are skipped.
+ *
+ * Windows that are not present in the dump are left untouched.
+ *
+ * @return Number of records in the dump, or -1 if it is malformed.
+ */
+int hil_hist_dump_decode(const uint8_t *buf, size_t len, uint16_t *window_ms,
+                         struct hil_hist_window *w, size_t max_n);
+
+/** @brief Worst-case encoded size of an n-record dump. */
+#define HIL_HIST_DUMP_MAX(n)  (6U + (n) * (10U + HIL_HIST_BUCKETS * 5U))
+
+#endif /* HIL_CORE_HIST_H */
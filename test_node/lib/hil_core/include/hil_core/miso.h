@@ -0,0 +1,109 @@
+/**
+ * @file miso.h
+ * @brief Node → Pi status frame, sent on MISO in every SPI transfer.
+ *
+ * The Pi clocks one 256-byte frame per SensorPacket.  The node fills its
+ * half of the same transfer with this status frame, so the Pi gets motor
+ * commands, DUT activity and node health back with no extra bus time.
+ *
+ * Frame (inside the usual [LEN_LOW][LEN_HIGH] prefix, little-endian)
+ * ──────────────────────────────────────────────────────────────────
+ *   off  size
+ *     0   1   magic 0xD3
+ *     1   1   version = 3
+ *     2   1   n — queued motor samples that follow (≤ HIL_MISO_MAX_SAMPLES)
+ *     3   1   flags — bit 0: latest is valid
+ *     4   4   seq         transfers the node completed before this one
+ *     8   8   rx_done_us  node time the previous transfer (seq − 1) completed
+ *    16   8   fill_us     node time this frame was filled
+ *    24   4   lost        motor samples dropped so far (ring overrun)
+ *    28  36   counters    9 × u32, in HIL_MISO_COUNTERS order
+ *    64  16   latest      newest motor sample, even if already sent
+ *    80  16n  samples     motor samples not sent before, oldest first
+ *
+ *   sample: [u32 ts_us][u16 duty × 4][u16 period_us][u8 fresh][u8 0]
+ *
+ * All times are in the injection counter epoch (packet.timestamp_us).
+ * rx_done_us and fill_us are the 64-bit extension (hil_core/clock.h), so
+ * they never wrap; sample ts_us is the raw 32-bit counter and wraps with it.
+ * rx_done_us is taken right after the node's transfer call returns; the Pi
+ * knows when its own transfer seq − 1 ended, so the pair is one
+ * (node time, Pi time) observation of the two clocks that the Pi's clock
+ * servo tracks.  fill_us is earlier than the transfer by however long the
+ * Pi took to start it.
+ *
+ * Counters are running totals since boot; the Pi differences them.  A
+ * frame whose length prefix is invalid, or whose magic / version do not
+ * match, carries no status (e.g. the node is not running yet).
+ */
+
+#ifndef HIL_CORE_MISO_H
+#define HIL_CORE_MISO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/frame.h"
+#include "hil_core/motor.h"
+
+#define HIL_MISO_MAGIC      (0xD3U)
+#define HIL_MISO_VERSION    (3U)
+#define HIL_MISO_HDR_SIZE   (80U)
+#define HIL_MISO_LATEST     (1U << 0)
+
+/** @brief Queued samples that fit one frame (10). */
+#define HIL_MISO_MAX_SAMPLES \
+    ((HIL_FRAME_MAX_PAYLOAD - HIL_MISO_HDR_SIZE) / HIL_MOTOR_SAMPLE_SIZE)
+
+/**
+ * @brief Node counters: X(member).  Wire order; append only.
+ */
+#define HIL_MISO_COUNTERS(X)                                                  \
+    X(spi_rx)        /* SensorPackets decoded                            */   \
+    X(decode_fail)   /* frames with a bad header or payload              */   \
+    X(spi_err)       /* SPI transfers that failed                        */   \
+    X(inject)        /* packets injected by the alarm                    */   \
+    X(sched_evict)   /* packets evicted from a full staging ring         */   \
+    X(superseded)    /* injected packets the sensor thread never saw     */   \
+    X(rc_drop)       /* RC commands invalid or dropped on a full TX ring */   \
+    X(imu_read)      /* DUT I2C read transactions on the IMU             */   \
+    X(lidar_read)    /* DUT I2C read transactions on the LiDAR           */
+
+struct hil_miso_counters {
+#define HIL_MISO_MEMBER(name) uint32_t name;
+    HIL_MISO_COUNTERS(HIL_MISO_MEMBER)
+#undef HIL_MISO_MEMBER
+};
+
+_Static_assert(sizeof(struct hil_miso_counters) == 36U,
+               "HIL_MISO_HDR_SIZE assumes 9 counters");
+
+struct hil_miso_status {
+    uint32_t seq;
+    uint64_t rx_done_us;
+    uint64_t fill_us;
+    uint32_t lost;
+    struct hil_miso_counters counters;
+    bool     has_latest;
+    struct hil_motor_sample latest;
+};
+
+/**
+ * @brief Fill a whole HIL_FRAME_SIZE frame (length prefix, payload, zero
+ *        padding) with st and n ≤ HIL_MISO_MAX_SAMPLES samples.
+ * @return Payload length, or 0 if n is too large.
+ */
+size_t hil_miso_encode(const struct hil_miso_status *st,
+                       const struct hil_motor_sample *s, size_t n,
+                       uint8_t frame[HIL_FRAME_SIZE]);
+
+/**
+ * @brief Decode a frame into st and at most max samples.
+ * @return Number of samples, or -1 if the frame holds no status.
+ */
+int hil_miso_decode(const uint8_t frame[HIL_FRAME_SIZE],
+                    struct hil_miso_status *st,
+                    struct hil_motor_sample *s, size_t max);
+
+#endif /* HIL_CORE_MISO_H */
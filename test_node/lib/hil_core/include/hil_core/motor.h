@@ -0,0 +1,111 @@
+/**
+ * @file motor.h
+ * @brief Motor PWM capture: fixed-point duty cycles from the four capture
+ *        channels, merged into time-aligned samples and queued on a ring.
+ *
+ * Samples
+ * ───────
+ *   Capture ISRs:  hil_motor_on_capture(m, ch, duty, period_us, now_us);
+ *   One thread:    hil_motor_read(m, &cursor, out, max, &lost);
+ *
+ * Every channel reports once per PWM period.  A sample is emitted as soon
+ * as all four channels have reported since the last one, so it holds one
+ * duty per motor from the same ESC update and is stamped with the time of
+ * the last capture that completed it.  If a channel reports a second time
+ * first (another motor's PWM stopped, so it never completes), the pending
+ * sample is emitted without it and its bit is clear in fresh.
+ *
+ * Duties are unsigned Q0.16: 0 = 0 %, 0xFFFF = 100 %.  Integer only, so
+ * the ISR never touches the FPU.
+ *
+ * Ring
+ * ────
+ * Single producer, overwrite-oldest.  The consumer keeps its own cursor; if
+ * it falls more than HIL_MOTOR_RING_LEN samples behind, it skips to the
+ * oldest one still in the ring and reports how many it lost.  Each slot
+ * carries a sequence number (odd while being written), so a read that
+ * raced the producer is detected and counted as lost, never returned torn.
+ *
+ * hil_motor_on_capture() is not reentrant: the shim must keep the capture
+ * ISRs from nesting (same priority, or a short irq_lock).
+ *
+ * The samples go to the Pi in the MISO status frame (hil_core/miso.h).
+ */
+
+#ifndef HIL_CORE_MOTOR_H
+#define HIL_CORE_MOTOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/port.h"
+
+#define HIL_MOTORS               (4U)
+#define HIL_MOTOR_ALL            ((1U << HIL_MOTORS) - 1U)
+#define HIL_MOTOR_SAMPLE_SIZE    (16U)
+
+/**
+ * @brief Sample slots.  Must be a power of two.
+ *
+ * 64 samples is 64 ms of a 1 kHz ESC update, so the Pi can miss a few
+ * frames without losing any.  Memory cost: 64 × (16 + seq) bytes.
+ */
+#ifndef HIL_MOTOR_RING_LEN
+#define HIL_MOTOR_RING_LEN  (64U)
+#endif
+
+_Static_assert((HIL_MOTOR_RING_LEN & (HIL_MOTOR_RING_LEN - 1U)) == 0U,
+               "HIL_MOTOR_RING_LEN must be a power of two");
+
+/** @brief One time-aligned motor command sample. */
+struct hil_motor_sample {
+    uint32_t ts_us;              /**< capture that completed it, packet epoch */
+    uint16_t duty[HIL_MOTORS];   /**< Q0.16                                    */
+    uint16_t period_us;          /**< PWM period of the completing channel     */
+    uint8_t  fresh;              /**< bit ch set: duty[ch] is from this update */
+    uint8_t  reserved;
+};
+
+_Static_assert(sizeof(struct hil_motor_sample) == HIL_MOTOR_SAMPLE_SIZE,
+               "motor sample is 16 bytes on the wire");
+
+struct hil_motor {
+    /* Producer side (capture ISRs only). */
+    struct hil_motor_sample pending;
+
+    struct hil_motor_sample slot[HIL_MOTOR_RING_LEN];
+    hil_atomic_t seq[HIL_MOTOR_RING_LEN];  /**< 2·pos+1 writing, 2·pos+2 done */
+    hil_atomic_t head;                     /**< samples emitted (free-running) */
+};
+
+void hil_motor_init(struct hil_motor *m);
+
+/**
+ * @brief pulse / period as Q0.16, saturated to 0xFFFF.
+ * @return 0 if period is 0.
+ */
+uint16_t hil_motor_duty_q16(uint32_t pulse_cycles, uint32_t period_cycles);
+
+/** @brief Producer: one channel finished a PWM period. */
+void hil_motor_on_capture(struct hil_motor *m, uint8_t ch, uint16_t duty_q16,
+                          uint16_t period_us, uint32_t now_us);
+
+/**
+ * @brief Consumer: copy up to max samples after *cursor into out.
+ *
+ * Advances *cursor past every sample it returns or skips and adds the
+ * skipped ones to *lost.
+ *
+ * @return Number of samples copied.
+ */
+size_t hil_motor_read(struct hil_motor *m, uint32_t *cursor,
+                      struct hil_motor_sample *out, size_t max, uint32_t *lost);
+
+/**
+ * @brief Copy the newest sample emitted so far into out.
+ * @return false if there is none yet (or it is being overwritten).
+ */
+bool hil_motor_latest(struct hil_motor *m, struct hil_motor_sample *out);
+
+#endif /* HIL_CORE_MOTOR_H */
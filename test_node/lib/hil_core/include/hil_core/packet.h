@@ -0,0 +1,212 @@
+/**
+ * @file packet.h
+ * @brief Hardware-independent HIL packet types shared by the scheduler core,
+ *        the Zephyr threads and the host replay harness.
+ *
+ * These used to live in threads/sensor_emulation_test.h and moved here so
+ * they can be compiled without Zephyr.  hil_frame_decode() fills them
+ * from the SensorPacket payload.
+ */
+
+#ifndef HIL_CORE_PACKET_H
+#define HIL_CORE_PACKET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/sensor_data_fields.h"
+
+/* ── IMU register-image types ─────────────────────────────────────────────── */
+
+/**
+ * @brief One 16-bit BNO055 field split into the LSB/MSB byte pair that maps
+ *        directly onto two consecutive hardware registers.
+ *
+ * Example: GYR_DATA_X at registers 0x14 (LSB) and 0x15 (MSB).
+ * The I2C ISR reads these bytes sequentially from the packet pool slot, so
+ * the in-memory layout MUST match the register order.
+ */
+typedef struct {
+    int8_t lsb;
+    int8_t msb;
+} i2c_imu_data_16_t;
+
+/** @brief One axis triplet (X, Y, Z) — 6 bytes, maps to 6 consecutive regs. */
+typedef struct {
+    i2c_imu_data_16_t x;
+    i2c_imu_data_16_t y;
+    i2c_imu_data_16_t z;
+} i2c_imu_triplet_t;
+
+/** @brief Quaternion (W, X, Y, Z) — 8 bytes, maps to 8 consecutive regs. */
+typedef struct {
+    i2c_imu_data_16_t w;
+    i2c_imu_data_16_t x;
+    i2c_imu_data_16_t y;
+    i2c_imu_data_16_t z;
+} i2c_imu_quad_t;
+
+/** @brief First and one-past-last BNO055 page-0 register in imu_data_t. */
+#define HIL_IMU_DATA_REG_FIRST  0x08U
+#define HIL_IMU_DATA_REG_END    0x34U
+
+/**
+ * @brief The BNO055 page-0 output data block, 0x08 – 0x33 (44 bytes).
+ *
+ * Field ORDER IS LOAD-BEARING.  The struct is the register block byte for
+ * byte, so the IMU emulator serves a burst read of any length from the pool
+ * slot by pointer increment: register r is byte r − HIL_IMU_DATA_REG_FIRST.
+ *
+ * BNO055 register map:
+ *   acceleration         0x08 – 0x0D  (6 bytes)
+ *   magnetometer         0x0E – 0x13  (6 bytes)
+ *   gyro                 0x14 – 0x19  (6 bytes)
+ *   euler_angles         0x1A – 0x1F  (6 bytes)
+ *   quaternion           0x20 – 0x27  (8 bytes)
+ *   linear_acceleration  0x28 – 0x2D  (6 bytes)
+ *   gravity              0x2E – 0x33  (6 bytes)
+ *
+ * Only gyro, euler_angles and linear_acceleration are on the wire today
+ * (ImuPayload); the rest decode as 0 until the Pi sends them.
+ *
+ * imu_data_t is byte-aligned, so it packs into device_update_packet_t's
+ * record arrays without padding.
+ */
+typedef struct {
+    i2c_imu_triplet_t acceleration;         /**< regs 0x08 – 0x0D */
+    i2c_imu_triplet_t magnetometer;         /**< regs 0x0E – 0x13 */
+    i2c_imu_triplet_t gyro;                 /**< regs 0x14 – 0x19 */
+    i2c_imu_triplet_t euler_angles;         /**< regs 0x1A – 0x1F */
+    i2c_imu_quad_t    quaternion;           /**< regs 0x20 – 0x27 */
+    i2c_imu_triplet_t linear_acceleration;  /**< regs 0x28 – 0x2D */
+    i2c_imu_triplet_t gravity;              /**< regs 0x2E – 0x33 */
+} imu_data_t;
+
+_Static_assert(sizeof(imu_data_t) == HIL_IMU_DATA_REG_END - HIL_IMU_DATA_REG_FIRST,
+               "imu_data_t must cover 0x08 - 0x33 with no padding");
+_Static_assert(offsetof(imu_data_t, gyro) == 0x14U - HIL_IMU_DATA_REG_FIRST &&
+               offsetof(imu_data_t, quaternion) == 0x20U - HIL_IMU_DATA_REG_FIRST &&
+               offsetof(imu_data_t, gravity) == 0x2EU - HIL_IMU_DATA_REG_FIRST,
+               "imu_data_t fields must sit at their BNO055 register offsets");
+
+/* ── RC command type ──────────────────────────────────────────────────────── */
+
+/**
+ * @brief RC axis commands decoded from the proto RcPayload.
+ *
+ * Range: -127 .. +127.  Both fields = 0 means no-op (hold current state).
+ * The scheduler clamps the proto sint32 values to int8 on decode.
+ */
+typedef struct {
+    int8_t rc_vert;   /**< Vertical   axis: negative = down, positive = up   */
+    int8_t rc_horiz;  /**< Horizontal axis: negative = left, positive = right */
+} rc_data_t;
+
+/* ── Sensor record schema ─────────────────────────────────────────────────── */
+
+/*
+ * Instances of each record kind a packet can carry.  On target these come
+ * from Kconfig (CONFIG_HIL_IMU_COUNT / CONFIG_HIL_RANGE_COUNT, pulled in by
+ * Zephyr's autoconf.h); the host build can override them with -D.
+ */
+#if defined(CONFIG_HIL_IMU_COUNT)
+#define HIL_PKT_IMUS    CONFIG_HIL_IMU_COUNT
+#elif !defined(HIL_PKT_IMUS)
+#define HIL_PKT_IMUS    2
+#endif
+
+#if defined(CONFIG_HIL_RANGE_COUNT)
+#define HIL_PKT_RANGES  CONFIG_HIL_RANGE_COUNT
+#elif !defined(HIL_PKT_RANGES)
+#define HIL_PKT_RANGES  2
+#endif
+
+/**
+ * @brief The sensor records a packet carries — the one table everything
+ *        else on the node is generated from.
+ *
+ *   X(KIND, member, count, type, proto_field)
+ *
+ *   KIND         enum hil_rec value HIL_REC_<KIND>
+ *   member       array in device_update_packet_t, count instances of type
+ *   proto_field  SensorPacket field of the repeated <Kind>Record message
+ *                that addresses an instance explicitly, as generated from
+ *                shared/proto/sensor_data.proto into sensor_data_fields.h
+ *
+ * Adding a sensor kind is one record message in the proto (then rerun
+ * tools/gen_proto_fields.py), one row here and a record callback in
+ * frame.c; the packet layout, presence masks and record offsets follow
+ * from the row.
+ */
+#define HIL_RECORDS(X)                                                           \
+    X(IMU,   imu,      HIL_PKT_IMUS,   imu_data_t, HIL_PB_SENSOR_PACKET_IMUS)    \
+    X(RANGE, range_mm, HIL_PKT_RANGES, uint16_t,   HIL_PB_SENSOR_PACKET_RANGES)
+
+enum hil_rec {
+#define HIL_REC_ENUM(KIND, member, count, type, field)  HIL_REC_##KIND,
+    HIL_RECORDS(HIL_REC_ENUM)
+#undef HIL_REC_ENUM
+    HIL_REC_KINDS,
+};
+
+/* ── Combined update packet ───────────────────────────────────────────────── */
+
+/**
+ * @brief All sensor state for one simulation tick, as a variable set of
+ *        sensor records.
+ *
+ * Each kind in HIL_RECORDS has a fixed array of instances; present[kind]
+ * has bit i set when the frame carried instance i.  Instance 0 of IMU and
+ * RANGE come from the legacy SensorPacket fields and are always present,
+ * so a Pi that only knows the original schema still drives the node.
+ * Emulators serve their record straight from the pool slot, at
+ * hil_rec_offset(kind, instance).
+ *
+ * @note timestamp_us is expressed in the STM32's own µs epoch (the 1 MHz
+ *       injection counter, see scheduler_now_us()), low 32 bits.  The Pi
+ *       tracks this clock from the MISO status timestamps (hil_core/miso.h).
+ *       If the epochs are misaligned, the injection alarm will never fire
+ *       (packets will always appear to be in the future).
+ */
+typedef struct {
+    uint32_t   timestamp_us;       /**< STM32 µs epoch — causality gate value   */
+    uint32_t   enqueue_us;         /**< STM32 µs when the core published it     */
+    uint8_t    present[HIL_REC_KINDS];  /**< instance bits carried by the frame */
+    rc_data_t  rc_commands;        /**< RC axis commands (0,0 = no-op)           */
+#define HIL_REC_MEMBER(KIND, member, count, type, field)  type member[count];
+    HIL_RECORDS(HIL_REC_MEMBER)
+#undef HIL_REC_MEMBER
+} device_update_packet_t;
+
+#define HIL_REC_CHECK(KIND, member, count, type, field) \
+    _Static_assert((count) >= 1 && (count) <= 8, #member " instances must fit present[]");
+HIL_RECORDS(HIL_REC_CHECK)
+#undef HIL_REC_CHECK
+
+/** @brief Byte offset of instance inst of a record kind in the packet. */
+static inline uint16_t hil_rec_offset(enum hil_rec kind, uint8_t inst)
+{
+    switch (kind) {
+#define HIL_REC_OFFSET(KIND, member, count, type, field)                        \
+    case HIL_REC_##KIND:                                                        \
+        return (uint16_t)(offsetof(device_update_packet_t, member) + inst * sizeof(type));
+    HIL_RECORDS(HIL_REC_OFFSET)
+#undef HIL_REC_OFFSET
+    default:
+        return 0;
+    }
+}
+
+/** @brief Instances of a record kind the packet has room for. */
+static inline uint8_t hil_rec_count(enum hil_rec kind)
+{
+    switch (kind) {
+#define HIL_REC_COUNT(KIND, member, count, type, field)  case HIL_REC_##KIND: return (count);
+    HIL_RECORDS(HIL_REC_COUNT)
+#undef HIL_REC_COUNT
+    default:
+        return 0;
+    }
+}
+
+#endif /* HIL_CORE_PACKET_H */
@@ -0,0 +1,94 @@
+/**
+ * @file pool.h
+ * @brief Refcounted packet pool — every decoded packet lives in one slot
+ *        from decode until the last reader lets go.
+ *
+ * The SPI frame is decoded once, straight into a pool slot.  From then on
+ * only the 16-bit slot index moves: through the staging ring, out of the
+ * injection alarm, into the sensor stage and into the emulators, which
+ * serve I2C reads directly from the slot.  No stage copies the packet.
+ *
+ * Ownership
+ * ─────────
+ *   hil_pool_alloc()  producer only (scheduler thread); returns ref = 1
+ *   hil_pool_get()    add a reference for a new holder
+ *   hil_pool_put()    drop one; at 0 the slot is free for alloc again
+ *
+ * Whoever holds a reference may read the slot.  Handing an index to the
+ * next stage hands over the reference with it; a stage that keeps the
+ * packet AND passes it on takes a get() first.
+ *
+ * Taking a reference from a shared "current" index (the emulators' active
+ * packet) is a load followed by get().  That is safe because only thread
+ * context allocates: a slot whose count drops to 0 between the load and the
+ * get() cannot be handed out again before the ISR doing the get() returns.
+ */
+
+#ifndef HIL_CORE_POOL_H
+#define HIL_CORE_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hil_core/packet.h"
+#include "hil_core/port.h"
+#include "hil_core/ring.h"
+
+/**
+ * @brief Slot count.
+ *
+ * The ring can pin HIL_RING_CAPACITY packets; the rest covers the slot
+ * being decoded, the one in the sensor stage mailbox and the ones the
+ * emulators and their in-flight I2C transactions hold.
+ *
+ * Memory cost: HIL_POOL_LEN × (sizeof(device_update_packet_t) + 4)
+ *   = 80 × 62 bytes ≈ 4.8 KiB of static RAM with one IMU and one range
+ *   record per packet; every extra IMU instance adds 44 bytes per slot
+ *   (≈ 3.4 KiB), every extra range instance 2.
+ */
+#ifndef HIL_POOL_LEN
+#define HIL_POOL_LEN  (HIL_RING_LEN + 16U)
+#endif
+
+#define HIL_POOL_NONE  (0xFFFFU)
+
+_Static_assert(HIL_POOL_LEN < HIL_POOL_NONE, "pool index must fit in uint16_t");
+
+struct hil_pool {
+    device_update_packet_t pkt[HIL_POOL_LEN];
+    hil_atomic_t ref[HIL_POOL_LEN];
+    uint16_t cursor;   /**< next slot alloc tries (producer-private) */
+};
+
+void hil_pool_init(struct hil_pool *p);
+
+/**
+ * @brief Producer: claim a free slot with one reference.
+ * @return Slot index, or HIL_POOL_NONE if every slot is in use.
+ */
+uint16_t hil_pool_alloc(struct hil_pool *p);
+
+/** @brief Add a reference.  ISR-safe. */
+static inline void hil_pool_get(struct hil_pool *p, uint16_t idx)
+{
+    hil_atomic_inc(&p->ref[idx]);
+}
+
+/** @brief Drop a reference.  HIL_POOL_NONE is ignored.  ISR-safe. */
+static inline void hil_pool_put(struct hil_pool *p, uint16_t idx)
+{
+    if (idx != HIL_POOL_NONE) {
+        (void)hil_atomic_dec(&p->ref[idx]);
+    }
+}
+
+/** @brief Packet in slot idx.  Only valid while holding a reference. */
+static inline device_update_packet_t *hil_pool_pkt(struct hil_pool *p, uint16_t idx)
+{
+    return &p->pkt[idx];
+}
+
+/** @brief Slots currently referenced, for diagnostics. */
+uint32_t hil_pool_in_use(struct hil_pool *p);
+
+#endif /* HIL_CORE_POOL_H */
@@ -0,0 +1,61 @@
+/**
+ * @file port.h
+ * @brief Minimal platform layer for the HIL core.
+ *
+ * The core only needs a handful of atomics and a fence.  On Zephyr they map
+ * onto atomic_t and the sys/barrier.h fences (ISR-safe on every arch Zephyr
+ * supports); everywhere else they map onto C11 <stdatomic.h> so the same
+ * code builds as a host library.
+ */
+
+#ifndef HIL_CORE_PORT_H
+#define HIL_CORE_PORT_H
+
+#include <stdbool.h>
+
+#if defined(__ZEPHYR__)
+
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
+
+typedef atomic_t hil_atomic_t;
+#define HIL_ATOMIC_INIT(v)  ATOMIC_INIT(v)
+
+static inline bool hil_atomic_cas(hil_atomic_t *a, long expected, long desired)
+{
+    return atomic_cas(a, (atomic_val_t)expected, (atomic_val_t)desired);
+}
+static inline void hil_atomic_set(hil_atomic_t *a, long v) { (void)atomic_set(a, (atomic_val_t)v); }
+static inline long hil_atomic_get(hil_atomic_t *a)         { return (long)atomic_get(a); }
+static inline void hil_atomic_inc(hil_atomic_t *a)         { (void)atomic_inc(a); }
+/** Decrements and returns the previous value. */
+static inline long hil_atomic_dec(hil_atomic_t *a)         { return (long)atomic_dec(a); }
+/** Stores v and returns the previous value. */
+static inline long hil_atomic_swap(hil_atomic_t *a, long v) { return (long)atomic_set(a, (atomic_val_t)v); }
+/** Full fence: plain loads/stores do not move across it (seqlock payloads). */
+static inline void hil_atomic_fence(void)                  { barrier_dmem_fence_full(); }
+
+#else /* host */
+
+#include <stdatomic.h>
+
+typedef atomic_long hil_atomic_t;
+#define HIL_ATOMIC_INIT(v)  (v)
+
+static inline bool hil_atomic_cas(hil_atomic_t *a, long expected, long desired)
+{
+    return atomic_compare_exchange_strong(a, &expected, desired);
+}
+static inline void hil_atomic_set(hil_atomic_t *a, long v) { atomic_store(a, v); }
+static inline long hil_atomic_get(hil_atomic_t *a)         { return atomic_load(a); }
+static inline void hil_atomic_inc(hil_atomic_t *a)         { (void)atomic_fetch_add(a, 1); }
+/** Decrements and returns the previous value. */
+static inline long hil_atomic_dec(hil_atomic_t *a)         { return atomic_fetch_sub(a, 1); }
+/** Stores v and returns the previous value. */
+static inline long hil_atomic_swap(hil_atomic_t *a, long v) { return atomic_exchange(a, v); }
+/** Full fence: plain loads/stores do not move across it (seqlock payloads). */
+static inline void hil_atomic_fence(void)                  { atomic_thread_fence(memory_order_seq_cst); }
+
+#endif
+
+#endif /* HIL_CORE_PORT_H */
@@ -0,0 +1,243 @@
+/**
+ * @file regemu.h
+ * @brief Table-driven register-map target emulator — the byte-level engine
+ *        behind every emulated I2C sensor.
+ *
+ * A sensor is described by a register map, not by code: one row per range
+ * of consecutive registers, saying where its bytes come from and what a
+ * write does.  The engine runs the target side of the usual "write register
+ * address, then read / write N auto-incrementing bytes" protocol against
+ * that table, so a new sensor (barometer, magnetometer, ToF) is a table
+ * plus whatever side-effect handlers its datasheet needs — no new ISR code.
+ *
+ * Row sources
+ * ───────────
+ *   HIL_REG_IMAGE   the instance's RAM register image, image[reg]; written
+ *                   in place unless the row is HIL_REG_RO or has a handler
+ *   HIL_REG_SNAP    bytes of the pinned packet, at .offset into the
+ *                   instance's sensor record (snap_base, see
+ *                   hil_rec_offset()); read-only.  Reads 0 while no packet
+ *                   has been published or the row's gate is off
+ *   HIL_REG_FN      .read(e, reg) computes each byte
+ *
+ * A row's .write handler, if set, replaces the default store for writes to
+ * any register in it (side effects, locks, page switches).  Registers no
+ * row covers read desc->unmapped and ignore writes.
+ *
+ * Snapshot groups
+ * ───────────────
+ * SNAP rows name a group.  The engine pins the device's active packet for
+ * each group (a pool reference, never a copy) so multi-byte values cannot
+ * tear:
+ *
+ *   default      pinned at the START of every read transaction, released
+ *                at STOP — the whole transaction reads one packet
+ *   HIL_REG_LATCH on a row: the group is re-pinned whenever a read reaches
+ *                that row's first register and held until the next latch,
+ *                so e.g. a MSB/LSB pair read in two transactions still
+ *                belongs to one sample
+ *
+ * Publication is the pool's: hil_regemu_publish() swaps the active index
+ * and drops the previous packet's reference, so any number of packets may
+ * be in flight between publisher and readers without a copy or a wait.
+ *
+ * Read fast path
+ * ──────────────
+ * The read cursor is a byte pointer plus the end of the contiguous run it
+ * lies in.  A run extends over consecutive rows whose bytes are adjacent in
+ * memory (image rows, or SNAP rows of one group with consecutive offsets
+ * and the same gate state); it stops before a latch row and at the end of
+ * the page.  Within a run the next byte is one compare and one
+ * post-increment (hil_regemu_read_next); only crossing a run boundary goes
+ * back through the row lookup, which is a table index, not a search.
+ *
+ * Concurrency
+ * ───────────
+ * Everything but hil_regemu_publish() runs in the bus ISR of one target.
+ * publish() has a single writer, which may be a thread or an ISR: it only
+ * gets and puts references, never allocates.  Taking a pin is a load of the
+ * active index followed by a get(), safe for the reason given in pool.h.
+ *
+ * Instances
+ * ─────────
+ * The map (desc) is const and shared; everything per device lives in
+ * struct hil_regemu — its images, the record it serves (snap_base) and the
+ * bus state — so redundant sensors of one model are one table and N
+ * instances, at different addresses on one bus or on several.
+ *
+ * Memory: HIL_REGEMU_PAGES × HIL_REGEMU_REGS = 256 bytes of row index per
+ * instance, plus the instance's own images.
+ */
+
+#ifndef HIL_CORE_REGEMU_H
+#define HIL_CORE_REGEMU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/pool.h"
+#include "hil_core/port.h"
+
+/** Register address space per page; addresses wrap at the top (7-bit). */
+#define HIL_REGEMU_REGS    (128U)
+#define HIL_REGEMU_PAGES   (2U)
+#define HIL_REGEMU_GROUPS  (4U)
+
+#define HIL_REGEMU_NO_ROW  (0xFFU)
+
+/** @brief Where a row's bytes come from. */
+enum hil_reg_src {
+    HIL_REG_IMAGE = 0,
+    HIL_REG_SNAP,
+    HIL_REG_FN,
+};
+
+/* Row flags */
+#define HIL_REG_RO     (1U << 0)   /**< writes ignored                         */
+#define HIL_REG_LATCH  (1U << 1)   /**< SNAP: reading .first re-pins the group */
+
+struct hil_regemu;
+
+typedef uint8_t (*hil_reg_read_fn)(struct hil_regemu *e, uint8_t reg);
+typedef void    (*hil_reg_write_fn)(struct hil_regemu *e, uint8_t reg, uint8_t val);
+
+/** @brief One map row: len consecutive registers starting at first. */
+struct hil_reg_def {
+    uint8_t  first;
+    uint8_t  len;
+    uint8_t  src;       /**< enum hil_reg_src                                */
+    uint8_t  flags;     /**< HIL_REG_RO, HIL_REG_LATCH                       */
+    uint8_t  group;     /**< SNAP: snapshot group, < HIL_REGEMU_GROUPS       */
+    uint8_t  gate;      /**< SNAP: bit of e->live that enables the row       */
+    uint16_t offset;    /**< SNAP: record offset of the byte at first        */
+    hil_reg_read_fn  read;    /**< FN only                                   */
+    hil_reg_write_fn write;   /**< optional, replaces the default store      */
+};
+
+/** @brief One register page: rows sorted by first, non-overlapping. */
+struct hil_reg_page {
+    const struct hil_reg_def *rows;
+    uint8_t  n_rows;
+};
+
+/** @brief Everything that makes one sensor model.  Usually const. */
+struct hil_regemu_desc {
+    const struct hil_reg_page *pages;
+    uint8_t n_pages;
+    uint8_t unmapped;   /**< value read from registers no row covers */
+
+    /** Read transaction started at reg (start-pinned groups already pinned). */
+    void (*on_read)(struct hil_regemu *e, uint8_t reg);
+    /** Group was (re)pinned; hil_regemu_snap() now returns the new packet. */
+    void (*on_pin)(struct hil_regemu *e, uint8_t group);
+};
+
+/** @brief Runtime state of one emulated target.  ISR-owned after init. */
+struct hil_regemu {
+    const struct hil_regemu_desc *desc;
+    struct hil_pool *pool;
+    void *ctx;                      /**< for the device's handlers */
+    uint8_t *image[HIL_REGEMU_PAGES];   /**< HIL_REGEMU_REGS bytes each, by register */
+    uint16_t snap_base;             /**< packet offset of the served record */
+
+    hil_atomic_t active;            /**< newest packet, one reference; HIL_POOL_NONE */
+    uint16_t snap[HIL_REGEMU_GROUPS];
+    uint8_t  start_groups;          /**< groups pinned per read transaction */
+    volatile uint32_t live;         /**< SNAP gates, all on after init */
+
+    uint8_t  page;
+    uint8_t  reg;                   /**< register the next byte belongs to */
+    bool     expect_reg;            /**< next written byte is an address */
+    uint8_t  fill;                  /**< backing byte for FN / unmapped reads */
+    const uint8_t *rd;              /**< read cursor and end of its run */
+    const uint8_t *rd_end;
+
+    uint8_t row_of[HIL_REGEMU_PAGES][HIL_REGEMU_REGS];
+};
+
+/**
+ * @brief Build the row index and reset the transaction state.
+ *
+ * @param images     one HIL_REGEMU_REGS-byte image per page of desc
+ * @param snap_base  packet offset of the record SNAP rows read from
+ *
+ * Does not touch the images; load their reset values before or after.
+ * Nothing is published until hil_regemu_publish().
+ */
+void hil_regemu_init(struct hil_regemu *e, const struct hil_regemu_desc *desc,
+                     uint8_t *const images[], uint16_t snap_base,
+                     struct hil_pool *pool, void *ctx);
+
+/**
+ * @brief Serve pool slot pkt from now on.  Takes its own reference; the
+ *        caller keeps its own.  Single writer; ISR-safe.
+ */
+void hil_regemu_publish(struct hil_regemu *e, uint16_t pkt);
+
+/* ── Bus events (ISR context) ─────────────────────────────────────────────── */
+
+/** @brief Controller starts a write: the next byte is a register address. */
+static inline void hil_regemu_write_start(struct hil_regemu *e)
+{
+    e->expect_reg = true;
+}
+
+void    hil_regemu_write_byte(struct hil_regemu *e, uint8_t val);
+uint8_t hil_regemu_read_start(struct hil_regemu *e);
+void    hil_regemu_stop(struct hil_regemu *e);
+
+/** @brief Slow path of hil_regemu_read_next(): point the cursor at e->reg. */
+void hil_regemu_seek(struct hil_regemu *e);
+
+/** @brief Next byte of a read.  Auto-increments the register pointer. */
+static inline uint8_t hil_regemu_read_next(struct hil_regemu *e)
+{
+    if (e->rd == e->rd_end) {
+        hil_regemu_seek(e);
+    }
+    e->reg = (uint8_t)((e->reg + 1U) & (HIL_REGEMU_REGS - 1U));
+    return *e->rd++;
+}
+
+/* ── Helpers for device handlers (ISR or init context) ───────────────────── */
+
+/** @brief Image byte of the current page — the default store. */
+static inline void hil_regemu_store(struct hil_regemu *e, uint8_t reg, uint8_t val)
+{
+    e->image[e->page][reg] = val;
+}
+
+/** @brief Select the page later accesses go to.  Ignored if out of range. */
+static inline void hil_regemu_set_page(struct hil_regemu *e, uint8_t page)
+{
+    if (page < e->desc->n_pages) {
+        e->page = page;
+    }
+}
+
+/** @brief Enable exactly the SNAP rows whose gate bit is set in mask. */
+static inline void hil_regemu_set_live(struct hil_regemu *e, uint32_t mask)
+{
+    e->live = mask;
+}
+
+/**
+ * @brief Packet group is pinned to, or an all-zero packet if none.
+ *        Valid until the group is released or re-pinned.
+ */
+const device_update_packet_t *hil_regemu_snap(const struct hil_regemu *e, uint8_t group);
+
+/** @brief The served record within hil_regemu_snap(e, group). */
+static inline const uint8_t *hil_regemu_snap_rec(const struct hil_regemu *e, uint8_t group)
+{
+    return (const uint8_t *)hil_regemu_snap(e, group) + e->snap_base;
+}
+
+/** @brief Index group is pinned to, or HIL_POOL_NONE. */
+static inline uint16_t hil_regemu_snap_idx(const struct hil_regemu *e, uint8_t group)
+{
+    return e->snap[group];
+}
+
+#endif /* HIL_CORE_REGEMU_H */
@@ -0,0 +1,114 @@
+/**
+ * @file ring.h
+ * @brief Lock-free single-producer / single-consumer staging ring between
+ *        the frame decoder and the injection timer.
+ *
+ * Entries are just the causality timestamp and a packet pool index
+ * (hil_core/pool.h); the packet itself never moves.  Each queued entry owns
+ * one pool reference, which passes to whoever removes it — the consumer on
+ * pop, the producer on eviction.
+ *
+ * When full, the OLDEST entry is evicted so the injector always works
+ * toward the most recent physics state rather than running perpetually
+ * behind the Pi.
+ *
+ * Protocol
+ * ────────
+ *   Producer (scheduler thread):
+ *     hil_ring_push(r, entry, &evicted);   ← evicts oldest if full
+ *
+ *   Consumer (timer ISR):
+ *     hil_ring_peek_ts(r, &ts);            ← next due time
+ *     hil_ring_pop(r, &e);                 ← or hil_ring_pop_due(r, now, &e)
+ *
+ * No locks and no kernel calls.  head is written only by the producer.
+ * tail is advanced by the consumer on pop and by the producer on eviction;
+ * both sides use CAS, so neither can lose the other's update.
+ *
+ * One slot is always kept free, so the slot being written never aliases a
+ * slot the consumer may be reading.  Usable capacity is HIL_RING_LEN − 1.
+ */
+
+#ifndef HIL_CORE_RING_H
+#define HIL_CORE_RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hil_core/port.h"
+
+/**
+ * @brief Slot count.  Must be a power of two.
+ *
+ * Memory cost: HIL_RING_LEN × sizeof(struct hil_ring_entry)
+ *   = 64 × 8 bytes = 512 bytes of static RAM.
+ */
+#ifndef HIL_RING_LEN
+#define HIL_RING_LEN  (64U)
+#endif
+
+#define HIL_RING_CAPACITY  (HIL_RING_LEN - 1U)
+
+_Static_assert((HIL_RING_LEN & (HIL_RING_LEN - 1U)) == 0U,
+               "HIL_RING_LEN must be a power of two");
+
+struct hil_ring_entry {
+    uint32_t timestamp_us;  /**< copy of the packet's causality gate value */
+    uint16_t pkt;           /**< pool index; the entry owns one reference  */
+};
+
+struct hil_ring {
+    struct hil_ring_entry slot[HIL_RING_LEN];
+    hil_atomic_t head;  /**< next write index (free-running uint32) */
+    hil_atomic_t tail;  /**< next read index  (free-running uint32) */
+};
+
+void hil_ring_init(struct hil_ring *r);
+
+/** @return Number of entries currently queued (a snapshot). */
+uint32_t hil_ring_count(struct hil_ring *r);
+
+/**
+ * @brief Producer: append an entry.
+ *
+ * @param evicted  Receives the oldest entry if the ring was full and it had
+ *                 to go.  Its pool reference now belongs to the caller.
+ * @return true if an entry was evicted.
+ */
+bool hil_ring_push(struct hil_ring *r, struct hil_ring_entry e,
+                   struct hil_ring_entry *evicted);
+
+/**
+ * @brief Consumer: timestamp of the oldest entry.
+ * @return false if the ring is empty.
+ */
+bool hil_ring_peek_ts(struct hil_ring *r, uint32_t *ts);
+
+/**
+ * @brief Consumer: remove the oldest entry into out.
+ * @return false if the ring is empty.
+ */
+bool hil_ring_pop(struct hil_ring *r, struct hil_ring_entry *out);
+
+/**
+ * @brief True if timestamp ts has been reached at time now.
+ *
+ * Signed difference, so it stays correct across the 2^32 µs wrap as long as
+ * the two are within ~35 minutes of each other.
+ */
+static inline bool hil_ts_due(uint32_t ts, uint32_t now)
+{
+    return (int32_t)(ts - now) <= 0;
+}
+
+/**
+ * @brief Consumer: remove the oldest entry only if it is due at now.
+ *
+ * The due check and the removal are one step, so an entry the producer
+ * evicts and replaces in between is never popped early.
+ *
+ * @return false if the ring is empty or the oldest entry is not yet due.
+ */
+bool hil_ring_pop_due(struct hil_ring *r, uint32_t now, struct hil_ring_entry *out);
+
+#endif /* HIL_CORE_RING_H */
@@ -0,0 +1,157 @@
+/**
+ * @file sched.h
+ * @brief Hardware-independent scheduler core: frame intake and timer-based
+ *        causality gating.
+ *
+ * The core owns the framing/decode step, the staging ring and the alarm
+ * arming logic.  Packets are decoded once into a caller-supplied packet
+ * pool (hil_core/pool.h) and travel through the core as pool indices.  Everything platform-specific — the clock, the one-shot
+ * alarm and the hand-off to the sensor emulators — is reached through
+ * struct hil_sched_port, so the same code runs under the
+ * Zephyr shim (threads/scheduler_test.c) and in the host replay harness.
+ *
+ * Alarms are absolute: the core asks for "fire at timestamp_us", never
+ * "fire in N µs", so ISR entry latency and the time spent computing a delay
+ * do not accumulate into the next injection.
+ *
+ * Contexts
+ * ────────
+ *   hil_sched_on_frame()  producer (scheduler thread)
+ *   hil_sched_on_timer()  consumer (alarm expiry — ISR on Zephyr)
+ */
+
+#ifndef HIL_CORE_SCHED_H
+#define HIL_CORE_SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hil_core/frame.h"
+#include "hil_core/packet.h"
+#include "hil_core/pool.h"
+#include "hil_core/port.h"
+#include "hil_core/ring.h"
+
+struct hil_sched_port {
+    void *ctx;
+
+    /** Current time in the packet timestamp epoch (µs, wraps at 2^32). */
+    uint32_t (*now_us)(void *ctx);
+
+    /**
+     * Arm the one-shot injection alarm for absolute time target_us in the
+     * now_us() epoch.  A target at or before now must fire as soon as
+     * possible, not after a wrap.
+     *
+     * @return false if the alarm could not be armed.
+     */
+    bool (*alarm_at)(void *ctx, uint32_t target_us);
+
+    /**
+     * Hand a due packet to the sensor emulators.  Called from on_timer.
+     * The reference on pool slot pkt passes to the callee, which must
+     * hil_pool_put() it once done.
+     */
+    void (*deliver)(void *ctx, uint16_t pkt);
+};
+
+/** @brief Outcome of hil_sched_on_frame(). */
+enum hil_frame_status {
+    HIL_FRAME_OK = 0,       /**< decoded and queued                      */
+    HIL_FRAME_SYNC,         /**< clock-sync frame, ignored in stream mode */
+    HIL_FRAME_BAD_LEN,      /**< invalid length prefix                   */
+    HIL_FRAME_DECODE_FAIL,  /**< malformed protobuf payload              */
+    HIL_FRAME_NO_SLOT,      /**< packet pool exhausted, frame dropped    */
+};
+
+/**
+ * @brief Lateness histogram bucket count.
+ *
+ * Bucket k < HIL_LATE_BUCKETS − 1 counts injections that were k µs late;
+ * the last bucket collects everything later than that.
+ */
+#ifndef HIL_LATE_BUCKETS
+#define HIL_LATE_BUCKETS  (64U)
+#endif
+
+/** @brief Injection lateness (fire time − target timestamp) in µs. */
+struct hil_sched_lateness {
+    uint32_t bucket[HIL_LATE_BUCKETS];
+    uint32_t max_us;
+};
+
+/** @brief Counters kept by the core.  Plain integers — read from thread context. */
+struct hil_sched_stats {
+    uint32_t frames;         /**< on_frame calls                         */
+    uint32_t queued;         /**< packets pushed to the ring             */
+    uint32_t sync;           /**< sync frames seen                       */
+    uint32_t bad_len;        /**< invalid length prefix                  */
+    uint32_t decode_fail;    /**< protobuf decode failures               */
+    uint32_t no_slot;        /**< frames dropped for want of a pool slot */
+    uint32_t evicted;        /**< oldest-evictions from a full ring      */
+    uint32_t injected;       /**< packets delivered by on_timer          */
+    uint32_t coalesced;      /**< due packets skipped for a newer one    */
+    uint32_t empty_fire;     /**< alarm fired with nothing due           */
+    uint32_t arm_fail;       /**< port alarm_at() refused                */
+    struct hil_sched_lateness late;
+};
+
+struct hil_sched {
+    const struct hil_sched_port *port;
+    struct hil_pool *pool;
+    struct hil_ring ring;
+    /** 0 = alarm idle, 1 = alarm pending.  CAS prevents double-arming. */
+    hil_atomic_t timer_armed;
+    struct hil_sched_stats stats;
+};
+
+/**
+ * @brief Reset the core.
+ * @param pool  Packet pool shared with the port; initialised here.
+ */
+void hil_sched_init(struct hil_sched *s, const struct hil_sched_port *port,
+                    struct hil_pool *pool);
+
+/**
+ * @brief Process one raw HIL_FRAME_SIZE-byte SPI frame.
+ *
+ * Parses the length prefix, decodes the payload straight into a fresh
+ * pool slot, queues its index (evicting the oldest entry if full) and arms
+ * the alarm if it is idle.
+ *
+ * @param buf      HIL_FRAME_SIZE bytes as received.
+ * @param pkt_ref  If non-NULL, receives the slot index on HIL_FRAME_OK with
+ *                 an extra reference the caller must hil_pool_put();
+ *                 HIL_POOL_NONE otherwise.
+ * @param evicted  If non-NULL, set to true when the push evicted a packet.
+ */
+enum hil_frame_status hil_sched_on_frame(struct hil_sched *s,
+                                         const uint8_t *buf,
+                                         uint16_t *pkt_ref,
+                                         bool *evicted);
+
+/**
+ * @brief Injection alarm expiry.
+ *
+ * Drains every packet that is due, delivers only the newest of them (the
+ * older ones are stale the moment a newer state is due) and records how
+ * late the pass ran against the oldest drained timestamp.  Then re-arms for
+ * the next queued packet.  A packet that is not yet due is left in the ring,
+ * so an early or stale alarm never serves state from the future.
+ * Must not block.
+ */
+void hil_sched_on_timer(struct hil_sched *s);
+
+/** @brief Ring occupancy, for diagnostics. */
+uint32_t hil_sched_ring_count(struct hil_sched *s);
+
+/**
+ * @brief Lateness percentile from the histogram.
+ *
+ * @param pct  0–100.
+ * @return Bucket value in µs (HIL_LATE_BUCKETS − 1 means "at least that"),
+ *         or 0 if nothing has been injected.
+ */
+uint32_t hil_sched_late_pct(const struct hil_sched_lateness *h, uint32_t pct);
+
+#endif /* HIL_CORE_SCHED_H */
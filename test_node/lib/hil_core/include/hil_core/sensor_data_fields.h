@@ -0,0 +1,44 @@
+/**
+ * @file sensor_data_fields.h
+ * @brief SensorPacket field numbers.
+ *
+ * Generated by tools/gen_proto_fields.py from
+ * shared/proto/sensor_data.proto.  DO NOT EDIT; rerun the script after
+ * changing the schema (CI fails while this file is out of date).
+ */
+
+#ifndef HIL_CORE_SENSOR_DATA_FIELDS_H
+#define HIL_CORE_SENSOR_DATA_FIELDS_H
+
+/* ImuPayload */
+#define HIL_PB_IMU_PAYLOAD_GYRO_X     1   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_GYRO_Y     2   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_GYRO_Z     3   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_EULER_X    4   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_EULER_Y    5   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_EULER_Z    6   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_LIN_ACC_X  7   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_LIN_ACC_Y  8   /* sint32 */
+#define HIL_PB_IMU_PAYLOAD_LIN_ACC_Z  9   /* sint32 */
+
+/* RcPayload */
+#define HIL_PB_RC_PAYLOAD_VERTICAL    1   /* sint32 */
+#define HIL_PB_RC_PAYLOAD_HORIZONTAL  2   /* sint32 */
+
+/* ImuRecord */
+#define HIL_PB_IMU_RECORD_INSTANCE  1   /* uint32 */
+#define HIL_PB_IMU_RECORD_IMU       2   /* ImuPayload */
+
+/* RangeRecord */
+#define HIL_PB_RANGE_RECORD_INSTANCE     1   /* uint32 */
+#define HIL_PB_RANGE_RECORD_DISTANCE_MM  2   /* uint32 */
+
+/* SensorPacket */
+#define HIL_PB_SENSOR_PACKET_TIMESTAMP_US  1   /* uint32 */
+#define HIL_PB_SENSOR_PACKET_LIDAR_MM      2   /* uint32 */
+#define HIL_PB_SENSOR_PACKET_IMU           3   /* ImuPayload */
+#define HIL_PB_SENSOR_PACKET_RC            4   /* RcPayload */
+#define HIL_PB_SENSOR_PACKET_IMUS          5   /* repeated ImuRecord */
+#define HIL_PB_SENSOR_PACKET_RANGES        6   /* repeated RangeRecord */
+
+#endif /* HIL_CORE_SENSOR_DATA_FIELDS_H */
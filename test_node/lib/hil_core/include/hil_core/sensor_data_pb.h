@@ -0,0 +1,82 @@
+/**
+ * @file sensor_data_pb.h
+ * @brief SensorPacket messages as plain structs, and their decoders.
+ *
+ * Generated by tools/gen_proto_fields.py from
+ * shared/proto/sensor_data.proto.  DO NOT EDIT; rerun the script after
+ * changing the schema (CI fails while this file is out of date).
+ *
+ * Each message decodes into a struct with the .proto's field names.
+ * Decoding merges into *out: a scalar takes the last value on the wire
+ * and an embedded message merges, as proto3 specifies, so zero *out
+ * first for a fresh message.  Unknown fields, and known ones with a
+ * different wire type, are skipped.  Repeated message fields are not
+ * stored: each element is decoded on its own and handed to the callback
+ * in hil_pb_<message>_cb_t (NULL ignores them); returning false from it
+ * fails the decode.
+ */
+
+#ifndef HIL_CORE_SENSOR_DATA_PB_H
+#define HIL_CORE_SENSOR_DATA_PB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ImuPayload */
+typedef struct {
+    int32_t gyro_x;
+    int32_t gyro_y;
+    int32_t gyro_z;
+    int32_t euler_x;
+    int32_t euler_y;
+    int32_t euler_z;
+    int32_t lin_acc_x;
+    int32_t lin_acc_y;
+    int32_t lin_acc_z;
+} hil_pb_imu_payload_t;
+
+bool hil_pb_decode_imu_payload(const uint8_t *buf, size_t len, hil_pb_imu_payload_t *out);
+
+/* RcPayload */
+typedef struct {
+    int32_t vertical;
+    int32_t horizontal;
+} hil_pb_rc_payload_t;
+
+bool hil_pb_decode_rc_payload(const uint8_t *buf, size_t len, hil_pb_rc_payload_t *out);
+
+/* ImuRecord */
+typedef struct {
+    uint32_t             instance;
+    hil_pb_imu_payload_t imu;
+} hil_pb_imu_record_t;
+
+bool hil_pb_decode_imu_record(const uint8_t *buf, size_t len, hil_pb_imu_record_t *out);
+
+/* RangeRecord */
+typedef struct {
+    uint32_t instance;
+    uint32_t distance_mm;
+} hil_pb_range_record_t;
+
+bool hil_pb_decode_range_record(const uint8_t *buf, size_t len, hil_pb_range_record_t *out);
+
+/* SensorPacket */
+typedef struct {
+    uint32_t             timestamp_us;
+    uint32_t             lidar_mm;
+    hil_pb_imu_payload_t imu;
+    hil_pb_rc_payload_t  rc;
+} hil_pb_sensor_packet_t;
+
+typedef struct {
+    void *ctx;
+    bool (*imus)(void *ctx, const hil_pb_imu_record_t *msg);
+    bool (*ranges)(void *ctx, const hil_pb_range_record_t *msg);
+} hil_pb_sensor_packet_cb_t;
+
+bool hil_pb_decode_sensor_packet(const uint8_t *buf, size_t len, hil_pb_sensor_packet_t *out,
+        const hil_pb_sensor_packet_cb_t *cb);
+
+#endif /* HIL_CORE_SENSOR_DATA_PB_H */
@@ -0,0 +1,148 @@
+/**
+ * @file trace.h
+ * @brief Fixed-size binary trace records for the hot path, a lock-free ring
+ *        to collect them in, and the dump the host decoder
+ *        (tools/hil_trace.c) turns back into text.
+ *
+ * A record is 16 bytes: timestamp, event id and three arguments.  Nothing
+ * is formatted on target; the event table below carries each event's name
+ * and printf format, and only the host tool ever applies them.  Emitting a
+ * record costs one CAS and five stores, so it is safe and cheap inside the
+ * alarm ISR and the I2C target callbacks, where text logging is not.
+ *
+ * Ring
+ * ────
+ *   Any context:   hil_trace_put(t, &rec);   ← drops (and counts) if full
+ *   One thread:    hil_trace_get(t, &rec);   ← oldest committed record
+ *
+ * Multi-producer, single-consumer.  Every slot carries a sequence number:
+ * a producer claims a slot by CAS on head, fills it, then publishes it by
+ * storing the sequence; the consumer only takes a slot whose sequence says
+ * it is complete.  A producer preempted between claim and publish delays
+ * the consumer at that slot but never exposes a half-written record.
+ * When full the NEWEST record is dropped, so a stalled drain loses the
+ * end of a burst, never the start of it.
+ *
+ * Dump format (all integers little-endian)
+ * ────────────────────────────────────────
+ *   [0xD2][version=1][u8 ring][u8 n][u32 dropped]  n × record  [u8 sum]
+ *   record:  [u32 ts][u16 id][u16 a0][u32 a1][u32 a2]
+ *   sum:     8-bit sum of every preceding byte
+ *
+ * dropped is the ring's running drop count, so the decoder reports a gap
+ * wherever it grows.  On target each dump goes out hex-encoded on one
+ * console line prefixed "#T ", like the "#H " histogram lines.
+ */
+
+#ifndef HIL_CORE_TRACE_H
+#define HIL_CORE_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hil_core/port.h"
+
+#define HIL_TRACE_DUMP_MAGIC   (0xD2U)
+#define HIL_TRACE_DUMP_VERSION (1U)
+#define HIL_TRACE_LINE_PREFIX  "#T "
+
+/**
+ * @brief Slot count.  Must be a power of two.
+ *
+ * Memory cost: HIL_TRACE_LEN × (sizeof(struct hil_trace_rec) + seq)
+ *   = 256 × 20 bytes = 5 KiB of static RAM per ring.
+ */
+#ifndef HIL_TRACE_LEN
+#define HIL_TRACE_LEN  (256U)
+#endif
+
+_Static_assert((HIL_TRACE_LEN & (HIL_TRACE_LEN - 1U)) == 0U,
+               "HIL_TRACE_LEN must be a power of two");
+
+/**
+ * @brief Event table: X(id, name, format).
+ *
+ * The format is applied on the host to (a0, a1, a2) in that order, all
+ * passed as 32-bit integers; a0 is only 16 bits wide.  Append new events
+ * at the end so existing ids (wire values) keep their meaning.
+ *
+ * I2C events: target = (enum hil_rec << 8) | instance, pkt = pool index of
+ * the snapshot the read pinned (0xFFFF, HIL_POOL_NONE, if none).
+ */
+#define HIL_TRACE_EVENTS(X)                                                        \
+    X(HIL_TEV_RX,        "rx",        "frame #%u ts=%u lidar=%u mm")               \
+    X(HIL_TEV_RX_RC,     "rx_rc",     "ring=%u rc=(%d,%d)")                        \
+    X(HIL_TEV_INJECT,    "inject",    "lidar=%u mm ts=%u euler_x=%d")              \
+    X(HIL_TEV_I2C_READ,  "i2c_read",  "reg=0x%02X target=0x%04X pkt=%u")           \
+    X(HIL_TEV_I2C_WRITE, "i2c_write", "reg=0x%02X target=0x%04X val=0x%02X")       \
+    X(HIL_TEV_I2C_STOP,  "i2c_stop",  "next_reg=0x%02X target=0x%04X")             \
+    X(HIL_TEV_RC_TX,     "rc_tx",     "vert=%c horiz=%c queued=%u")
+
+#define HIL_TRACE_ENUM(id, name, fmt) id,
+enum hil_trace_event {
+    HIL_TRACE_EVENTS(HIL_TRACE_ENUM)
+    HIL_TEV_COUNT,
+};
+#undef HIL_TRACE_ENUM
+
+/** @brief One trace record, exactly as it goes on the wire. */
+struct hil_trace_rec {
+    uint32_t ts;    /**< µs, injection counter epoch (scheduler_now_us()) */
+    uint16_t id;    /**< enum hil_trace_event                             */
+    uint16_t a0;
+    uint32_t a1;
+    uint32_t a2;
+};
+
+_Static_assert(sizeof(struct hil_trace_rec) == 16U, "trace record is 16 bytes on the wire");
+
+struct hil_trace {
+    struct hil_trace_rec slot[HIL_TRACE_LEN];
+    hil_atomic_t seq[HIL_TRACE_LEN];  /**< pos + 1 once slot pos is written */
+    hil_atomic_t head;      /**< next slot to claim (free-running) */
+    hil_atomic_t tail;      /**< next slot to read  (consumer only) */
+    hil_atomic_t dropped;   /**< records lost to a full ring       */
+};
+
+void hil_trace_init(struct hil_trace *t);
+
+/** @brief Append a record.  Lock-free; safe from ISRs and any thread. */
+void hil_trace_put(struct hil_trace *t, const struct hil_trace_rec *rec);
+
+/**
+ * @brief Consumer: remove the oldest complete record into out.
+ * @return false if the ring is empty (or its oldest slot is mid-write).
+ */
+bool hil_trace_get(struct hil_trace *t, struct hil_trace_rec *out);
+
+/** @brief Records dropped since init. */
+uint32_t hil_trace_dropped(struct hil_trace *t);
+
+/** @brief Short display name for id, or "?" if unknown. */
+const char *hil_trace_name(uint32_t id);
+
+/** @brief Host printf format for id's arguments, or NULL if unknown. */
+const char *hil_trace_format(uint32_t id);
+
+/** @brief Encoded size of an n-record dump. */
+#define HIL_TRACE_DUMP_SIZE(n)  (9U + (n) * sizeof(struct hil_trace_rec))
+
+/**
+ * @brief Encode n records from ring ring_id into buf.
+ * @return Bytes written, or 0 if cap is too small.
+ */
+size_t hil_trace_dump_encode(uint8_t ring_id, uint32_t dropped,
+                             const struct hil_trace_rec *rec, size_t n,
+                             uint8_t *buf, size_t cap);
+
+/**
+ * @brief Decode a dump into at most max_n records.
+ * @return Number of records in the dump, or -1 if it is malformed or
+ *         holds more than max_n.
+ */
+int hil_trace_dump_decode(const uint8_t *buf, size_t len, uint8_t *ring_id,
+                          uint32_t *dropped, struct hil_trace_rec *rec,
+                          size_t max_n);
+
+#endif /* HIL_CORE_TRACE_H */
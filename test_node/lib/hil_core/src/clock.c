@@ -0,0 +1,15 @@
+/**
+ * @file clock.c
+ * @brief 64-bit counter extension.  See hil_core/clock.h.
+ */
+
+#include "hil_core/clock.h"
+
+uint64_t hil_clock64_extend(struct hil_clock64 *c, uint32_t now)
+{
+    if (now < c->last) {
+        c->wraps++;
+    }
+    c->last = now;
+    return ((uint64_t)c->wraps << 32) | now;
+}
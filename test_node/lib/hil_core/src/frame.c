@@ -0,0 +1,124 @@
+/**
+ * @file frame.c
+ * @brief SPI wire framing and SensorPacket decode (see frame.h).
+ */
+
+#include "hil_core/frame.h"
+
+#include "hil_core/sensor_data_pb.h"
+
+#include <string.h>
+
+/* ── Framing ──────────────────────────────────────────────────────────────── */
+
+uint16_t hil_frame_parse_len(const uint8_t *buf)
+{
+    uint16_t len = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
+    if (len == 0 || len > HIL_FRAME_MAX_PAYLOAD) {
+        return 0;
+    }
+    return len;
+}
+
+bool hil_frame_is_sync(const uint8_t *buf)
+{
+    uint16_t marker = (uint16_t)buf[0] | ((uint16_t)buf[1] << 8);
+    uint32_t magic  = (uint32_t)buf[2]
+                    | ((uint32_t)buf[3] << 8)
+                    | ((uint32_t)buf[4] << 16)
+                    | ((uint32_t)buf[5] << 24);
+    return (marker == HIL_SYNC_MARKER && magic == HIL_SYNC_MAGIC);
+}
+
+/* ── SensorPacket ─────────────────────────────────────────────────────────── */
+
+static inline int8_t clamp_rc(int32_t v)
+{
+    return (int8_t)(v < -127 ? -127 : (v > 127 ? 127 : v));
+}
+
+/* Splits a BNO055 register value into its LSB/MSB pair. */
+static inline void put_reg16(i2c_imu_data_16_t *reg, int32_t v)
+{
+    reg->lsb = (int8_t)( v       & 0xFF);
+    reg->msb = (int8_t)((v >> 8) & 0xFF);
+}
+
+static void put_imu(imu_data_t *imu, const hil_pb_imu_payload_t *pb)
+{
+    put_reg16(&imu->gyro.x,                pb->gyro_x);
+    put_reg16(&imu->gyro.y,                pb->gyro_y);
+    put_reg16(&imu->gyro.z,                pb->gyro_z);
+    put_reg16(&imu->euler_angles.x,        pb->euler_x);
+    put_reg16(&imu->euler_angles.y,        pb->euler_y);
+    put_reg16(&imu->euler_angles.z,        pb->euler_z);
+    put_reg16(&imu->linear_acceleration.x, pb->lin_acc_x);
+    put_reg16(&imu->linear_acceleration.y, pb->lin_acc_y);
+    put_reg16(&imu->linear_acceleration.z, pb->lin_acc_z);
+}
+
+/*
+ * Records land in the packet as they are decoded.  A record for instance 0
+ * takes precedence over the legacy imu / lidar_mm fields, wherever either
+ * appears in the payload, so those are only applied afterwards.
+ */
+typedef struct {
+    device_update_packet_t *out;
+    bool imu0;
+    bool range0;
+} record_ctx_t;
+
+/* Instances this node was not built for are dropped, not an error. */
+static bool on_imu_record(void *ctx, const hil_pb_imu_record_t *rec)
+{
+    record_ctx_t *rc = ctx;
+    if (rec->instance < HIL_PKT_IMUS) {
+        put_imu(&rc->out->imu[rec->instance], &rec->imu);
+        rc->out->present[HIL_REC_IMU] |= (uint8_t)(1U << rec->instance);
+        rc->imu0 |= (rec->instance == 0);
+    }
+    return true;
+}
+
+static bool on_range_record(void *ctx, const hil_pb_range_record_t *rec)
+{
+    record_ctx_t *rc = ctx;
+    if (rec->instance < HIL_PKT_RANGES) {
+        rc->out->range_mm[rec->instance] = (uint16_t)(rec->distance_mm & 0xFFFFU);
+        rc->out->present[HIL_REC_RANGE] |= (uint8_t)(1U << rec->instance);
+        rc->range0 |= (rec->instance == 0);
+    }
+    return true;
+}
+
+bool hil_frame_decode(const uint8_t *payload, size_t len,
+                      device_update_packet_t *out)
+{
+    hil_pb_sensor_packet_t pb;
+    record_ctx_t ctx = { .out = out };
+    const hil_pb_sensor_packet_cb_t cb = {
+        .ctx    = &ctx,
+        .imus   = on_imu_record,
+        .ranges = on_range_record,
+    };
+
+    memset(out, 0, sizeof(*out));
+    memset(&pb, 0, sizeof(pb));
+    if (!hil_pb_decode_sensor_packet(payload, len, &pb, &cb)) {
+        return false;
+    }
+
+    /* Instance 0 of the legacy fields is implied by every frame. */
+    out->timestamp_us = pb.timestamp_us;
+    out->rc_commands.rc_vert  = clamp_rc(pb.rc.vertical);
+    out->rc_commands.rc_horiz = clamp_rc(pb.rc.horizontal);
+    if (!ctx.imu0) {
+        put_imu(&out->imu[0], &pb.imu);
+    }
+    if (!ctx.range0) {
+        out->range_mm[0] = (uint16_t)(pb.lidar_mm & 0xFFFFU);
+    }
+    out->present[HIL_REC_IMU]   |= 1U;
+    out->present[HIL_REC_RANGE] |= 1U;
+    return true;
+}
@@ -0,0 +1,285 @@
+/**
+ * @file hist.c
+ * @brief Log2 latency histograms and their dump format (see hist.h).
+ *
+ * Counters are stored in hil_atomic_t but always converted through
+ * uint32_t, as in ring.c, so min/max compare the same way on a 32-bit
+ * target and a 64-bit host.
+ */
+
+#include "hil_core/hist.h"
+
+#include <string.h>
+
+static const char *const hist_names[HIL_HIST_ID_COUNT] = {
+    [HIL_HIST_RX_TO_ENQUEUE]     = "rx->enq",
+    [HIL_HIST_ENQUEUE_TO_INJECT] = "enq->inj",
+    [HIL_HIST_INJECT_LATE]       = "inj_late",
+    [HIL_HIST_IMU_AGE]           = "imu_age",
+    [HIL_HIST_LIDAR_AGE]         = "lidar_age",
+    [HIL_HIST_PUBLISH_LATE]      = "pub_late",
+};
+
+const char *hil_hist_name(uint32_t id)
+{
+    return (id < HIL_HIST_ID_COUNT) ? hist_names[id] : "?";
+}
+
+/* ── Recording ────────────────────────────────────────────────────────────── */
+
+void hil_hist_init(struct hil_hist *h)
+{
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        hil_atomic_set(&h->bucket[k], 0);
+    }
+    hil_atomic_set(&h->min_inv, 0);
+    hil_atomic_set(&h->max, 0);
+}
+
+void hil_hist_record(struct hil_hist *h, uint32_t us)
+{
+    hil_atomic_inc(&h->bucket[hil_hist_bucket(us)]);
+
+    /*
+     * Retry only while this sample still improves on the stored extreme.
+     * min is kept inverted so both updates are "store if larger".
+     */
+    uint32_t inv = ~us;
+    uint32_t cur;
+    do {
+        cur = (uint32_t)hil_atomic_get(&h->min_inv);
+    } while (inv > cur && !hil_atomic_cas(&h->min_inv, (long)cur, (long)inv));
+    do {
+        cur = (uint32_t)hil_atomic_get(&h->max);
+    } while (us > cur && !hil_atomic_cas(&h->max, (long)cur, (long)us));
+}
+
+/* Smallest value bucket k holds. */
+static uint32_t bucket_lo(uint32_t k)
+{
+    return (k == 0U) ? 0U : (1U << (k - 1U));
+}
+
+static uint32_t clamp(uint32_t v, uint32_t lo, uint32_t hi)
+{
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+void hil_hist_take(struct hil_hist *h, struct hil_hist_window *out)
+{
+    /*
+     * Extremes first: record() counts before it updates them, so an extreme
+     * taken here belongs to a sample already counted, in this window or an
+     * earlier one.
+     */
+    out->min = ~(uint32_t)hil_atomic_swap(&h->min_inv, 0);
+    out->max = (uint32_t)hil_atomic_swap(&h->max, 0);
+
+    uint32_t lo = HIL_HIST_BUCKETS, hi = 0;
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        out->bucket[k] = (uint32_t)hil_atomic_swap(&h->bucket[k], 0);
+        if (out->bucket[k] != 0U) {
+            lo = (lo < k) ? lo : k;
+            hi = k;
+        }
+    }
+
+    /*
+     * A sample racing with take() can still be counted in one window and
+     * have its extremes land in the next.  Pull min/max back inside the
+     * buckets actually counted, so a window never reports extremes without
+     * samples or a max below its own highest bucket.
+     */
+    if (lo == HIL_HIST_BUCKETS) {
+        out->min = UINT32_MAX;
+        out->max = 0U;
+        return;
+    }
+    out->min = clamp(out->min, bucket_lo(lo), hil_hist_bucket_hi(lo));
+    out->max = clamp(out->max, bucket_lo(hi), hil_hist_bucket_hi(hi));
+}
+
+/* ── Queries ──────────────────────────────────────────────────────────────── */
+
+uint32_t hil_hist_bucket_hi(uint32_t k)
+{
+    if (k == 0U) {
+        return 0U;
+    }
+    if (k >= HIL_HIST_BUCKETS - 1U) {
+        return UINT32_MAX;
+    }
+    return (1U << k) - 1U;
+}
+
+uint32_t hil_hist_count(const struct hil_hist_window *w)
+{
+    uint32_t n = 0;
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        n += w->bucket[k];
+    }
+    return n;
+}
+
+uint32_t hil_hist_pct(const struct hil_hist_window *w, uint32_t pct)
+{
+    uint32_t total = hil_hist_count(w);
+    if (total == 0U) {
+        return 0U;
+    }
+
+    uint64_t want = ((uint64_t)total * pct + 99U) / 100U;
+    if (want == 0U) {
+        want = 1U;
+    }
+    uint32_t seen = 0;
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        seen += w->bucket[k];
+        if (seen >= want) {
+            uint32_t hi = hil_hist_bucket_hi(k);
+            return (hi < w->max) ? hi : w->max;
+        }
+    }
+    return w->max;
+}
+
+/* ── Dump encode / decode ─────────────────────────────────────────────────── */
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+    return p + 4;
+}
+
+static uint8_t *put_varint(uint8_t *p, uint32_t v)
+{
+    while (v >= 0x80U) {
+        *p++ = (uint8_t)(v | 0x80U);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+size_t hil_hist_dump_encode(uint16_t window_ms, const struct hil_hist_window *w,
+                            size_t n, uint8_t *buf, size_t cap)
+{
+    if (n > 255U || cap < HIL_HIST_DUMP_MAX(n)) {
+        return 0;
+    }
+
+    uint8_t *p = buf;
+    *p++ = HIL_HIST_DUMP_MAGIC;
+    *p++ = HIL_HIST_DUMP_VERSION;
+    p = put_u16(p, window_ms);
+    *p++ = (uint8_t)n;
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t nb = HIL_HIST_BUCKETS;
+        while (nb > 0U && w[i].bucket[nb - 1U] == 0U) {
+            nb--;
+        }
+        *p++ = (uint8_t)i;
+        p = put_u32(p, w[i].min);
+        p = put_u32(p, w[i].max);
+        *p++ = (uint8_t)nb;
+        for (uint32_t k = 0; k < nb; k++) {
+            p = put_varint(p, w[i].bucket[k]);
+        }
+    }
+
+    uint8_t sum = 0;
+    for (const uint8_t *q = buf; q < p; q++) {
+        sum = (uint8_t)(sum + *q);
+    }
+    *p++ = sum;
+    return (size_t)(p - buf);
+}
+
+struct reader {
+    const uint8_t *p;
+    const uint8_t *end;
+    bool ok;
+};
+
+static uint32_t get_bytes(struct reader *r, size_t size)
+{
+    if (!r->ok || (size_t)(r->end - r->p) < size) {
+        r->ok = false;
+        return 0;
+    }
+    uint32_t v = 0;
+    for (size_t i = 0; i < size; i++) {
+        v |= (uint32_t)r->p[i] << (8 * i);
+    }
+    r->p += size;
+    return v;
+}
+
+static uint32_t get_varint(struct reader *r)
+{
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint32_t b = get_bytes(r, 1);
+        if (!r->ok) {
+            return 0;
+        }
+        v |= (b & 0x7FU) << shift;
+        if ((b & 0x80U) == 0U) {
+            return v;
+        }
+    }
+    r->ok = false;
+    return 0;
+}
+
+int hil_hist_dump_decode(const uint8_t *buf, size_t len, uint16_t *window_ms,
+                         struct hil_hist_window *w, size_t max_n)
+{
+    if (len < 6U) {
+        return -1;
+    }
+    uint8_t sum = 0;
+    for (size_t i = 0; i + 1U < len; i++) {
+        sum = (uint8_t)(sum + buf[i]);
+    }
+    if (sum != buf[len - 1U]) {
+        return -1;
+    }
+
+    struct reader r = { .p = buf, .end = buf + len - 1U, .ok = true };
+    if (get_bytes(&r, 1) != HIL_HIST_DUMP_MAGIC ||
+        get_bytes(&r, 1) != HIL_HIST_DUMP_VERSION) {
+        return -1;
+    }
+    *window_ms = (uint16_t)get_bytes(&r, 2);
+    uint32_t n = get_bytes(&r, 1);
+
+    for (uint32_t i = 0; i < n && r.ok; i++) {
+        struct hil_hist_window tmp;
+        memset(&tmp, 0, sizeof(tmp));
+        uint32_t id = get_bytes(&r, 1);
+        tmp.min = get_bytes(&r, 4);
+        tmp.max = get_bytes(&r, 4);
+        uint32_t nb = get_bytes(&r, 1);
+        if (nb > HIL_HIST_BUCKETS) {
+            return -1;
+        }
+        for (uint32_t k = 0; k < nb; k++) {
+            tmp.bucket[k] = get_varint(&r);
+        }
+        if (r.ok && id < max_n) {
+            w[id] = tmp;
+        }
+    }
+    return (r.ok && r.p == r.end) ? (int)n : -1;
+}
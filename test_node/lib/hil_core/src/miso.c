@@ -0,0 +1,125 @@
+/**
+ * @file miso.c
+ * @brief Node → Pi status frame codec.  See hil_core/miso.h.
+ */
+
+#include "hil_core/miso.h"
+
+#include <string.h>
+
+static uint8_t *put_le(uint8_t *p, uint32_t v, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+    return p + size;
+}
+
+static uint32_t get_le(const uint8_t *p, size_t size)
+{
+    uint32_t v = 0;
+    for (size_t i = 0; i < size; i++) {
+        v |= (uint32_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+static uint8_t *put_le64(uint8_t *p, uint64_t v)
+{
+    p = put_le(p, (uint32_t)v, 4);
+    return put_le(p, (uint32_t)(v >> 32), 4);
+}
+
+static uint64_t get_le64(const uint8_t *p)
+{
+    return get_le(p, 4) | ((uint64_t)get_le(p + 4, 4) << 32);
+}
+
+static uint8_t *put_sample(uint8_t *p, const struct hil_motor_sample *s)
+{
+    p = put_le(p, s->ts_us, 4);
+    for (uint32_t ch = 0; ch < HIL_MOTORS; ch++) {
+        p = put_le(p, s->duty[ch], 2);
+    }
+    p = put_le(p, s->period_us, 2);
+    *p++ = s->fresh;
+    *p++ = 0;
+    return p;
+}
+
+static const uint8_t *get_sample(const uint8_t *p, struct hil_motor_sample *s)
+{
+    s->ts_us = get_le(p, 4);
+    for (uint32_t ch = 0; ch < HIL_MOTORS; ch++) {
+        s->duty[ch] = (uint16_t)get_le(p + 4 + 2 * ch, 2);
+    }
+    s->period_us = (uint16_t)get_le(p + 12, 2);
+    s->fresh     = p[14];
+    s->reserved  = 0;
+    return p + HIL_MOTOR_SAMPLE_SIZE;
+}
+
+size_t hil_miso_encode(const struct hil_miso_status *st,
+                       const struct hil_motor_sample *s, size_t n,
+                       uint8_t frame[HIL_FRAME_SIZE])
+{
+    static const struct hil_motor_sample none;
+
+    if (n > HIL_MISO_MAX_SAMPLES) {
+        return 0;
+    }
+    size_t len = HIL_MISO_HDR_SIZE + n * HIL_MOTOR_SAMPLE_SIZE;
+    uint8_t *p = frame;
+
+    p = put_le(p, (uint32_t)len, HIL_FRAME_HDR_SIZE);
+    *p++ = HIL_MISO_MAGIC;
+    *p++ = HIL_MISO_VERSION;
+    *p++ = (uint8_t)n;
+    *p++ = st->has_latest ? HIL_MISO_LATEST : 0U;
+    p = put_le(p, st->seq, 4);
+    p = put_le64(p, st->rx_done_us);
+    p = put_le64(p, st->fill_us);
+    p = put_le(p, st->lost, 4);
+#define HIL_MISO_PUT(name) p = put_le(p, st->counters.name, 4);
+    HIL_MISO_COUNTERS(HIL_MISO_PUT)
+#undef HIL_MISO_PUT
+    p = put_sample(p, st->has_latest ? &st->latest : &none);
+
+    for (size_t i = 0; i < n; i++) {
+        p = put_sample(p, &s[i]);
+    }
+    memset(p, 0, (size_t)(frame + HIL_FRAME_SIZE - p));
+    return len;
+}
+
+int hil_miso_decode(const uint8_t frame[HIL_FRAME_SIZE],
+                    struct hil_miso_status *st,
+                    struct hil_motor_sample *s, size_t max)
+{
+    size_t len = get_le(frame, HIL_FRAME_HDR_SIZE);
+    const uint8_t *p = frame + HIL_FRAME_HDR_SIZE;
+
+    if (len < HIL_MISO_HDR_SIZE || len > HIL_FRAME_MAX_PAYLOAD ||
+        p[0] != HIL_MISO_MAGIC || p[1] != HIL_MISO_VERSION) {
+        return -1;
+    }
+    size_t n = p[2];
+    if (n > max || len != HIL_MISO_HDR_SIZE + n * HIL_MOTOR_SAMPLE_SIZE) {
+        return -1;
+    }
+    st->has_latest = (p[3] & HIL_MISO_LATEST) != 0U;
+    st->seq        = get_le(p + 4, 4);
+    st->rx_done_us = get_le64(p + 8);
+    st->fill_us    = get_le64(p + 16);
+    st->lost       = get_le(p + 24, 4);
+    p += 28;
+#define HIL_MISO_GET(name) st->counters.name = get_le(p, 4); p += 4;
+    HIL_MISO_COUNTERS(HIL_MISO_GET)
+#undef HIL_MISO_GET
+    p = get_sample(p, &st->latest);
+
+    for (size_t i = 0; i < n; i++) {
+        p = get_sample(p, &s[i]);
+    }
+    return (int)n;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file motor.c
+ * @brief Motor capture samples and their ring.  See hil_core/motor.h.
+ *
+ * Sequence numbers are stored in hil_atomic_t but compared through
+ * uint32_t, as in ring.c, so they wrap the same way on target and host.
+ *
+ * Slots are copied with plain loads and stores, so each copy sits between
+ * two hil_atomic_fence() calls.  Without them the compiler or CPU may move
+ * slot accesses past the sequence number that is meant to guard them.
+ */
+
+#include "hil_core/motor.h"
+
+#include <string.h>
+
+#define MASK (HIL_MOTOR_RING_LEN - 1U)
+
+void hil_motor_init(struct hil_motor *m)
+{
+    memset(&m->pending, 0, sizeof(m->pending));
+    for (uint32_t i = 0; i < HIL_MOTOR_RING_LEN; i++) {
+        hil_atomic_set(&m->seq[i], 0);
+    }
+    hil_atomic_set(&m->head, 0);
+}
+
+uint16_t hil_motor_duty_q16(uint32_t pulse_cycles, uint32_t period_cycles)
+{
+    if (period_cycles == 0U) {
+        return 0;
+    }
+    uint64_t q = ((uint64_t)pulse_cycles << 16) / period_cycles;
+    return (q > 0xFFFFU) ? 0xFFFFU : (uint16_t)q;
+}
+
+/* ── Producer ─────────────────────────────────────────────────────────────── */
+
+static void emit(struct hil_motor *m)
+{
+    uint32_t pos = (uint32_t)hil_atomic_get(&m->head);
+
+    hil_atomic_set(&m->seq[pos & MASK], (long)(2U * pos + 1U));
+    hil_atomic_fence();
+    m->slot[pos & MASK] = m->pending;
+    hil_atomic_fence();
+    hil_atomic_set(&m->seq[pos & MASK], (long)(2U * pos + 2U));
+    hil_atomic_set(&m->head, (long)(pos + 1U));
+
+    /* Duties carry over: a channel that misses the next sample keeps its
+     * last value, marked stale by its fresh bit. */
+    m->pending.fresh = 0;
+}
+
+void hil_motor_on_capture(struct hil_motor *m, uint8_t ch, uint16_t duty_q16,
+                          uint16_t period_us, uint32_t now_us)
+{
+    if (ch >= HIL_MOTORS) {
+        return;
+    }
+    uint8_t bit = (uint8_t)(1U << ch);
+
+    /* A second period from ch before the others completed: ship without them. */
+    if (m->pending.fresh & bit) {
+        emit(m);
+    }
+    m->pending.duty[ch]  = duty_q16;
+    m->pending.period_us = period_us;
+    m->pending.ts_us     = now_us;
+    m->pending.fresh    |= bit;
+
+    if (m->pending.fresh == HIL_MOTOR_ALL) {
+        emit(m);
+    }
+}
+
+/* ── Consumer ─────────────────────────────────────────────────────────────── */
+
+size_t hil_motor_read(struct hil_motor *m, uint32_t *cursor,
+                      struct hil_motor_sample *out, size_t max, uint32_t *lost)
+{
+    uint32_t head = (uint32_t)hil_atomic_get(&m->head);
+    uint32_t c = *cursor;
+    size_t n = 0;
+
+    if (head - c > HIL_MOTOR_RING_LEN) {
+        *lost += head - HIL_MOTOR_RING_LEN - c;
+        c = head - HIL_MOTOR_RING_LEN;
+    }
+
+    for (; c != head && n < max; c++) {
+        uint32_t want = 2U * c + 2U;
+
+        if ((uint32_t)hil_atomic_get(&m->seq[c & MASK]) != want) {
+            (*lost)++;       /* already overwritten (or being overwritten) */
+            continue;
+        }
+        hil_atomic_fence();
+        out[n] = m->slot[c & MASK];
+        hil_atomic_fence();
+        if ((uint32_t)hil_atomic_get(&m->seq[c & MASK]) != want) {
+            (*lost)++;       /* overwritten while we copied it */
+            continue;
+        }
+        n++;
+    }
+    *cursor = c;
+    return n;
+}
+
+bool hil_motor_latest(struct hil_motor *m, struct hil_motor_sample *out)
+{
+    uint32_t head = (uint32_t)hil_atomic_get(&m->head);
+    uint32_t want = 2U * (head - 1U) + 2U;
+
+    if (head == 0U ||
+        (uint32_t)hil_atomic_get(&m->seq[(head - 1U) & MASK]) != want) {
+        return false;
+    }
+    hil_atomic_fence();
+    *out = m->slot[(head - 1U) & MASK];
+    hil_atomic_fence();
+    return (uint32_t)hil_atomic_get(&m->seq[(head - 1U) & MASK]) == want;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file pool.c
+ * @brief Refcounted packet pool (see pool.h).
+ */
+
+#include "hil_core/pool.h"
+
+void hil_pool_init(struct hil_pool *p)
+{
+    for (uint32_t i = 0; i < HIL_POOL_LEN; i++) {
+        hil_atomic_set(&p->ref[i], 0);
+    }
+    p->cursor = 0;
+}
+
+uint16_t hil_pool_alloc(struct hil_pool *p)
+{
+    /*
+     * Slots are released roughly in allocation order, so starting after the
+     * last one handed out usually finds a free slot on the first try.
+     */
+    for (uint32_t n = 0; n < HIL_POOL_LEN; n++) {
+        uint16_t idx = p->cursor;
+        p->cursor = (uint16_t)((idx + 1U) % HIL_POOL_LEN);
+        if (hil_atomic_cas(&p->ref[idx], 0, 1)) {
+            return idx;
+        }
+    }
+    return HIL_POOL_NONE;
+}
+
+uint32_t hil_pool_in_use(struct hil_pool *p)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < HIL_POOL_LEN; i++) {
+        n += (hil_atomic_get(&p->ref[i]) != 0);
+    }
+    return n;
+}
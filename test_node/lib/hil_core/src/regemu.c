@@ -0,0 +1,218 @@
+/**
+ * @file regemu.c
+ * @brief Table-driven register-map target emulator (see regemu.h).
+ */
+
+#include "hil_core/regemu.h"
+
+#include <string.h>
+
+#define REG_MASK  (HIL_REGEMU_REGS - 1U)
+
+/* Served for SNAP rows with nothing pinned or their gate off. */
+static const device_update_packet_t regemu_zero;
+
+/* ── Init / publish ───────────────────────────────────────────────────────── */
+
+void hil_regemu_init(struct hil_regemu *e, const struct hil_regemu_desc *desc,
+                     uint8_t *const images[], uint16_t snap_base,
+                     struct hil_pool *pool, void *ctx)
+{
+    e->desc = desc;
+    e->pool = pool;
+    e->ctx  = ctx;
+    for (uint32_t p = 0; p < HIL_REGEMU_PAGES; p++) {
+        e->image[p] = (p < desc->n_pages) ? images[p] : NULL;
+    }
+    e->snap_base = snap_base;
+    hil_atomic_set(&e->active, HIL_POOL_NONE);
+    for (uint32_t g = 0; g < HIL_REGEMU_GROUPS; g++) {
+        e->snap[g] = HIL_POOL_NONE;
+    }
+    e->live       = UINT32_MAX;
+    e->page       = 0;
+    e->reg        = 0;
+    e->expect_reg = true;
+    e->rd = e->rd_end = NULL;
+
+    uint8_t used = 0, latched = 0;
+    memset(e->row_of, HIL_REGEMU_NO_ROW, sizeof(e->row_of));
+    for (uint8_t p = 0; p < desc->n_pages && p < HIL_REGEMU_PAGES; p++) {
+        const struct hil_reg_page *pg = &desc->pages[p];
+        for (uint8_t r = 0; r < pg->n_rows; r++) {
+            const struct hil_reg_def *row = &pg->rows[r];
+            for (uint32_t k = 0; k < row->len && row->first + k < HIL_REGEMU_REGS; k++) {
+                e->row_of[p][row->first + k] = r;
+            }
+            if (row->src == HIL_REG_SNAP) {
+                used |= (uint8_t)(1U << row->group);
+                if (row->flags & HIL_REG_LATCH) {
+                    latched |= (uint8_t)(1U << row->group);
+                }
+            }
+        }
+    }
+    e->start_groups = used & (uint8_t)~latched;
+}
+
+void hil_regemu_publish(struct hil_regemu *e, uint16_t pkt)
+{
+    hil_pool_get(e->pool, pkt);
+    uint16_t old = (uint16_t)hil_atomic_swap(&e->active, (long)pkt);
+    /* A transaction still serving old holds its own reference. */
+    hil_pool_put(e->pool, old);
+}
+
+const device_update_packet_t *hil_regemu_snap(const struct hil_regemu *e, uint8_t group)
+{
+    uint16_t idx = e->snap[group];
+    return (idx == HIL_POOL_NONE) ? &regemu_zero : hil_pool_pkt(e->pool, idx);
+}
+
+/* ── Snapshot pins ────────────────────────────────────────────────────────── */
+
+/* Load-then-get: safe because only thread context allocates (pool.h). */
+static void regemu_pin(struct hil_regemu *e, uint8_t group)
+{
+    hil_pool_put(e->pool, e->snap[group]);
+    uint16_t idx = (uint16_t)hil_atomic_get(&e->active);
+    if (idx != HIL_POOL_NONE) {
+        hil_pool_get(e->pool, idx);
+    }
+    e->snap[group] = idx;
+    if (e->desc->on_pin != NULL) {
+        e->desc->on_pin(e, group);
+    }
+}
+
+static void regemu_release(struct hil_regemu *e, uint8_t group)
+{
+    hil_pool_put(e->pool, e->snap[group]);
+    e->snap[group] = HIL_POOL_NONE;
+}
+
+/* ── Register decode (slow path, once per run) ───────────────────────────── */
+
+static bool snap_live(const struct hil_regemu *e, const struct hil_reg_def *row)
+{
+    return (e->live & (1UL << row->gate)) != 0 && e->snap[row->group] != HIL_POOL_NONE;
+}
+
+/* True if next continues row's bytes in memory for a burst. */
+static bool row_continues(const struct hil_regemu *e, const struct hil_reg_def *row,
+                          const struct hil_reg_def *next)
+{
+    if (next->first != row->first + row->len || next->src != row->src) {
+        return false;
+    }
+    switch (row->src) {
+    case HIL_REG_IMAGE:
+        return true;   /* image[reg] is adjacent whenever reg is */
+    case HIL_REG_SNAP:
+        return !(next->flags & HIL_REG_LATCH)
+            && next->group  == row->group
+            && next->offset == row->offset + row->len
+            && snap_live(e, next) == snap_live(e, row);
+    default:
+        return false;
+    }
+}
+
+void hil_regemu_seek(struct hil_regemu *e)
+{
+    const struct hil_reg_page *pg = &e->desc->pages[e->page];
+    uint8_t reg = e->reg;
+    uint8_t r   = e->row_of[e->page][reg];
+
+    if (r == HIL_REGEMU_NO_ROW) {
+        e->fill   = e->desc->unmapped;
+        e->rd     = &e->fill;
+        e->rd_end = e->rd + 1;
+        return;
+    }
+
+    const struct hil_reg_def *row = &pg->rows[r];
+    if (row->src == HIL_REG_FN) {
+        e->fill   = row->read(e, reg);
+        e->rd     = &e->fill;
+        e->rd_end = e->rd + 1;
+        return;
+    }
+
+    const uint8_t *base;
+    if (row->src == HIL_REG_SNAP) {
+        if ((row->flags & HIL_REG_LATCH) && reg == row->first) {
+            regemu_pin(e, row->group);
+        }
+        base = snap_live(e, row) ? hil_regemu_snap_rec(e, row->group)
+                                 : (const uint8_t *)&regemu_zero + e->snap_base;
+        e->rd = base + row->offset + (reg - row->first);
+    } else {
+        base  = e->image[e->page];
+        e->rd = base + reg;
+    }
+
+    const struct hil_reg_def *last = row;
+    while (r + 1U < pg->n_rows && row_continues(e, last, &pg->rows[r + 1U])) {
+        last = &pg->rows[++r];
+    }
+    e->rd_end = (row->src == HIL_REG_SNAP) ? base + last->offset + last->len
+                                           : base + last->first + last->len;
+}
+
+/* ── Bus events ───────────────────────────────────────────────────────────── */
+
+void hil_regemu_write_byte(struct hil_regemu *e, uint8_t val)
+{
+    if (e->expect_reg) {
+        e->reg        = val & REG_MASK;
+        e->expect_reg = false;
+        return;
+    }
+
+    uint8_t reg = e->reg;
+    uint8_t r   = e->row_of[e->page][reg];
+    if (r != HIL_REGEMU_NO_ROW) {
+        const struct hil_reg_def *row = &e->desc->pages[e->page].rows[r];
+        if (row->write != NULL) {
+            row->write(e, reg, val);
+        } else if (row->src == HIL_REG_IMAGE && !(row->flags & HIL_REG_RO)) {
+            hil_regemu_store(e, reg, val);
+        }
+    }
+    e->reg = (uint8_t)((reg + 1U) & REG_MASK);
+}
+
+uint8_t hil_regemu_read_start(struct hil_regemu *e)
+{
+    uint8_t reg = e->reg;
+
+    /* Repeated START without STOP: pin() drops the previous pin first. */
+    for (uint8_t g = 0; g < HIL_REGEMU_GROUPS; g++) {
+        if (e->start_groups & (1U << g)) {
+            regemu_pin(e, g);
+        }
+    }
+    e->rd = e->rd_end = NULL;
+    uint8_t val = hil_regemu_read_next(e);
+
+    if (e->desc->on_read != NULL) {
+        e->desc->on_read(e, reg);
+    }
+    return val;
+}
+
+void hil_regemu_stop(struct hil_regemu *e)
+{
+    /*
+     * The register pointer survives STOP, as on real parts, so a plain
+     * write-address / STOP / read sequence reads from that address.
+     */
+    e->expect_reg = true;
+    e->rd = e->rd_end = NULL;
+    for (uint8_t g = 0; g < HIL_REGEMU_GROUPS; g++) {
+        if (e->start_groups & (1U << g)) {
+            regemu_release(e, g);
+        }
+    }
+}
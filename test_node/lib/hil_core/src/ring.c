@@ -0,0 +1,129 @@
+/**
+ * @file ring.c
+ * @brief Lock-free SPSC staging ring (see ring.h).
+ *
+ * Indices are free-running uint32 values stored in hil_atomic_t.  They are
+ * always converted through uint32_t in both directions so CAS compares the
+ * same bit pattern whether the atomic is 32 bits (Cortex-M) or 64 (host).
+ */
+
+#include "hil_core/ring.h"
+
+#define RING_MASK  (HIL_RING_LEN - 1U)
+
+static inline uint32_t load_idx(hil_atomic_t *a)
+{
+    return (uint32_t)hil_atomic_get(a);
+}
+
+static inline bool cas_idx(hil_atomic_t *a, uint32_t expected, uint32_t desired)
+{
+    return hil_atomic_cas(a, (long)expected, (long)desired);
+}
+
+void hil_ring_init(struct hil_ring *r)
+{
+    hil_atomic_set(&r->head, 0);
+    hil_atomic_set(&r->tail, 0);
+}
+
+uint32_t hil_ring_count(struct hil_ring *r)
+{
+    uint32_t tail = load_idx(&r->tail);
+    uint32_t head = load_idx(&r->head);
+    return head - tail;
+}
+
+/* ── Producer ─────────────────────────────────────────────────────────────── */
+
+bool hil_ring_push(struct hil_ring *r, struct hil_ring_entry e,
+                   struct hil_ring_entry *evicted)
+{
+    uint32_t head = load_idx(&r->head);
+    uint32_t tail = load_idx(&r->tail);
+    bool dropped = false;
+
+    if (head - tail >= HIL_RING_CAPACITY) {
+        /*
+         * Full — drop the oldest.  Read it before the CAS; a successful CAS
+         * proves the consumer did not take it meanwhile.  If the CAS fails
+         * the consumer popped it, which freed the space just the same.
+         */
+        struct hil_ring_entry old = r->slot[tail & RING_MASK];
+        if (cas_idx(&r->tail, tail, tail + 1U)) {
+            *evicted = old;
+            dropped = true;
+        }
+    }
+
+    /*
+     * Only the producer moves head, and the count never exceeds
+     * HIL_RING_CAPACITY, so slot[head] is outside [tail, head) and the
+     * consumer never reads it.
+     */
+    r->slot[head & RING_MASK] = e;
+
+    /* Sequentially consistent store: the slot write above is visible first. */
+    hil_atomic_set(&r->head, (long)(uint32_t)(head + 1U));
+    return dropped;
+}
+
+/* ── Consumer ─────────────────────────────────────────────────────────────── */
+
+bool hil_ring_peek_ts(struct hil_ring *r, uint32_t *ts)
+{
+    for (;;) {
+        uint32_t tail = load_idx(&r->tail);
+        if (tail == load_idx(&r->head)) {
+            return false;
+        }
+        *ts = r->slot[tail & RING_MASK].timestamp_us;
+        /* Re-check: if the producer evicted this slot meanwhile, retry. */
+        if (load_idx(&r->tail) == tail) {
+            return true;
+        }
+    }
+}
+
+bool hil_ring_pop(struct hil_ring *r, struct hil_ring_entry *out)
+{
+    for (;;) {
+        uint32_t tail = load_idx(&r->tail);
+        if (tail == load_idx(&r->head)) {
+            return false;
+        }
+        struct hil_ring_entry e = r->slot[tail & RING_MASK];
+        /*
+         * Claim it.  Failure means the producer evicted this entry while we
+         * were reading it (possible only when producer and consumer run
+         * concurrently, e.g. SMP or the host); try again with the new oldest.
+         */
+        if (cas_idx(&r->tail, tail, tail + 1U)) {
+            *out = e;
+            return true;
+        }
+    }
+}
+
+bool hil_ring_pop_due(struct hil_ring *r, uint32_t now, struct hil_ring_entry *out)
+{
+    for (;;) {
+        uint32_t tail = load_idx(&r->tail);
+        if (tail == load_idx(&r->head)) {
+            return false;
+        }
+        struct hil_ring_entry e = r->slot[tail & RING_MASK];
+        if (!hil_ts_due(e.timestamp_us, now)) {
+            /* Not due — unless that read raced an eviction, then retry. */
+            if (load_idx(&r->tail) == tail) {
+                return false;
+            }
+            continue;
+        }
+        /* As in hil_ring_pop: a failed CAS means the read may be torn. */
+        if (cas_idx(&r->tail, tail, tail + 1U)) {
+            *out = e;
+            return true;
+        }
+    }
+}
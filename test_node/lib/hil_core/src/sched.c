@@ -0,0 +1,188 @@
+/**
+ * @file sched.c
+ * @brief Scheduler core implementation (see sched.h).
+ */
+
+#include "hil_core/sched.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* ── Init ─────────────────────────────────────────────────────────────────── */
+
+void hil_sched_init(struct hil_sched *s, const struct hil_sched_port *port,
+                    struct hil_pool *pool)
+{
+    memset(&s->stats, 0, sizeof(s->stats));
+    s->port = port;
+    s->pool = pool;
+    hil_pool_init(pool);
+    hil_ring_init(&s->ring);
+    hil_atomic_set(&s->timer_armed, 0);
+}
+
+uint32_t hil_sched_ring_count(struct hil_sched *s)
+{
+    return hil_ring_count(&s->ring);
+}
+
+uint32_t hil_sched_late_pct(const struct hil_sched_lateness *h, uint32_t pct)
+{
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < HIL_LATE_BUCKETS; k++) {
+        total += h->bucket[k];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    /* Smallest k with at least pct% of samples at or below it. */
+    uint64_t want = ((uint64_t)total * pct + 99U) / 100U;
+    uint32_t seen = 0;
+    for (uint32_t k = 0; k < HIL_LATE_BUCKETS; k++) {
+        seen += h->bucket[k];
+        if (seen >= want && seen > 0) {
+            return k;
+        }
+    }
+    return HIL_LATE_BUCKETS - 1U;
+}
+
+/* ── Alarm arm helper (producer and consumer context) ─────────────────────── */
+/**
+ * Arms the injection alarm at the oldest pending packet's timestamp.
+ * Uses CAS so only one caller (thread or alarm ISR) arms it; if it is
+ * already armed this is a no-op.
+ */
+static void try_arm_timer(struct hil_sched *s)
+{
+    if (!hil_atomic_cas(&s->timer_armed, 0, 1)) {
+        return;   /* Already armed by the alarm or a prior call. */
+    }
+
+    uint32_t ts;
+    if (!hil_ring_peek_ts(&s->ring, &ts)) {
+        /* Ring is empty — undo the flag we just set. */
+        hil_atomic_set(&s->timer_armed, 0);
+        return;
+    }
+
+    if (!s->port->alarm_at(s->port->ctx, ts)) {
+        /* Leave it idle; the next frame retries. */
+        s->stats.arm_fail++;
+        hil_atomic_set(&s->timer_armed, 0);
+    }
+}
+
+static void record_lateness(struct hil_sched_lateness *h, uint32_t late_us)
+{
+    uint32_t k = late_us < HIL_LATE_BUCKETS ? late_us : HIL_LATE_BUCKETS - 1U;
+    h->bucket[k]++;
+    if (late_us > h->max_us) {
+        h->max_us = late_us;
+    }
+}
+
+/* ── Frame intake ─────────────────────────────────────────────────────────── */
+
+enum hil_frame_status hil_sched_on_frame(struct hil_sched *s,
+                                         const uint8_t *buf,
+                                         uint16_t *pkt_ref,
+                                         bool *evicted)
+{
+    s->stats.frames++;
+    if (pkt_ref != NULL) {
+        *pkt_ref = HIL_POOL_NONE;
+    }
+    if (evicted != NULL) {
+        *evicted = false;
+    }
+
+    /* Reject legacy clock-sync frames; the Pi servos from MISO instead. */
+    if (hil_frame_is_sync(buf)) {
+        s->stats.sync++;
+        return HIL_FRAME_SYNC;
+    }
+
+    uint16_t payload_len = hil_frame_parse_len(buf);
+    if (payload_len == 0) {
+        s->stats.bad_len++;
+        return HIL_FRAME_BAD_LEN;
+    }
+
+    /* Decode once, into the slot every later stage will read from. */
+    uint16_t idx = hil_pool_alloc(s->pool);
+    if (idx == HIL_POOL_NONE) {
+        s->stats.no_slot++;
+        return HIL_FRAME_NO_SLOT;
+    }
+    device_update_packet_t *pkt = hil_pool_pkt(s->pool, idx);
+    if (!hil_frame_decode(buf + HIL_FRAME_HDR_SIZE, payload_len, pkt)) {
+        hil_pool_put(s->pool, idx);
+        s->stats.decode_fail++;
+        return HIL_FRAME_DECODE_FAIL;
+    }
+    pkt->enqueue_us = s->port->now_us(s->port->ctx);
+    if (pkt_ref != NULL) {
+        /* Taken before the push — the consumer may release the ring's. */
+        hil_pool_get(s->pool, idx);
+        *pkt_ref = idx;
+    }
+
+    struct hil_ring_entry e = { .timestamp_us = pkt->timestamp_us, .pkt = idx };
+    struct hil_ring_entry old;
+    bool dropped = hil_ring_push(&s->ring, e, &old);
+
+    s->stats.queued++;
+    if (dropped) {
+        hil_pool_put(s->pool, old.pkt);
+        s->stats.evicted++;
+    }
+    if (evicted != NULL) {
+        *evicted = dropped;
+    }
+
+    try_arm_timer(s);
+    return HIL_FRAME_OK;
+}
+
+/* ── Alarm expiry (consumer context) ──────────────────────────────────────── */
+
+void hil_sched_on_timer(struct hil_sched *s)
+{
+    /* Clear the armed flag; try_arm_timer() below re-sets it if needed. */
+    hil_atomic_set(&s->timer_armed, 0);
+
+    uint32_t now = s->port->now_us(s->port->ctx);
+
+    /*
+     * Drain everything already due.  Only the newest is delivered; each
+     * older one is released as soon as a newer one turns up.
+     */
+    struct hil_ring_entry e;
+    uint16_t newest = HIL_POOL_NONE;
+    uint32_t drained = 0;
+    uint32_t first_ts = 0;
+    while (hil_ring_pop_due(&s->ring, now, &e)) {
+        if (drained == 0) {
+            first_ts = e.timestamp_us;
+        }
+        hil_pool_put(s->pool, newest);
+        newest = e.pkt;
+        drained++;
+    }
+
+    if (drained == 0) {
+        /* Alarm for a packet that was evicted, or it fired early. */
+        s->stats.empty_fire++;
+    } else {
+        s->port->deliver(s->port->ctx, newest);
+        s->stats.injected++;
+        s->stats.coalesced += drained - 1U;
+        record_lateness(&s->stats.late, now - first_ts);
+    }
+
+    /* Re-arm for the next pending packet.  If the ring is empty the alarm
+     * stays idle until the producer publishes and calls try_arm_timer(). */
+    try_arm_timer(s);
+}
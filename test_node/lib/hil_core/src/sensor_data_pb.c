@@ -0,0 +1,401 @@
+/**
+ * @file sensor_data_pb.c
+ * @brief SensorPacket decoders (see sensor_data_pb.h).
+ *
+ * Generated by tools/gen_proto_fields.py from
+ * shared/proto/sensor_data.proto.  DO NOT EDIT; rerun the script after
+ * changing the schema (CI fails while this file is out of date).
+ */
+
+#include "hil_core/sensor_data_pb.h"
+
+#include "hil_core/sensor_data_fields.h"
+
+#include <string.h>
+
+/* ── Wire primitives ──────────────────────────────────────────────────────── */
+
+enum {
+    WT_VARINT = 0,
+    WT_I64    = 1,
+    WT_LEN    = 2,
+    WT_I32    = 5,
+};
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+} pb_cursor_t;
+
+static bool read_varint(pb_cursor_t *c, uint64_t *out)
+{
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (c->p >= c->end) {
+            return false;
+        }
+        uint8_t b = *c->p++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *out = v;
+            return true;
+        }
+    }
+    return false;   /* > 10 bytes */
+}
+
+static bool skip_field(pb_cursor_t *c, uint32_t wire_type)
+{
+    uint64_t n;
+    switch (wire_type) {
+    case WT_VARINT:
+        return read_varint(c, &n);
+    case WT_I64:
+        n = 8;
+        break;
+    case WT_I32:
+        n = 4;
+        break;
+    case WT_LEN:
+        if (!read_varint(c, &n)) {
+            return false;
+        }
+        break;
+    default:
+        return false;   /* groups are not valid proto3 */
+    }
+    if ((uint64_t)(c->end - c->p) < n) {
+        return false;
+    }
+    c->p += n;
+    return true;
+}
+
+/** Reads a LEN field header and narrows c to a sub-cursor over its body. */
+static bool enter_submessage(pb_cursor_t *c, pb_cursor_t *sub)
+{
+    uint64_t n;
+    if (!read_varint(c, &n) || (uint64_t)(c->end - c->p) < n) {
+        return false;
+    }
+    sub->p   = c->p;
+    sub->end = c->p + n;
+    c->p    += n;
+    return true;
+}
+
+static inline int32_t zigzag32(uint64_t v)
+{
+    uint32_t u = (uint32_t)v;
+    return (int32_t)((u >> 1) ^ (0U - (u & 1U)));
+}
+
+/* ── Messages ─────────────────────────────────────────────────────────────── */
+
+bool hil_pb_decode_imu_payload(const uint8_t *buf, size_t len, hil_pb_imu_payload_t *out)
+{
+    pb_cursor_t c = { .p = buf, .end = buf + len };
+
+    while (c.p < c.end) {
+        uint64_t key, v;
+        if (!read_varint(&c, &key)) {
+            return false;
+        }
+        uint32_t wt = (uint32_t)(key & 7);
+
+        switch (key >> 3) {
+        case HIL_PB_IMU_PAYLOAD_GYRO_X:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->gyro_x = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_GYRO_Y:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->gyro_y = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_GYRO_Z:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->gyro_z = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_EULER_X:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->euler_x = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_EULER_Y:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->euler_y = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_EULER_Z:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->euler_z = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_LIN_ACC_X:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->lin_acc_x = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_LIN_ACC_Y:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->lin_acc_y = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_PAYLOAD_LIN_ACC_Z:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->lin_acc_z = zigzag32(v);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        if (!skip_field(&c, wt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hil_pb_decode_rc_payload(const uint8_t *buf, size_t len, hil_pb_rc_payload_t *out)
+{
+    pb_cursor_t c = { .p = buf, .end = buf + len };
+
+    while (c.p < c.end) {
+        uint64_t key, v;
+        if (!read_varint(&c, &key)) {
+            return false;
+        }
+        uint32_t wt = (uint32_t)(key & 7);
+
+        switch (key >> 3) {
+        case HIL_PB_RC_PAYLOAD_VERTICAL:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->vertical = zigzag32(v);
+                continue;
+            }
+            break;
+        case HIL_PB_RC_PAYLOAD_HORIZONTAL:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->horizontal = zigzag32(v);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        if (!skip_field(&c, wt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hil_pb_decode_imu_record(const uint8_t *buf, size_t len, hil_pb_imu_record_t *out)
+{
+    pb_cursor_t c = { .p = buf, .end = buf + len };
+    pb_cursor_t sub;
+
+    while (c.p < c.end) {
+        uint64_t key, v;
+        if (!read_varint(&c, &key)) {
+            return false;
+        }
+        uint32_t wt = (uint32_t)(key & 7);
+
+        switch (key >> 3) {
+        case HIL_PB_IMU_RECORD_INSTANCE:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->instance = (uint32_t)v;
+                continue;
+            }
+            break;
+        case HIL_PB_IMU_RECORD_IMU:
+            if (wt == WT_LEN) {
+                if (!enter_submessage(&c, &sub) ||
+                    !hil_pb_decode_imu_payload(sub.p, (size_t)(sub.end - sub.p), &out->imu)) {
+                    return false;
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        if (!skip_field(&c, wt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hil_pb_decode_range_record(const uint8_t *buf, size_t len, hil_pb_range_record_t *out)
+{
+    pb_cursor_t c = { .p = buf, .end = buf + len };
+
+    while (c.p < c.end) {
+        uint64_t key, v;
+        if (!read_varint(&c, &key)) {
+            return false;
+        }
+        uint32_t wt = (uint32_t)(key & 7);
+
+        switch (key >> 3) {
+        case HIL_PB_RANGE_RECORD_INSTANCE:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->instance = (uint32_t)v;
+                continue;
+            }
+            break;
+        case HIL_PB_RANGE_RECORD_DISTANCE_MM:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->distance_mm = (uint32_t)v;
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        if (!skip_field(&c, wt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hil_pb_decode_sensor_packet(const uint8_t *buf, size_t len, hil_pb_sensor_packet_t *out,
+        const hil_pb_sensor_packet_cb_t *cb)
+{
+    pb_cursor_t c = { .p = buf, .end = buf + len };
+    pb_cursor_t sub;
+
+    while (c.p < c.end) {
+        uint64_t key, v;
+        if (!read_varint(&c, &key)) {
+            return false;
+        }
+        uint32_t wt = (uint32_t)(key & 7);
+
+        switch (key >> 3) {
+        case HIL_PB_SENSOR_PACKET_TIMESTAMP_US:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->timestamp_us = (uint32_t)v;
+                continue;
+            }
+            break;
+        case HIL_PB_SENSOR_PACKET_LIDAR_MM:
+            if (wt == WT_VARINT) {
+                if (!read_varint(&c, &v)) {
+                    return false;
+                }
+                out->lidar_mm = (uint32_t)v;
+                continue;
+            }
+            break;
+        case HIL_PB_SENSOR_PACKET_IMU:
+            if (wt == WT_LEN) {
+                if (!enter_submessage(&c, &sub) ||
+                    !hil_pb_decode_imu_payload(sub.p, (size_t)(sub.end - sub.p), &out->imu)) {
+                    return false;
+                }
+                continue;
+            }
+            break;
+        case HIL_PB_SENSOR_PACKET_RC:
+            if (wt == WT_LEN) {
+                if (!enter_submessage(&c, &sub) ||
+                    !hil_pb_decode_rc_payload(sub.p, (size_t)(sub.end - sub.p), &out->rc)) {
+                    return false;
+                }
+                continue;
+            }
+            break;
+        case HIL_PB_SENSOR_PACKET_IMUS:
+            if (wt == WT_LEN) {
+                hil_pb_imu_record_t msg;
+                memset(&msg, 0, sizeof(msg));
+                if (!enter_submessage(&c, &sub) ||
+                    !hil_pb_decode_imu_record(sub.p, (size_t)(sub.end - sub.p), &msg) ||
+                    (cb != NULL && cb->imus != NULL && !cb->imus(cb->ctx, &msg))) {
+                    return false;
+                }
+                continue;
+            }
+            break;
+        case HIL_PB_SENSOR_PACKET_RANGES:
+            if (wt == WT_LEN) {
+                hil_pb_range_record_t msg;
+                memset(&msg, 0, sizeof(msg));
+                if (!enter_submessage(&c, &sub) ||
+                    !hil_pb_decode_range_record(sub.p, (size_t)(sub.end - sub.p), &msg) ||
+                    (cb != NULL && cb->ranges != NULL && !cb->ranges(cb->ctx, &msg))) {
+                    return false;
+                }
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        if (!skip_field(&c, wt)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file trace.c
+ * @brief Binary trace ring and dump codec.  See hil_core/trace.h.
+ */
+
+#include "hil_core/trace.h"
+
+#define MASK (HIL_TRACE_LEN - 1U)
+
+#define HIL_TRACE_NAME(id, name, fmt) [id] = name,
+static const char *const names[HIL_TEV_COUNT] = { HIL_TRACE_EVENTS(HIL_TRACE_NAME) };
+#undef HIL_TRACE_NAME
+
+#define HIL_TRACE_FMT(id, name, fmt) [id] = fmt,
+static const char *const formats[HIL_TEV_COUNT] = { HIL_TRACE_EVENTS(HIL_TRACE_FMT) };
+#undef HIL_TRACE_FMT
+
+void hil_trace_init(struct hil_trace *t)
+{
+    for (uint32_t i = 0; i < HIL_TRACE_LEN; i++) {
+        hil_atomic_set(&t->seq[i], (long)i);
+    }
+    hil_atomic_set(&t->head, 0);
+    hil_atomic_set(&t->tail, 0);
+    hil_atomic_set(&t->dropped, 0);
+}
+
+void hil_trace_put(struct hil_trace *t, const struct hil_trace_rec *rec)
+{
+    for (;;) {
+        uint32_t pos = (uint32_t)hil_atomic_get(&t->head);
+        int32_t dif = (int32_t)((uint32_t)hil_atomic_get(&t->seq[pos & MASK]) - pos);
+
+        if (dif < 0) {
+            /* Slot still holds a record from one lap ago: full. */
+            hil_atomic_inc(&t->dropped);
+            return;
+        }
+        if (dif == 0 && hil_atomic_cas(&t->head, (long)pos, (long)(pos + 1U))) {
+            t->slot[pos & MASK] = *rec;
+            hil_atomic_set(&t->seq[pos & MASK], (long)(pos + 1U));
+            return;
+        }
+        /* Another producer claimed pos first; try the next one. */
+    }
+}
+
+bool hil_trace_get(struct hil_trace *t, struct hil_trace_rec *out)
+{
+    uint32_t pos = (uint32_t)hil_atomic_get(&t->tail);
+
+    if ((uint32_t)hil_atomic_get(&t->seq[pos & MASK]) != pos + 1U) {
+        return false;
+    }
+    *out = t->slot[pos & MASK];
+    hil_atomic_set(&t->seq[pos & MASK], (long)(pos + HIL_TRACE_LEN));
+    hil_atomic_set(&t->tail, (long)(pos + 1U));
+    return true;
+}
+
+uint32_t hil_trace_dropped(struct hil_trace *t)
+{
+    return (uint32_t)hil_atomic_get(&t->dropped);
+}
+
+const char *hil_trace_name(uint32_t id)
+{
+    return (id < HIL_TEV_COUNT) ? names[id] : "?";
+}
+
+const char *hil_trace_format(uint32_t id)
+{
+    return (id < HIL_TEV_COUNT) ? formats[id] : NULL;
+}
+
+/* ── Dump codec ───────────────────────────────────────────────────────────── */
+
+static uint8_t *put_le(uint8_t *p, uint32_t v, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+    return p + size;
+}
+
+static uint32_t get_le(const uint8_t *p, size_t size)
+{
+    uint32_t v = 0;
+    for (size_t i = 0; i < size; i++) {
+        v |= (uint32_t)p[i] << (8 * i);
+    }
+    return v;
+}
+
+size_t hil_trace_dump_encode(uint8_t ring_id, uint32_t dropped,
+                             const struct hil_trace_rec *rec, size_t n,
+                             uint8_t *buf, size_t cap)
+{
+    if (n > 255U || cap < HIL_TRACE_DUMP_SIZE(n)) {
+        return 0;
+    }
+
+    uint8_t *p = buf;
+    *p++ = HIL_TRACE_DUMP_MAGIC;
+    *p++ = HIL_TRACE_DUMP_VERSION;
+    *p++ = ring_id;
+    *p++ = (uint8_t)n;
+    p = put_le(p, dropped, 4);
+
+    for (size_t i = 0; i < n; i++) {
+        p = put_le(p, rec[i].ts, 4);
+        p = put_le(p, rec[i].id, 2);
+        p = put_le(p, rec[i].a0, 2);
+        p = put_le(p, rec[i].a1, 4);
+        p = put_le(p, rec[i].a2, 4);
+    }
+
+    uint8_t sum = 0;
+    for (const uint8_t *q = buf; q < p; q++) {
+        sum = (uint8_t)(sum + *q);
+    }
+    *p++ = sum;
+    return (size_t)(p - buf);
+}
+
+int hil_trace_dump_decode(const uint8_t *buf, size_t len, uint8_t *ring_id,
+                          uint32_t *dropped, struct hil_trace_rec *rec,
+                          size_t max_n)
+{
+    if (len < HIL_TRACE_DUMP_SIZE(0)) {
+        return -1;
+    }
+    uint8_t sum = 0;
+    for (size_t i = 0; i + 1U < len; i++) {
+        sum = (uint8_t)(sum + buf[i]);
+    }
+    if (sum != buf[len - 1U] ||
+        buf[0] != HIL_TRACE_DUMP_MAGIC || buf[1] != HIL_TRACE_DUMP_VERSION) {
+        return -1;
+    }
+
+    size_t n = buf[3];
+    if (n > max_n || len != HIL_TRACE_DUMP_SIZE(n)) {
+        return -1;
+    }
+    *ring_id = buf[2];
+    *dropped = get_le(&buf[4], 4);
+
+    const uint8_t *p = &buf[8];
+    for (size_t i = 0; i < n; i++, p += sizeof(struct hil_trace_rec)) {
+        rec[i].ts = get_le(p, 4);
+        rec[i].id = (uint16_t)get_le(p + 4, 2);
+        rec[i].a0 = (uint16_t)get_le(p + 6, 2);
+        rec[i].a1 = get_le(p + 8, 4);
+        rec[i].a2 = get_le(p + 12, 4);
+    }
+    return (int)n;
+}
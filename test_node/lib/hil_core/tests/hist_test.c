@@ -0,0 +1,335 @@
+/**
+ * @file hist_test.c
+ * @brief Host tests of the latency histograms and their dump (hil_core/hist.h).
+ *
+ * Covered:
+ *   - bucket edges: 0, powers of two either side, the open last bucket
+ *   - record/take: count, min/max, and take() leaving an empty histogram
+ *   - a sample split across take(): its count and its extremes in different
+ *     windows still give each window extremes inside its own buckets
+ *   - hil_hist_pct: empty window, bucket upper bounds, clamp to max,
+ *     0 and 100
+ *   - dump encode/decode round trip, multi-byte varints, the quiet-record
+ *     size, ids beyond max_n, a short buffer, and rejection of a bad
+ *     checksum, magic, bucket count, truncation and trailing bytes
+ *   - producers recording while a thread takes windows: every sample comes
+ *     out exactly once and every window is consistent
+ *
+ *   hist_test [COUNT]      samples per producer, default 2 000 000
+ */
+
+#include "hil_core/hist.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);  \
+            failures++;                                                      \
+        }                                                                    \
+    } while (0)
+
+static uint32_t count;
+
+/* min/max inside the lowest and highest non-empty buckets, or empty. */
+static bool consistent(const struct hil_hist_window *w)
+{
+    uint32_t lo = HIL_HIST_BUCKETS, hi = 0;
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        if (w->bucket[k] != 0U) {
+            lo = (lo < k) ? lo : k;
+            hi = k;
+        }
+    }
+    if (lo == HIL_HIST_BUCKETS) {
+        return w->min == UINT32_MAX && w->max == 0U;
+    }
+    return hil_hist_bucket(w->min) == lo && hil_hist_bucket(w->max) == hi;
+}
+
+/* ── Recording ────────────────────────────────────────────────────────────── */
+
+static void test_buckets(void)
+{
+    CHECK(hil_hist_bucket(0) == 0);
+    CHECK(hil_hist_bucket(1) == 1);
+    CHECK(hil_hist_bucket(2) == 2);
+    CHECK(hil_hist_bucket(3) == 2);
+    CHECK(hil_hist_bucket(4) == 3);
+    CHECK(hil_hist_bucket(1023) == 10);
+    CHECK(hil_hist_bucket(1024) == 11);
+    CHECK(hil_hist_bucket((1U << 22) - 1U) == HIL_HIST_BUCKETS - 2U);
+    CHECK(hil_hist_bucket(1U << 22) == HIL_HIST_BUCKETS - 1U);
+    CHECK(hil_hist_bucket(UINT32_MAX) == HIL_HIST_BUCKETS - 1U);
+
+    for (uint32_t k = 1; k < HIL_HIST_BUCKETS - 1U; k++) {
+        CHECK(hil_hist_bucket(hil_hist_bucket_hi(k)) == k);
+        CHECK(hil_hist_bucket(hil_hist_bucket_hi(k) + 1U) == k + 1U);
+    }
+    CHECK(hil_hist_bucket_hi(0) == 0);
+    CHECK(hil_hist_bucket_hi(HIL_HIST_BUCKETS - 1U) == UINT32_MAX);
+}
+
+static void test_record_take(void)
+{
+    static struct hil_hist h;   /* static storage starts empty */
+    struct hil_hist_window w;
+
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 0);
+    CHECK(w.min == UINT32_MAX && w.max == 0);
+
+    const uint32_t samples[] = { 7, 0, 300, 12, 70000, 12 };
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+        hil_hist_record(&h, samples[i]);
+    }
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 6);
+    CHECK(w.min == 0 && w.max == 70000);
+    CHECK(w.bucket[0] == 1);
+    CHECK(w.bucket[hil_hist_bucket(12)] == 2);
+    CHECK(w.bucket[hil_hist_bucket(70000)] == 1);
+
+    /* take() reset it: the next window starts empty. */
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 0);
+    CHECK(w.min == UINT32_MAX && w.max == 0);
+
+    hil_hist_record(&h, 5);
+    hil_hist_init(&h);
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 0);
+}
+
+/*
+ * What a record() racing with take() leaves behind, set up by hand: the
+ * count on one side, the extremes on the other.
+ */
+static void test_split_sample(void)
+{
+    struct hil_hist h;
+    struct hil_hist_window w;
+
+    /* Extremes without a count: the window reads as empty. */
+    hil_hist_init(&h);
+    hil_atomic_set(&h.min_inv, (long)~(uint32_t)5000U);
+    hil_atomic_set(&h.max, 5000);
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 0);
+    CHECK(w.min == UINT32_MAX && w.max == 0);
+
+    /* A count the extremes do not cover: they widen to its bucket. */
+    hil_hist_init(&h);
+    hil_hist_record(&h, 40);
+    hil_atomic_inc(&h.bucket[hil_hist_bucket(3000)]);
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_count(&w) == 2);
+    CHECK(w.min == 40);
+    CHECK(w.max == 2048);
+    CHECK(consistent(&w));
+    CHECK(hil_hist_pct(&w, 100) == 2048);
+
+    /* Extremes beyond any count: they shrink to the buckets counted. */
+    hil_hist_init(&h);
+    hil_hist_record(&h, 40);
+    hil_atomic_set(&h.min_inv, (long)~(uint32_t)1U);
+    hil_atomic_set(&h.max, 90000);
+    hil_hist_take(&h, &w);
+    CHECK(w.min == 32 && w.max == 63);
+    CHECK(consistent(&w));
+}
+
+/* ── Percentiles ──────────────────────────────────────────────────────────── */
+
+static void test_pct(void)
+{
+    struct hil_hist h;
+    struct hil_hist_window w;
+
+    memset(&w, 0, sizeof(w));
+    w.min = UINT32_MAX;
+    CHECK(hil_hist_pct(&w, 50) == 0);
+    CHECK(hil_hist_pct(&w, 99) == 0);
+
+    /* 90 samples of 10 µs, 9 of 200 µs, 1 of 5000 µs. */
+    hil_hist_init(&h);
+    for (int i = 0; i < 90; i++) {
+        hil_hist_record(&h, 10);
+    }
+    for (int i = 0; i < 9; i++) {
+        hil_hist_record(&h, 200);
+    }
+    hil_hist_record(&h, 5000);
+    hil_hist_take(&h, &w);
+
+    CHECK(hil_hist_pct(&w, 0) == 15);
+    CHECK(hil_hist_pct(&w, 50) == 15);
+    CHECK(hil_hist_pct(&w, 90) == 15);
+    CHECK(hil_hist_pct(&w, 91) == 255);
+    CHECK(hil_hist_pct(&w, 99) == 255);
+    CHECK(hil_hist_pct(&w, 100) == 5000);   /* bucket bound 8191, clamped */
+
+    /* A single sample is every percentile. */
+    hil_hist_record(&h, 3);
+    hil_hist_take(&h, &w);
+    CHECK(hil_hist_pct(&w, 1) == 3);
+    CHECK(hil_hist_pct(&w, 100) == 3);
+}
+
+/* ── Dump ─────────────────────────────────────────────────────────────────── */
+
+static void test_dump(void)
+{
+    struct hil_hist_window in[HIL_HIST_ID_COUNT];
+    memset(in, 0, sizeof(in));
+    for (size_t i = 0; i < HIL_HIST_ID_COUNT; i++) {
+        in[i].min = UINT32_MAX;
+    }
+    in[HIL_HIST_RX_TO_ENQUEUE].bucket[3] = 5;
+    in[HIL_HIST_RX_TO_ENQUEUE].min = 4;
+    in[HIL_HIST_RX_TO_ENQUEUE].max = 7;
+    in[HIL_HIST_INJECT_LATE].bucket[0] = 127;
+    in[HIL_HIST_INJECT_LATE].bucket[10] = 128;
+    in[HIL_HIST_INJECT_LATE].bucket[HIL_HIST_BUCKETS - 1U] = UINT32_MAX;
+    in[HIL_HIST_INJECT_LATE].min = 0;
+    in[HIL_HIST_INJECT_LATE].max = 0xDEADBEEFU;
+
+    uint8_t buf[HIL_HIST_DUMP_MAX(HIL_HIST_ID_COUNT)];
+    size_t len = hil_hist_dump_encode(1000, in, HIL_HIST_ID_COUNT, buf, sizeof(buf));
+    CHECK(len > 0);
+
+    /* Header, 4 quiet records and a checksum, plus the two busy ones. */
+    size_t busy = (10U + 4U) + (10U + 1U + 9U + 2U + 12U + 5U);
+    CHECK(len == 5U + 10U * (HIL_HIST_ID_COUNT - 2U) + busy + 1U);
+
+    struct hil_hist_window out[HIL_HIST_ID_COUNT];
+    uint16_t window_ms = 0;
+    memset(out, 0xAA, sizeof(out));
+    CHECK(hil_hist_dump_decode(buf, len, &window_ms, out, HIL_HIST_ID_COUNT) ==
+          (int)HIL_HIST_ID_COUNT);
+    CHECK(window_ms == 1000);
+    CHECK(memcmp(in, out, sizeof(in)) == 0);
+
+    /* Records past max_n are skipped; the rest are still read. */
+    struct hil_hist_window few[2];
+    memset(few, 0, sizeof(few));
+    CHECK(hil_hist_dump_decode(buf, len, &window_ms, few, 1) == (int)HIL_HIST_ID_COUNT);
+    CHECK(memcmp(&few[0], &in[0], sizeof(few[0])) == 0);
+    CHECK(few[1].max == 0 && hil_hist_count(&few[1]) == 0);
+
+    CHECK(hil_hist_dump_encode(1000, in, HIL_HIST_ID_COUNT, buf, sizeof(buf) - 1U) == 0);
+    len = hil_hist_dump_encode(1000, in, HIL_HIST_ID_COUNT, buf, sizeof(buf));
+
+    uint8_t bad[sizeof(buf) + 1U];
+
+    memcpy(bad, buf, len);
+    bad[8] ^= 0x01;                                 /* checksum */
+    CHECK(hil_hist_dump_decode(bad, len, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+
+    memcpy(bad, buf, len);
+    bad[0] = (uint8_t)(bad[0] + 1U);                /* magic, sum fixed up */
+    bad[len - 1U] = (uint8_t)(bad[len - 1U] + 1U);
+    CHECK(hil_hist_dump_decode(bad, len, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+
+    memcpy(bad, buf, len);
+    bad[5 + 9] = HIL_HIST_BUCKETS + 1U;             /* first record's nb */
+    bad[len - 1U] = (uint8_t)(bad[len - 1U] + 1U + HIL_HIST_BUCKETS - 4U);
+    CHECK(hil_hist_dump_decode(bad, len, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+
+    /* Truncated, or with a trailing byte, both with a valid sum. */
+    for (size_t cut = 6; cut < len; cut += 7) {
+        uint8_t sum = 0;
+        memcpy(bad, buf, cut - 1U);
+        for (size_t i = 0; i + 1U < cut; i++) {
+            sum = (uint8_t)(sum + bad[i]);
+        }
+        bad[cut - 1U] = sum;
+        CHECK(hil_hist_dump_decode(bad, cut, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+    }
+    memcpy(bad, buf, len - 1U);
+    bad[len - 1U] = 0;
+    bad[len] = buf[len - 1U];
+    CHECK(hil_hist_dump_decode(bad, len + 1U, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+
+    CHECK(hil_hist_dump_decode(buf, 5, &window_ms, out, HIL_HIST_ID_COUNT) == -1);
+}
+
+/* ── Concurrent record / take ─────────────────────────────────────────────── */
+
+#define PRODUCERS  2
+
+static struct hil_hist live;
+static atomic_int producers_left;
+
+/* Values spread over every bucket, so the extremes move between windows. */
+static void *producer(void *arg)
+{
+    uint32_t x = (uint32_t)(uintptr_t)arg * 2654435761U + 1U;
+    for (uint32_t i = 0; i < count; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        hil_hist_record(&live, x >> (x & 31U));
+        if ((i & 1023U) == 0U) {
+            sched_yield();
+        }
+    }
+    atomic_fetch_sub(&producers_left, 1);
+    return NULL;
+}
+
+static void test_race(void)
+{
+    pthread_t t[PRODUCERS];
+    atomic_store(&producers_left, PRODUCERS);
+    for (uintptr_t i = 0; i < PRODUCERS; i++) {
+        pthread_create(&t[i], NULL, producer, (void *)i);
+    }
+
+    uint64_t got = 0;
+    unsigned long windows = 0, bad = 0, empty = 0;
+    for (;;) {
+        bool last = atomic_load(&producers_left) == 0;
+        struct hil_hist_window w;
+        hil_hist_take(&live, &w);
+        got += hil_hist_count(&w);
+        windows++;
+        empty += hil_hist_count(&w) == 0U;
+        bad += !consistent(&w);
+        if (last) {
+            break;
+        }
+        sched_yield();
+    }
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_join(t[i], NULL);
+    }
+
+    printf("race: %lu windows (%lu empty)  got %lu  inconsistent %lu\n",
+           windows, empty, (unsigned long)got, bad);
+    CHECK(got == (uint64_t)count * PRODUCERS);
+    CHECK(bad == 0);
+}
+
+int main(int argc, char **argv)
+{
+    count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000000U;
+
+    test_buckets();
+    test_record_take();
+    test_split_sample();
+    test_pct();
+    test_dump();
+    test_race();
+
+    printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,295 @@
+/**
+ * @file regemu_test.c
+ * @brief Host tests of the register-map emulator (hil_core/regemu.h), driven
+ *        through the same bus events the I2C target ISRs raise.
+ *
+ * Covered:
+ *   - bursts that cross rows: merged image runs, SNAP runs, a SNAP row whose
+ *     offset is not adjacent, an FN row and an unmapped hole
+ *   - HIL_REG_LATCH: a latched pair read in two transactions stays on one
+ *     packet; reading the latch register again moves to the newest
+ *   - gates: masked SNAP rows read zero and split a run mid-burst
+ *   - page wrap: bursts and writes wrap at the top of the page, and a
+ *     page-select handler moves later accesses to the other image
+ *   - pool references: only the active packet and live pins hold one
+ */
+
+#include "hil_core/regemu.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);  \
+            failures++;                                                      \
+        }                                                                    \
+    } while (0)
+
+/* ── Test device ──────────────────────────────────────────────────────────── */
+
+enum { GRP_BURST = 0, GRP_PAIR = 1 };
+enum { GATE_A = 0, GATE_B = 1 };
+
+#define REG_PAGE   0x7FU   /* page select, on both pages */
+#define FN_VALUE   0xA5U
+#define UNMAPPED   0xEEU
+
+static uint8_t fn_read(struct hil_regemu *e, uint8_t reg)
+{
+    (void)e;
+    return (uint8_t)(FN_VALUE ^ reg);
+}
+
+static void page_write(struct hil_regemu *e, uint8_t reg, uint8_t val)
+{
+    hil_regemu_set_page(e, val);
+    hil_regemu_store(e, reg, val);   /* reads back on the selected page */
+}
+
+static const struct hil_reg_def page0_rows[] = {
+    /* 0x00-0x07: two image rows, one run */
+    { .first = 0x00, .len = 4, .src = HIL_REG_IMAGE },
+    { .first = 0x04, .len = 4, .src = HIL_REG_IMAGE, .flags = HIL_REG_RO },
+    /* 0x08-0x0F: two adjacent SNAP rows with different gates, then one
+     * whose offset jumps */
+    { .first = 0x08, .len = 4, .src = HIL_REG_SNAP, .group = GRP_BURST,
+      .gate = GATE_A, .offset = 10 },
+    { .first = 0x0C, .len = 2, .src = HIL_REG_SNAP, .group = GRP_BURST,
+      .gate = GATE_B, .offset = 14 },
+    { .first = 0x0E, .len = 2, .src = HIL_REG_SNAP, .group = GRP_BURST,
+      .gate = GATE_A, .offset = 40 },
+    /* 0x10: computed; 0x11 unmapped */
+    { .first = 0x10, .len = 1, .src = HIL_REG_FN, .read = fn_read },
+    /* 0x20-0x21: MSB/LSB pair, latched on the MSB */
+    { .first = 0x20, .len = 1, .src = HIL_REG_SNAP, .flags = HIL_REG_LATCH,
+      .group = GRP_PAIR, .gate = GATE_A, .offset = 60 },
+    { .first = 0x21, .len = 1, .src = HIL_REG_SNAP, .group = GRP_PAIR,
+      .gate = GATE_A, .offset = 61 },
+    /* 0x7C-0x7F: image at the top of the page, page select last */
+    { .first = 0x7C, .len = 3, .src = HIL_REG_IMAGE },
+    { .first = REG_PAGE, .len = 1, .src = HIL_REG_IMAGE, .write = page_write },
+};
+
+static const struct hil_reg_def page1_rows[] = {
+    { .first = 0x00, .len = 8, .src = HIL_REG_IMAGE },
+    { .first = REG_PAGE, .len = 1, .src = HIL_REG_IMAGE, .write = page_write },
+};
+
+static const struct hil_reg_page pages[] = {
+    { page0_rows, sizeof(page0_rows) / sizeof(page0_rows[0]) },
+    { page1_rows, sizeof(page1_rows) / sizeof(page1_rows[0]) },
+};
+
+static const struct hil_regemu_desc desc = {
+    .pages = pages,
+    .n_pages = 2,
+    .unmapped = UNMAPPED,
+};
+
+static struct hil_pool pool;
+static struct hil_regemu emu;
+static uint8_t image0[HIL_REGEMU_REGS], image1[HIL_REGEMU_REGS];
+
+/* ── Bus helpers ──────────────────────────────────────────────────────────── */
+
+static void set_reg(uint8_t reg)
+{
+    hil_regemu_write_start(&emu);
+    hil_regemu_write_byte(&emu, reg);
+}
+
+static void burst(uint8_t reg, uint8_t *out, size_t n)
+{
+    set_reg(reg);
+    out[0] = hil_regemu_read_start(&emu);
+    for (size_t i = 1; i < n; i++) {
+        out[i] = hil_regemu_read_next(&emu);
+    }
+    hil_regemu_stop(&emu);
+}
+
+static uint8_t read1(uint8_t reg)
+{
+    uint8_t v;
+    burst(reg, &v, 1);
+    return v;
+}
+
+static void write_regs(uint8_t reg, const uint8_t *val, size_t n)
+{
+    set_reg(reg);
+    for (size_t i = 0; i < n; i++) {
+        hil_regemu_write_byte(&emu, val[i]);
+    }
+    hil_regemu_stop(&emu);
+}
+
+/* Allocates a packet whose byte i is tag + i and publishes it. */
+static uint16_t publish(uint8_t tag)
+{
+    uint16_t k = hil_pool_alloc(&pool);
+    uint8_t *b = (uint8_t *)hil_pool_pkt(&pool, k);
+    for (size_t i = 0; i < sizeof(device_update_packet_t); i++) {
+        b[i] = (uint8_t)(tag + i);
+    }
+    hil_regemu_publish(&emu, k);
+    hil_pool_put(&pool, k);
+    return k;
+}
+
+/* ── Tests ────────────────────────────────────────────────────────────────── */
+
+static void test_span_rows(void)
+{
+    for (uint32_t i = 0; i < HIL_REGEMU_REGS; i++) {
+        image0[i] = (uint8_t)(0x80U + i);
+    }
+    publish(0x10);
+
+    uint8_t b[18];
+    burst(0x02, b, sizeof(b));
+    /* 0x02-0x07: image, across the RO row boundary */
+    for (int i = 0; i < 6; i++) {
+        CHECK(b[i] == 0x82 + i);
+    }
+    /* 0x08-0x0D: offsets 10..15, two rows in one run */
+    for (int i = 0; i < 6; i++) {
+        CHECK(b[6 + i] == 0x10 + 10 + i);
+    }
+    /* 0x0E-0x0F: offset jumps to 40 */
+    CHECK(b[12] == 0x10 + 40);
+    CHECK(b[13] == 0x10 + 41);
+    /* 0x10 computed, 0x11-0x13 unmapped */
+    CHECK(b[14] == (FN_VALUE ^ 0x10));
+    CHECK(b[15] == UNMAPPED && b[16] == UNMAPPED && b[17] == UNMAPPED);
+
+    /* Starting mid-row lands on the right byte. */
+    CHECK(read1(0x0B) == 0x10 + 13);
+    CHECK(read1(0x0F) == 0x10 + 41);
+
+    /* Writes: image stores, RO and SNAP rows ignore them. */
+    const uint8_t w[] = { 1, 2, 3, 4, 5 };
+    write_regs(0x02, w, sizeof(w));
+    CHECK(image0[0x02] == 1 && image0[0x03] == 2);
+    CHECK(image0[0x04] == 0x84 && image0[0x06] == 0x86);
+}
+
+static void test_latch(void)
+{
+    publish(0x20);
+    CHECK(read1(0x20) == 0x20 + 60);   /* MSB read pins the pair */
+    publish(0x40);
+    CHECK(read1(0x21) == 0x20 + 61);   /* LSB still from the first packet */
+    CHECK(read1(0x0C) == 0x40 + 14);   /* start-pinned group sees the new one */
+
+    CHECK(read1(0x20) == 0x40 + 60);   /* next MSB re-pins */
+    CHECK(read1(0x21) == 0x40 + 61);
+
+    /* A burst through the latch register re-pins on the way. */
+    publish(0x50);
+    uint8_t b[3];
+    burst(0x1F, b, sizeof(b));
+    CHECK(b[0] == UNMAPPED && b[1] == 0x50 + 60 && b[2] == 0x50 + 61);
+
+    /* The latched pin holds a reference across STOP, only until the next. */
+    uint16_t pinned = hil_regemu_snap_idx(&emu, GRP_PAIR);
+    publish(0x60);
+    CHECK(hil_regemu_snap_idx(&emu, GRP_PAIR) == pinned);
+    read1(0x20);
+    CHECK(hil_regemu_snap_idx(&emu, GRP_PAIR) != pinned);
+    CHECK(hil_regemu_snap_idx(&emu, GRP_BURST) == HIL_POOL_NONE);
+}
+
+static void test_gates(void)
+{
+    publish(0x30);
+    uint8_t b[8];
+
+    hil_regemu_set_live(&emu, 1U << GATE_A);
+    burst(0x08, b, sizeof(b));
+    for (int i = 0; i < 4; i++) {
+        CHECK(b[i] == 0x30 + 10 + i);
+    }
+    CHECK(b[4] == 0 && b[5] == 0);             /* gate B off mid-burst */
+    CHECK(b[6] == 0x30 + 40 && b[7] == 0x30 + 41);
+
+    hil_regemu_set_live(&emu, 1U << GATE_B);
+    burst(0x08, b, sizeof(b));
+    CHECK(b[0] == 0 && b[3] == 0);
+    CHECK(b[4] == 0x30 + 14 && b[5] == 0x30 + 15);
+    CHECK(b[6] == 0 && b[7] == 0);
+    CHECK(read1(0x21) == 0);                   /* latched rows are gated too */
+
+    hil_regemu_set_live(&emu, UINT32_MAX);
+    burst(0x08, b, sizeof(b));
+    CHECK(b[5] == 0x30 + 15 && b[6] == 0x30 + 40);
+}
+
+static void test_page_wrap(void)
+{
+    image0[0x7C] = 0xC0;
+    image0[0x7D] = 0xC1;
+    image0[0x7E] = 0xC2;
+    image0[REG_PAGE] = 0;
+    image0[0x00] = 0xD0;
+    image0[0x01] = 0xD1;
+    for (uint32_t i = 0; i < 8; i++) {
+        image1[i] = (uint8_t)(0xF0U + i);
+    }
+
+    /* A burst off the top of page 0 wraps to register 0 of page 0. */
+    uint8_t b[5];
+    burst(0x7D, b, sizeof(b));
+    CHECK(b[0] == 0xC1 && b[1] == 0xC2 && b[2] == 0x00);
+    CHECK(b[3] == 0xD0 && b[4] == 0xD1);
+
+    /* So does a write burst; the page register takes its handler. */
+    const uint8_t w[] = { 0xAA, 0x00, 0xBB };
+    write_regs(0x7E, w, sizeof(w));
+    CHECK(image0[0x7E] == 0xAA && image0[0x00] == 0xBB);
+    CHECK(emu.page == 0);
+
+    /* Select page 1: reads and writes now go to image1. */
+    const uint8_t sel = 1;
+    write_regs(REG_PAGE, &sel, 1);
+    CHECK(emu.page == 1);
+    burst(0x7F, b, 3);
+    CHECK(b[0] == 1 && b[1] == 0xF0 && b[2] == 0xF1);
+    CHECK(read1(0x10) == UNMAPPED);
+
+    /* An out-of-range page is ignored; page 0 comes back. */
+    const uint8_t bad = 7, back = 0;
+    write_regs(REG_PAGE, &bad, 1);
+    CHECK(emu.page == 1);
+    write_regs(REG_PAGE, &back, 1);
+    CHECK(emu.page == 0);
+    CHECK(read1(0x7C) == 0xC0);
+}
+
+int main(void)
+{
+    hil_pool_init(&pool);
+    uint8_t *const images[] = { image0, image1 };
+    hil_regemu_init(&emu, &desc, images, 0, &pool, NULL);
+
+    /* Nothing published: SNAP rows read zero, the rest is served. */
+    CHECK(read1(0x08) == 0);
+    CHECK(read1(0x10) == (FN_VALUE ^ 0x10));
+
+    test_span_rows();
+    test_latch();
+    test_gates();
+    test_page_wrap();
+
+    /* Only the active packet and the latched pair's pin are left. */
+    uint32_t held = (hil_regemu_snap_idx(&emu, GRP_PAIR) ==
+                     (uint16_t)hil_atomic_get(&emu.active)) ? 1U : 2U;
+    CHECK(hil_pool_in_use(&pool) == held);
+
+    printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+    return failures ? 1 : 0;
+}
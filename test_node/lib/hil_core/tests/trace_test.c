@@ -0,0 +1,240 @@
+/**
+ * @file trace_test.c
+ * @brief Host tests of the binary trace ring and its dump (hil_core/trace.h).
+ *
+ * Covered:
+ *   - full ring: the newest record is dropped and counted, the oldest are
+ *     kept, and a drained slot takes records again
+ *   - dump encode/decode round trip, and the 8-bit checksum catching any
+ *     single corrupted byte
+ *   - decode rejection: short buffer, bad magic or version, a record count
+ *     that disagrees with the length, more records than max_n
+ *   - PRODUCERS threads putting while the main thread drains: every record
+ *     comes out at most once, untorn, in order per producer, and what did
+ *     not come out is exactly what was counted as dropped
+ *
+ *   trace_test [COUNT]      records per producer, default 1 000 000
+ */
+
+#include "hil_core/trace.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures;
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);  \
+            failures++;                                                      \
+        }                                                                    \
+    } while (0)
+
+static uint32_t count;
+
+/* Record k of producer p; a2 ties the fields together to spot tearing. */
+static struct hil_trace_rec make_rec(uint16_t p, uint32_t k)
+{
+    struct hil_trace_rec r = {
+        .ts = k * 3U,
+        .id = (uint16_t)(k % HIL_TEV_COUNT),
+        .a0 = p,
+        .a1 = k,
+        .a2 = (k * 2654435761U) ^ p,
+    };
+    return r;
+}
+
+static bool untorn(const struct hil_trace_rec *r)
+{
+    return r->ts == r->a1 * 3U && r->id == r->a1 % HIL_TEV_COUNT &&
+           r->a2 == ((r->a1 * 2654435761U) ^ r->a0);
+}
+
+/* ── Ring ─────────────────────────────────────────────────────────────────── */
+
+static void test_full(void)
+{
+    static struct hil_trace t;
+    struct hil_trace_rec r;
+
+    hil_trace_init(&t);
+    CHECK(!hil_trace_get(&t, &r));
+
+    for (uint32_t k = 0; k < HIL_TRACE_LEN + 10U; k++) {
+        struct hil_trace_rec in = make_rec(0, k);
+        hil_trace_put(&t, &in);
+    }
+    CHECK(hil_trace_dropped(&t) == 10);
+
+    /* The start of the burst survives, the end is what was lost. */
+    CHECK(hil_trace_get(&t, &r) && r.a1 == 0 && untorn(&r));
+
+    /* One slot free again: the next put lands, the one after drops. */
+    struct hil_trace_rec late = make_rec(1, 7);
+    hil_trace_put(&t, &late);
+    hil_trace_put(&t, &late);
+    CHECK(hil_trace_dropped(&t) == 11);
+
+    uint32_t n = 1;
+    while (hil_trace_get(&t, &r)) {
+        if (n < HIL_TRACE_LEN) {
+            CHECK(r.a0 == 0 && r.a1 == n);
+        } else {
+            CHECK(r.a0 == 1 && r.a1 == 7);
+        }
+        n++;
+    }
+    CHECK(n == HIL_TRACE_LEN + 1U);
+}
+
+/* ── Dump ─────────────────────────────────────────────────────────────────── */
+
+static void test_dump(void)
+{
+    struct hil_trace_rec in[40], out[40];
+    for (uint32_t k = 0; k < 40; k++) {
+        in[k] = make_rec((uint16_t)(k * 1000U), 0xFFFFFF00U + k);
+    }
+
+    uint8_t buf[HIL_TRACE_DUMP_SIZE(40)];
+    size_t len = hil_trace_dump_encode(3, 0x01020304U, in, 40, buf, sizeof(buf));
+    CHECK(len == HIL_TRACE_DUMP_SIZE(40));
+    CHECK(hil_trace_dump_encode(3, 0, in, 40, buf, sizeof(buf) - 1U) == 0);
+    CHECK(hil_trace_dump_encode(3, 0, in, 256, buf, sizeof(buf)) == 0);
+
+    uint8_t ring = 0;
+    uint32_t dropped = 0;
+    memset(out, 0, sizeof(out));
+    CHECK(hil_trace_dump_decode(buf, len, &ring, &dropped, out, 40) == 40);
+    CHECK(ring == 3 && dropped == 0x01020304U);
+    CHECK(memcmp(in, out, sizeof(in)) == 0);
+
+    /* Any one byte off, the sum included, fails the checksum. */
+    uint8_t bad[sizeof(buf) + 1U];
+    int accepted = 0;
+    for (size_t i = 0; i < len; i++) {
+        memcpy(bad, buf, len);
+        bad[i] ^= 0x10;
+        accepted += hil_trace_dump_decode(bad, len, &ring, &dropped, out, 40) != -1;
+    }
+    CHECK(accepted == 0);
+
+    /* Structurally wrong dumps with a correct sum. */
+    uint8_t empty[HIL_TRACE_DUMP_SIZE(0)];
+    CHECK(hil_trace_dump_encode(0, 0, NULL, 0, empty, sizeof(empty)) == sizeof(empty));
+    CHECK(hil_trace_dump_decode(empty, sizeof(empty), &ring, &dropped, out, 0) == 0);
+    CHECK(hil_trace_dump_decode(empty, sizeof(empty) - 1U, &ring, &dropped, out, 0) == -1);
+
+    memcpy(bad, buf, len);
+    bad[0] = (uint8_t)(bad[0] + 1U);                /* magic */
+    bad[len - 1U] = (uint8_t)(bad[len - 1U] + 1U);
+    CHECK(hil_trace_dump_decode(bad, len, &ring, &dropped, out, 40) == -1);
+
+    memcpy(bad, buf, len);
+    bad[1] = (uint8_t)(bad[1] + 1U);                /* version */
+    bad[len - 1U] = (uint8_t)(bad[len - 1U] + 1U);
+    CHECK(hil_trace_dump_decode(bad, len, &ring, &dropped, out, 40) == -1);
+
+    memcpy(bad, buf, len);
+    bad[3] = (uint8_t)(bad[3] - 1U);                /* n one short of len */
+    bad[len - 1U] = (uint8_t)(bad[len - 1U] - 1U);
+    CHECK(hil_trace_dump_decode(bad, len, &ring, &dropped, out, 40) == -1);
+
+    memcpy(bad, buf, len - 1U);                     /* trailing byte */
+    bad[len - 1U] = 0;
+    bad[len] = buf[len - 1U];
+    CHECK(hil_trace_dump_decode(bad, len + 1U, &ring, &dropped, out, 40) == -1);
+
+    /* More records than the caller has room for. */
+    CHECK(hil_trace_dump_decode(buf, len, &ring, &dropped, out, 39) == -1);
+}
+
+/* ── Concurrent producers ─────────────────────────────────────────────────── */
+
+#define PRODUCERS  3
+
+static struct hil_trace ring;
+static atomic_int producers_left;
+
+static void *producer(void *arg)
+{
+    uint16_t p = (uint16_t)(uintptr_t)arg;
+    for (uint32_t k = 0; k < count; k++) {
+        struct hil_trace_rec r = make_rec(p, k);
+        hil_trace_put(&ring, &r);
+        if ((k & 255U) == 0U) {
+            sched_yield();
+        }
+    }
+    atomic_fetch_sub(&producers_left, 1);
+    return NULL;
+}
+
+static void test_race(void)
+{
+    uint8_t *seen = calloc((size_t)count * PRODUCERS, 1);
+    if (seen == NULL) {
+        CHECK(seen != NULL);
+        return;
+    }
+
+    hil_trace_init(&ring);
+    atomic_store(&producers_left, PRODUCERS);
+    pthread_t t[PRODUCERS];
+    for (uintptr_t p = 0; p < PRODUCERS; p++) {
+        pthread_create(&t[p], NULL, producer, (void *)p);
+    }
+
+    int64_t last[PRODUCERS] = { -1, -1, -1 };
+    unsigned long got = 0, torn = 0, out_of_order = 0, dup = 0;
+    struct hil_trace_rec r;
+    for (;;) {
+        bool done = atomic_load(&producers_left) == 0;
+        bool any = false;
+        while (hil_trace_get(&ring, &r)) {
+            any = true;
+            got++;
+            if (r.a0 >= PRODUCERS || r.a1 >= count || !untorn(&r)) {
+                torn++;
+                continue;
+            }
+            out_of_order += (int64_t)r.a1 <= last[r.a0];
+            last[r.a0] = r.a1;
+            dup += seen[(size_t)r.a0 * count + r.a1]++ != 0;
+        }
+        if (done) {
+            break;
+        }
+        if (!any) {
+            sched_yield();
+        }
+    }
+    for (int p = 0; p < PRODUCERS; p++) {
+        pthread_join(t[p], NULL);
+    }
+
+    unsigned long dropped = hil_trace_dropped(&ring);
+    printf("race: got %lu  dropped %lu  torn %lu  out of order %lu  dup %lu\n",
+           got, dropped, torn, out_of_order, dup);
+    CHECK(torn == 0 && out_of_order == 0 && dup == 0);
+    CHECK(got + dropped == (unsigned long)count * PRODUCERS);
+    free(seen);
+}
+
+int main(int argc, char **argv)
+{
+    count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1000000U;
+
+    test_full();
+    test_dump();
+    test_race();
+
+    printf("%s (%d failed)\n", failures ? "FAIL" : "PASS", failures);
+    return failures ? 1 : 0;
+}
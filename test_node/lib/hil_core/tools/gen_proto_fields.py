@@ -0,0 +1,397 @@
+#!/usr/bin/env python3
+"""Generate hil_core's SensorPacket field numbers and decoder from shared/proto/sensor_data.proto.
+
+nanopb only reaches this repo as a Zephyr west module, and hil_core also has
+to build with plain CMake on the host (hil_replay, the host tests,
+flight_sim's wire-format tests), where there is no copy of it.  Rather than
+vendor nanopb for one schema, this script generates what the node needs
+from the .proto, for host and target alike:
+
+    include/hil_core/sensor_data_fields.h   HIL_PB_<MESSAGE>_<FIELD> numbers
+    include/hil_core/sensor_data_pb.h       one plain struct per message
+    src/sensor_data_pb.c                    hil_pb_decode_<message>()
+
+so the .proto stays the only place field numbers and types are written
+down.  frame.c maps the decoded SensorPacket onto the node's packet.
+
+    gen_proto_fields.py            rewrite the generated files
+    gen_proto_fields.py --check    exit 1 if any of them is out of date (CI)
+
+Only the subset of proto3 sensor_data.proto uses is accepted: top-level
+messages of uint32 / int32 / sint32 / bool / message fields; repeated only
+for message fields of a message no other message embeds.  Anything else
+(oneof, nested messages, maps, options, other scalar types) is an error
+rather than silently skipped, so a schema change that needs generator work
+cannot slip through.
+"""
+
+import argparse
+import pathlib
+import re
+import sys
+
+HERE = pathlib.Path(__file__).resolve().parent
+PROTO = HERE.parents[3] / "shared" / "proto" / "sensor_data.proto"
+FIELDS_H = HERE.parent / "include" / "hil_core" / "sensor_data_fields.h"
+PB_H = HERE.parent / "include" / "hil_core" / "sensor_data_pb.h"
+PB_C = HERE.parent / "src" / "sensor_data_pb.c"
+
+MESSAGE_RE = re.compile(r"message\s+(\w+)\s*\{(.*?)\}", re.S)
+FIELD_RE = re.compile(r"^(repeated\s+)?(\w+)\s+(\w+)\s*=\s*(\d+)\s*;$")
+
+# proto3 scalar -> (C type, expression turning the varint v into it)
+SCALARS = {
+    "uint32": ("uint32_t", "(uint32_t)v"),
+    "int32":  ("int32_t",  "(int32_t)v"),
+    "sint32": ("int32_t",  "zigzag32(v)"),
+    "bool":   ("bool",     "v != 0"),
+}
+
+BANNER = [
+    " * Generated by tools/gen_proto_fields.py from",
+    " * shared/proto/sensor_data.proto.  DO NOT EDIT; rerun the script after",
+    " * changing the schema (CI fails while this file is out of date).",
+]
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def snake(name):
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).lower()
+
+
+def snake_upper(name):
+    return snake(name).upper()
+
+
+def parse(text):
+    text = strip_comments(text)
+    messages = []
+    for m in MESSAGE_RE.finditer(text):
+        name, body = m.group(1), m.group(2)
+        fields = []
+        for stmt in filter(None, (s.strip() for s in body.split("\n"))):
+            f = FIELD_RE.match(stmt)
+            if not f:
+                sys.exit(f"{PROTO.name}: unsupported in message {name}: {stmt!r}")
+            fields.append((f.group(3), int(f.group(4)), f.group(2), bool(f.group(1))))
+        numbers = [n for _, n, _, _ in fields]
+        if len(set(numbers)) != len(numbers):
+            sys.exit(f"{PROTO.name}: duplicate field number in message {name}")
+        messages.append((name, fields))
+    if "message" in MESSAGE_RE.sub("", text):
+        sys.exit(f"{PROTO.name}: a message could not be parsed")
+    return messages
+
+
+def check_types(messages):
+    """Every field type must be a supported scalar or an earlier message."""
+    seen, embedded, has_repeated = set(), set(), set()
+    for name, fields in messages:
+        for field, _, ftype, repeated in fields:
+            where = f"{name}.{field}"
+            if ftype in SCALARS:
+                if repeated:
+                    sys.exit(f"{PROTO.name}: repeated scalar {where} is not supported")
+            elif ftype in seen:
+                if not repeated:
+                    embedded.add(ftype)
+                else:
+                    has_repeated.add(name)
+            else:
+                sys.exit(f"{PROTO.name}: {where} has unsupported or later-defined type {ftype}")
+        seen.add(name)
+    # Repeated elements go to a caller callback, which only the top-level
+    # decode call can be given.
+    for name in has_repeated & embedded:
+        sys.exit(f"{PROTO.name}: {name} has repeated fields and is embedded in another message")
+    return has_repeated
+
+
+def render_fields(messages):
+    out = [
+        "/**",
+        " * @file sensor_data_fields.h",
+        " * @brief SensorPacket field numbers.",
+        " *",
+        *BANNER,
+        " */",
+        "",
+        "#ifndef HIL_CORE_SENSOR_DATA_FIELDS_H",
+        "#define HIL_CORE_SENSOR_DATA_FIELDS_H",
+    ]
+    for name, fields in messages:
+        out += ["", f"/* {name} */"]
+        width = max(len(f"HIL_PB_{snake_upper(name)}_{f.upper()}") for f, *_ in fields)
+        for field, number, ftype, repeated in fields:
+            macro = f"HIL_PB_{snake_upper(name)}_{field.upper()}"
+            kind = ("repeated " if repeated else "") + ftype
+            out.append(f"#define {macro:<{width}}  {number:<3} /* {kind} */".rstrip())
+    out += ["", "#endif /* HIL_CORE_SENSOR_DATA_FIELDS_H */", ""]
+    return "\n".join(out)
+
+
+def ctype(ftype):
+    return SCALARS[ftype][0] if ftype in SCALARS else f"hil_pb_{snake(ftype)}_t"
+
+
+def signature(name, has_cb):
+    s = snake(name)
+    args = f"const uint8_t *buf, size_t len, hil_pb_{s}_t *out"
+    if has_cb:
+        args += f",\n        const hil_pb_{s}_cb_t *cb"
+    return f"bool hil_pb_decode_{s}({args})"
+
+
+def render_header(messages, has_repeated):
+    out = [
+        "/**",
+        " * @file sensor_data_pb.h",
+        " * @brief SensorPacket messages as plain structs, and their decoders.",
+        " *",
+        *BANNER,
+        " *",
+        " * Each message decodes into a struct with the .proto's field names.",
+        " * Decoding merges into *out: a scalar takes the last value on the wire",
+        " * and an embedded message merges, as proto3 specifies, so zero *out",
+        " * first for a fresh message.  Unknown fields, and known ones with a",
+        " * different wire type, are skipped.  Repeated message fields are not",
+        " * stored: each element is decoded on its own and handed to the callback",
+        " * in hil_pb_<message>_cb_t (NULL ignores them); returning false from it",
+        " * fails the decode.",
+        " */",
+        "",
+        "#ifndef HIL_CORE_SENSOR_DATA_PB_H",
+        "#define HIL_CORE_SENSOR_DATA_PB_H",
+        "",
+        "#include <stdbool.h>",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+    ]
+    for name, fields in messages:
+        s = snake(name)
+        out += ["", f"/* {name} */", "typedef struct {"]
+        stored = [(f, t) for f, _, t, r in fields if not r]
+        width = max((len(ctype(t)) for _, t in stored), default=0)
+        for field, ftype in stored:
+            out.append(f"    {ctype(ftype):<{width}} {field};")
+        if not stored:
+            out.append("    uint8_t unused;")
+        out.append(f"}} hil_pb_{s}_t;")
+        if name in has_repeated:
+            out += ["", "typedef struct {", "    void *ctx;"]
+            for field, _, ftype, repeated in fields:
+                if repeated:
+                    out.append(f"    bool (*{field})(void *ctx, const {ctype(ftype)} *msg);")
+            out.append(f"}} hil_pb_{s}_cb_t;")
+        out += ["", f"{signature(name, name in has_repeated)};"]
+    out += ["", "#endif /* HIL_CORE_SENSOR_DATA_PB_H */", ""]
+    return "\n".join(out)
+
+
+PRELUDE = """\
+#include "hil_core/sensor_data_pb.h"
+
+#include "hil_core/sensor_data_fields.h"
+
+#include <string.h>
+
+/* ── Wire primitives ──────────────────────────────────────────────────────── */
+
+enum {
+    WT_VARINT = 0,
+    WT_I64    = 1,
+    WT_LEN    = 2,
+    WT_I32    = 5,
+};
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+} pb_cursor_t;
+
+static bool read_varint(pb_cursor_t *c, uint64_t *out)
+{
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (c->p >= c->end) {
+            return false;
+        }
+        uint8_t b = *c->p++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *out = v;
+            return true;
+        }
+    }
+    return false;   /* > 10 bytes */
+}
+
+static bool skip_field(pb_cursor_t *c, uint32_t wire_type)
+{
+    uint64_t n;
+    switch (wire_type) {
+    case WT_VARINT:
+        return read_varint(c, &n);
+    case WT_I64:
+        n = 8;
+        break;
+    case WT_I32:
+        n = 4;
+        break;
+    case WT_LEN:
+        if (!read_varint(c, &n)) {
+            return false;
+        }
+        break;
+    default:
+        return false;   /* groups are not valid proto3 */
+    }
+    if ((uint64_t)(c->end - c->p) < n) {
+        return false;
+    }
+    c->p += n;
+    return true;
+}
+
+/** Reads a LEN field header and narrows c to a sub-cursor over its body. */
+static bool enter_submessage(pb_cursor_t *c, pb_cursor_t *sub)
+{
+    uint64_t n;
+    if (!read_varint(c, &n) || (uint64_t)(c->end - c->p) < n) {
+        return false;
+    }
+    sub->p   = c->p;
+    sub->end = c->p + n;
+    c->p    += n;
+    return true;
+}
+
+static inline int32_t zigzag32(uint64_t v)
+{
+    uint32_t u = (uint32_t)v;
+    return (int32_t)((u >> 1) ^ (0U - (u & 1U)));
+}
+"""
+
+
+def render_source(messages, has_repeated):
+    used = {t for _, fields in messages for _, _, t, _ in fields}
+    out = [
+        "/**",
+        " * @file sensor_data_pb.c",
+        " * @brief SensorPacket decoders (see sensor_data_pb.h).",
+        " *",
+        *BANNER,
+        " */",
+        "",
+    ]
+    prelude = PRELUDE
+    if "sint32" not in used:
+        prelude = prelude[:prelude.index("static inline int32_t zigzag32")].rstrip() + "\n"
+    out += prelude.split("\n")
+    out += ["/* ── Messages ─────────────────────────────────────────────────────────────── */"]
+
+    for name, fields in messages:
+        s = snake(name)
+        has_scalar = any(t in SCALARS for _, _, t, _ in fields)
+        has_message = any(t not in SCALARS for _, _, t, _ in fields)
+        out += ["", signature(name, name in has_repeated), "{",
+                "    pb_cursor_t c = { .p = buf, .end = buf + len };"]
+        if has_message:
+            out.append("    pb_cursor_t sub;")
+        out += [
+            "",
+            "    while (c.p < c.end) {",
+            "        uint64_t key;" if not has_scalar else "        uint64_t key, v;",
+            "        if (!read_varint(&c, &key)) {",
+            "            return false;",
+            "        }",
+            "        uint32_t wt = (uint32_t)(key & 7);",
+            "",
+            "        switch (key >> 3) {",
+        ]
+        for field, _, ftype, repeated in fields:
+            macro = f"HIL_PB_{snake_upper(name)}_{field.upper()}"
+            out.append(f"        case {macro}:")
+            if ftype in SCALARS:
+                out += [
+                    "            if (wt == WT_VARINT) {",
+                    "                if (!read_varint(&c, &v)) {",
+                    "                    return false;",
+                    "                }",
+                    f"                out->{field} = {SCALARS[ftype][1]};",
+                    "                continue;",
+                    "            }",
+                ]
+            elif not repeated:
+                t = snake(ftype)
+                out += [
+                    "            if (wt == WT_LEN) {",
+                    "                if (!enter_submessage(&c, &sub) ||",
+                    f"                    !hil_pb_decode_{t}(sub.p, (size_t)(sub.end - sub.p), &out->{field})) {{",
+                    "                    return false;",
+                    "                }",
+                    "                continue;",
+                    "            }",
+                ]
+            else:
+                t = snake(ftype)
+                out += [
+                    "            if (wt == WT_LEN) {",
+                    f"                hil_pb_{t}_t msg;",
+                    "                memset(&msg, 0, sizeof(msg));",
+                    "                if (!enter_submessage(&c, &sub) ||",
+                    f"                    !hil_pb_decode_{t}(sub.p, (size_t)(sub.end - sub.p), &msg) ||",
+                    f"                    (cb != NULL && cb->{field} != NULL && !cb->{field}(cb->ctx, &msg))) {{",
+                    "                    return false;",
+                    "                }",
+                    "                continue;",
+                    "            }",
+                ]
+            out.append("            break;")
+        out += [
+            "        default:",
+            "            break;",
+            "        }",
+            "        if (!skip_field(&c, wt)) {",
+            "            return false;",
+            "        }",
+            "    }",
+            "    return true;",
+            "}",
+        ]
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true",
+                    help="fail if a checked-in file differs")
+    args = ap.parse_args()
+
+    messages = parse(PROTO.read_text())
+    has_repeated = check_types(messages)
+    outputs = {
+        FIELDS_H: render_fields(messages),
+        PB_H: render_header(messages, has_repeated),
+        PB_C: render_source(messages, has_repeated),
+    }
+    if args.check:
+        stale = [p for p, text in outputs.items()
+                 if not p.exists() or p.read_text() != text]
+        for p in stale:
+            print(f"{p} is out of date with {PROTO}; "
+                  f"run {pathlib.Path(__file__).name}", file=sys.stderr)
+        return 1 if stale else 0
+    for p, text in outputs.items():
+        p.write_text(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,191 @@
+/**
+ * @file hil_hist.c
+ * @brief Renders the latency histograms the test node dumps on its console.
+ *
+ * The diag thread prints one "#H <hex>" line per window (see hil_core/hist.h
+ * for the format).  Pipe the serial log through this tool, or point it at a
+ * saved log; every other line is ignored.
+ *
+ * Usage
+ * ─────
+ *   hil_hist [--bars] [--total] [LOG]
+ *
+ *   --bars   Also draw the bucket distribution of each histogram.
+ *   --total  Print one table merged over all windows instead of one per window.
+ *
+ * Example
+ * ───────
+ *   python -m serial.tools.miniterm /dev/ttyACM0 115200 | tee run.log
+ *   hil_hist --total --bars run.log
+ */
+
+#include "hil_core/hist.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ── Parsing ──────────────────────────────────────────────────────────────── */
+
+static int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static size_t parse_hex(const char *s, uint8_t *out, size_t cap)
+{
+    size_t n = 0;
+    while (n < cap) {
+        int hi = hex_nibble(s[0]);
+        int lo = (hi < 0) ? -1 : hex_nibble(s[1]);
+        if (lo < 0) {
+            break;
+        }
+        out[n++] = (uint8_t)((hi << 4) | lo);
+        s += 2;
+    }
+    return n;
+}
+
+/* ── Rendering ────────────────────────────────────────────────────────────── */
+
+static void merge(struct hil_hist_window *acc, const struct hil_hist_window *w)
+{
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        acc->bucket[k] += w->bucket[k];
+    }
+    if (w->min < acc->min) acc->min = w->min;
+    if (w->max > acc->max) acc->max = w->max;
+}
+
+static void print_bars(const struct hil_hist_window *w)
+{
+    uint32_t peak = 0, first = HIL_HIST_BUCKETS, last = 0;
+    for (uint32_t k = 0; k < HIL_HIST_BUCKETS; k++) {
+        if (w->bucket[k] > peak) peak = w->bucket[k];
+        if (w->bucket[k] != 0) {
+            if (first == HIL_HIST_BUCKETS) first = k;
+            last = k;
+        }
+    }
+    if (peak == 0) {
+        return;
+    }
+    for (uint32_t k = first; k <= last; k++) {
+        uint32_t lo = (k == 0) ? 0 : hil_hist_bucket_hi(k - 1) + 1;
+        char range[32];
+        if (k == HIL_HIST_BUCKETS - 1) {
+            snprintf(range, sizeof(range), ">=%" PRIu32, lo);
+        } else {
+            snprintf(range, sizeof(range), "%" PRIu32 "-%" PRIu32, lo, hil_hist_bucket_hi(k));
+        }
+        int len = (int)((uint64_t)w->bucket[k] * 50U / peak);
+        if (w->bucket[k] != 0 && len == 0) {
+            len = 1;
+        }
+        printf("      %15s us %10" PRIu32 " |%.*s\n", range, w->bucket[k], len,
+               "##################################################");
+    }
+}
+
+static void print_table(const struct hil_hist_window *w, size_t n, bool bars)
+{
+    printf("  %-10s %10s %8s %8s %8s %8s   (us)\n", "stage", "n", "min", "p50", "p99", "max");
+    for (size_t i = 0; i < n; i++) {
+        uint32_t count = hil_hist_count(&w[i]);
+        if (count == 0) {
+            printf("  %-10s %10s\n", hil_hist_name((uint32_t)i), "-");
+            continue;
+        }
+        printf("  %-10s %10" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n",
+               hil_hist_name((uint32_t)i), count, w[i].min, hil_hist_pct(&w[i], 50),
+               hil_hist_pct(&w[i], 99), w[i].max);
+        if (bars) {
+            print_bars(&w[i]);
+        }
+    }
+}
+
+static void reset(struct hil_hist_window *w, size_t n)
+{
+    memset(w, 0, n * sizeof(*w));
+    for (size_t i = 0; i < n; i++) {
+        w[i].min = UINT32_MAX;
+    }
+}
+
+/* ── Main ─────────────────────────────────────────────────────────────────── */
+
+int main(int argc, char **argv)
+{
+    bool bars = false, total = false;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bars") == 0) {
+            bars = true;
+        } else if (strcmp(argv[i], "--total") == 0) {
+            total = true;
+        } else if (argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [--bars] [--total] [LOG]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    FILE *f = path ? fopen(path, "r") : stdin;
+    if (f == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    struct hil_hist_window win[HIL_HIST_ID_COUNT], acc[HIL_HIST_ID_COUNT];
+    reset(acc, HIL_HIST_ID_COUNT);
+    uint64_t acc_ms = 0;
+    uint32_t windows = 0, bad = 0;
+
+    static char line[8192];
+    static uint8_t bin[HIL_HIST_DUMP_MAX(HIL_HIST_ID_COUNT) + 64];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        const char *hex = strstr(line, HIL_HIST_LINE_PREFIX);
+        if (hex == NULL) {
+            continue;
+        }
+        size_t len = parse_hex(hex + strlen(HIL_HIST_LINE_PREFIX), bin, sizeof(bin));
+
+        uint16_t window_ms = 0;
+        reset(win, HIL_HIST_ID_COUNT);
+        if (hil_hist_dump_decode(bin, len, &window_ms, win, HIL_HIST_ID_COUNT) < 0) {
+            bad++;
+            continue;
+        }
+        windows++;
+
+        if (total) {
+            for (size_t i = 0; i < HIL_HIST_ID_COUNT; i++) {
+                merge(&acc[i], &win[i]);
+            }
+            acc_ms += window_ms;
+        } else {
+            printf("window %" PRIu32 "  (%u ms)\n", windows, window_ms);
+            print_table(win, HIL_HIST_ID_COUNT, bars);
+        }
+    }
+    if (path) {
+        fclose(f);
+    }
+
+    if (total && windows > 0) {
+        printf("%" PRIu32 " windows  (%.1f s)\n", windows, (double)acc_ms / 1000.0);
+        print_table(acc, HIL_HIST_ID_COUNT, bars);
+    }
+    if (bad > 0) {
+        fprintf(stderr, "%" PRIu32 " corrupt dump line(s) skipped\n", bad);
+    }
+    return windows > 0 ? 0 : 1;
+}
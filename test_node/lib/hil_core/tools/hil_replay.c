@@ -0,0 +1,581 @@
+/**
+ * @file hil_replay.c
+ * @brief Host replay harness for the HIL scheduler core.
+ *
+ * Feeds a stream of raw 256-byte SPI frames through hil_sched on a virtual
+ * clock and reports:
+ *   - on_frame time   (decode + ring push + arm, measured in wall-clock ns)
+ *   - ring occupancy  (sampled after every frame)
+ *   - injection error (virtual fire time − delivered packet.timestamp_us)
+ *   - lateness        (the core's histogram: fire time − oldest due timestamp)
+ *
+ * Capture format
+ * ──────────────
+ *   Repeated records of  [u32 rx_us LE][256-byte frame as received].
+ *   rx_us is the STM32-epoch time the frame finished arriving.
+ *
+ * Usage
+ * ─────
+ *   hil_replay [--tick-us N] [--isr-us I] CAPTURE
+ *   hil_replay [--tick-us N] [--isr-us I] --synth COUNT [--rate-hz R]
+ *              [--lead-us L] [--jitter-us J] [--seed S] [--imus N]
+ *              [--ranges N] [--write CAPTURE]
+ *   hil_replay [--tick-us N] [--isr-us I] --lockstep SOCKET [--lead-us L]
+ *              [--write CAPTURE]
+ *
+ *   --tick-us  Alarm granularity.  The default of 1 models the 1 MHz
+ *              injection counter; use 100 to see what a k_timer on a 10 kHz
+ *              CONFIG_SYS_CLOCK_TICKS_PER_SEC would do.
+ *   --isr-us   Fixed alarm-to-ISR entry latency added to every expiry.
+ *   --synth    Generate COUNT frames instead of reading a capture.
+ *   --imus, --ranges
+ *              Sensor instances per synthetic frame (default 1 each, the
+ *              legacy fields only); instances ≥ 1 go out as ImuRecord /
+ *              RangeRecord entries.
+ *   --lockstep Stand-in consumer for `flight_sim --lockstep SOCKET`: connects
+ *              to the sim's socket, acks every step and turns each step's
+ *              IMU sample into the SensorPacket the node would get, due
+ *              lead-us after the sample's sim time.  The frames are replayed
+ *              once the sim closes the link (see lockstep_receive()).
+ *
+ * Exit status is non-zero if any frame fails to decode or a packet pool
+ * reference leaks, so the harness can be used as a regression check in CI.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "hil_core/sched.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ── Virtual platform ─────────────────────────────────────────────────────── */
+
+struct host {
+    uint32_t now;
+    uint32_t tick_us;
+    uint32_t isr_us;
+    bool     timer_pending;
+    uint32_t timer_deadline;
+
+    struct hil_pool *pool;
+
+    int32_t *inject_err;
+    size_t   inject_n;
+    size_t   inject_cap;
+
+    uint64_t records[HIL_REC_KINDS];   /**< instances delivered, per kind */
+};
+
+static uint32_t host_now_us(void *ctx)
+{
+    return ((struct host *)ctx)->now;
+}
+
+static bool host_alarm_at(void *ctx, uint32_t target_us)
+{
+    struct host *h = ctx;
+    /* A target already reached fires straight away, like EXPIRE_WHEN_LATE. */
+    uint32_t t = hil_ts_due(target_us, h->now) ? h->now : target_us;
+    /* Expiry lands on the next tick boundary at or after the target. */
+    uint32_t rem = t % h->tick_us;
+    h->timer_deadline = rem ? t + (h->tick_us - rem) : t;
+    h->timer_pending  = true;
+    return true;
+}
+
+static void host_fire(struct host *h, struct hil_sched *s)
+{
+    h->now = h->timer_deadline + h->isr_us;
+    h->timer_pending = false;
+    hil_sched_on_timer(s);
+}
+
+static void host_deliver(void *ctx, uint16_t idx)
+{
+    struct host *h = ctx;
+    const device_update_packet_t *pkt = hil_pool_pkt(h->pool, idx);
+    if (h->inject_n == h->inject_cap) {
+        h->inject_cap = h->inject_cap ? h->inject_cap * 2 : 1024;
+        h->inject_err = realloc(h->inject_err, h->inject_cap * sizeof(int32_t));
+    }
+    h->inject_err[h->inject_n++] = (int32_t)(h->now - pkt->timestamp_us);
+    for (uint32_t k = 0; k < HIL_REC_KINDS; k++) {
+        h->records[k] += (uint64_t)__builtin_popcount(pkt->present[k]);
+    }
+    hil_pool_put(h->pool, idx);
+}
+
+/* ── Frame source ─────────────────────────────────────────────────────────── */
+
+struct record {
+    uint32_t rx_us;
+    uint8_t  frame[HIL_FRAME_SIZE];
+};
+
+static struct record *load_capture(const char *path, size_t *count)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+
+    struct record *recs = NULL;
+    size_t n = 0, cap = 0;
+    uint8_t hdr[4];
+    while (fread(hdr, 1, 4, f) == 4) {
+        if (n == cap) {
+            cap = cap ? cap * 2 : 1024;
+            recs = realloc(recs, cap * sizeof(*recs));
+        }
+        recs[n].rx_us = (uint32_t)hdr[0] | ((uint32_t)hdr[1] << 8)
+                      | ((uint32_t)hdr[2] << 16) | ((uint32_t)hdr[3] << 24);
+        if (fread(recs[n].frame, 1, HIL_FRAME_SIZE, f) != HIL_FRAME_SIZE) {
+            fprintf(stderr, "%s: truncated record %zu\n", path, n);
+            break;
+        }
+        n++;
+    }
+    fclose(f);
+    *count = n;
+    return recs;
+}
+
+static bool write_capture(const char *path, const struct record *recs, size_t n)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        uint8_t hdr[4] = {
+            (uint8_t)recs[i].rx_us,         (uint8_t)(recs[i].rx_us >> 8),
+            (uint8_t)(recs[i].rx_us >> 16), (uint8_t)(recs[i].rx_us >> 24),
+        };
+        fwrite(hdr, 1, 4, f);
+        fwrite(recs[i].frame, 1, HIL_FRAME_SIZE, f);
+    }
+    fclose(f);
+    return true;
+}
+
+/* Minimal proto3 encoder for synthetic SensorPackets. */
+static uint8_t *put_varint(uint8_t *p, uint64_t v)
+{
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static uint8_t *put_sint(uint8_t *p, uint32_t field, int32_t v)
+{
+    p = put_varint(p, (field << 3) | 0);
+    return put_varint(p, (uint32_t)((v << 1) ^ (v >> 31)));
+}
+
+static uint8_t *put_bytes(uint8_t *p, uint32_t field, const uint8_t *b, size_t n)
+{
+    p = put_varint(p, (field << 3) | 2);
+    p = put_varint(p, n);
+    memcpy(p, b, n);
+    return p + n;
+}
+
+static uint32_t xorshift32(uint32_t *s)
+{
+    uint32_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+static uint8_t *synth_imu(uint8_t *q, uint32_t *rng)
+{
+    for (uint32_t f = HIL_PB_IMU_PAYLOAD_GYRO_X; f <= HIL_PB_IMU_PAYLOAD_LIN_ACC_Z; f++) {
+        q = put_sint(q, f, (int32_t)(xorshift32(rng) % 8192) - 4096);
+    }
+    return q;
+}
+
+static struct record *synthesize(size_t count, uint32_t rate_hz, uint32_t lead_us,
+                                 uint32_t jitter_us, uint32_t seed,
+                                 uint32_t imus, uint32_t ranges)
+{
+    struct record *recs = calloc(count, sizeof(*recs));
+    uint32_t rng = seed ? seed : 1;
+    uint32_t period = 1000000U / rate_hz;
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t jitter = jitter_us ? xorshift32(&rng) % (jitter_us + 1) : 0;
+        uint32_t rx = 1000U + (uint32_t)i * period + jitter;
+        uint32_t ts = 1000U + (uint32_t)i * period + lead_us;
+
+        uint8_t imu[64], *q = synth_imu(imu, &rng);
+        uint8_t rc[16], *r = rc;
+        r = put_sint(r, HIL_PB_RC_PAYLOAD_VERTICAL, (int32_t)(xorshift32(&rng) % 255) - 127);
+        r = put_sint(r, HIL_PB_RC_PAYLOAD_HORIZONTAL, (int32_t)(xorshift32(&rng) % 255) - 127);
+
+        uint8_t *p = recs[i].frame + HIL_FRAME_HDR_SIZE;
+        p = put_varint(p, (HIL_PB_SENSOR_PACKET_TIMESTAMP_US << 3) | 0);
+        p = put_varint(p, ts);
+        p = put_varint(p, (HIL_PB_SENSOR_PACKET_LIDAR_MM << 3) | 0);
+        p = put_varint(p, xorshift32(&rng) % 40000);
+        p = put_bytes(p, HIL_PB_SENSOR_PACKET_IMU, imu, (size_t)(q - imu));
+        p = put_bytes(p, HIL_PB_SENSOR_PACKET_RC, rc, (size_t)(r - rc));
+
+        for (uint32_t inst = 1; inst < imus; inst++) {
+            uint8_t rec[80], *e = rec;
+            e = put_varint(e, (HIL_PB_IMU_RECORD_INSTANCE << 3) | 0);
+            e = put_varint(e, inst);
+            q = synth_imu(imu, &rng);
+            e = put_bytes(e, HIL_PB_IMU_RECORD_IMU, imu, (size_t)(q - imu));
+            p = put_bytes(p, HIL_PB_SENSOR_PACKET_IMUS, rec, (size_t)(e - rec));
+        }
+        for (uint32_t inst = 1; inst < ranges; inst++) {
+            uint8_t rec[16], *e = rec;
+            e = put_varint(e, (HIL_PB_RANGE_RECORD_INSTANCE << 3) | 0);
+            e = put_varint(e, inst);
+            e = put_varint(e, (HIL_PB_RANGE_RECORD_DISTANCE_MM << 3) | 0);
+            e = put_varint(e, xorshift32(&rng) % 40000);
+            p = put_bytes(p, HIL_PB_SENSOR_PACKET_RANGES, rec, (size_t)(e - rec));
+        }
+
+        uint16_t len = (uint16_t)(p - (recs[i].frame + HIL_FRAME_HDR_SIZE));
+        recs[i].frame[0] = (uint8_t)len;
+        recs[i].frame[1] = (uint8_t)(len >> 8);
+        recs[i].rx_us = rx;
+    }
+    return recs;
+}
+
+/* ── Lockstep consumer ────────────────────────────────────────────────────── */
+
+/* flight_sim's lockstep link (flight_sim/include/lockstep_transport.hpp):
+ * one SOCK_SEQPACKET datagram per step, a packed LE header and the sim's
+ * 36-byte legacy IMU image; the consumer answers each with an ack. */
+#define LOCKSTEP_FRAME_MAGIC  0x4C4B5354UL   /* "LKST" */
+#define LOCKSTEP_ACK_MAGIC    0x4C4B4143UL   /* "LKAC" */
+#define LOCKSTEP_HDR_SIZE     20U            /* magic, seq, sim_time_ns, len */
+#define LOCKSTEP_IMU_SIZE     36U
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)
+         | ((uint32_t)p[3] << 24);
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+static int lockstep_connect(const char *path)
+{
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "%s: socket path too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    /* The sim creates the socket once it is set up; allow it a few seconds. */
+    const struct timespec retry = { .tv_nsec = 10000000L };
+    for (int tries = 0; tries < 500; tries++) {
+        int fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (fd < 0) {
+            perror("socket");
+            return -1;
+        }
+        if (connect(fd, (const struct sockaddr *)&addr, sizeof(addr)) == 0) {
+            return fd;
+        }
+        close(fd);
+        nanosleep(&retry, NULL);
+    }
+    fprintf(stderr, "%s: no lockstep sim to connect to\n", path);
+    return -1;
+}
+
+/* The legacy image is (key, byte) pairs, register lsb then msb, for euler,
+ * linear acceleration and gyro x/y/z (flight_sim serialize()). */
+static void lockstep_frame(const uint8_t *image, uint32_t sample_us, uint32_t lead_us,
+                           struct record *rec)
+{
+    static const uint32_t fields[9] = {
+        HIL_PB_IMU_PAYLOAD_EULER_X,   HIL_PB_IMU_PAYLOAD_EULER_Y,   HIL_PB_IMU_PAYLOAD_EULER_Z,
+        HIL_PB_IMU_PAYLOAD_LIN_ACC_X, HIL_PB_IMU_PAYLOAD_LIN_ACC_Y, HIL_PB_IMU_PAYLOAD_LIN_ACC_Z,
+        HIL_PB_IMU_PAYLOAD_GYRO_X,    HIL_PB_IMU_PAYLOAD_GYRO_Y,    HIL_PB_IMU_PAYLOAD_GYRO_Z,
+    };
+    uint8_t imu[64], *q = imu;
+    for (uint32_t i = 0; i < 9; i++) {
+        int16_t v = (int16_t)(image[4 * i + 1] | (image[4 * i + 3] << 8));
+        q = put_sint(q, fields[i], v);
+    }
+
+    memset(rec->frame, 0, HIL_FRAME_SIZE);
+    uint8_t *p = rec->frame + HIL_FRAME_HDR_SIZE;
+    p = put_varint(p, (HIL_PB_SENSOR_PACKET_TIMESTAMP_US << 3) | 0);
+    p = put_varint(p, sample_us + lead_us);
+    p = put_bytes(p, HIL_PB_SENSOR_PACKET_IMU, imu, (size_t)(q - imu));
+
+    uint16_t len = (uint16_t)(p - (rec->frame + HIL_FRAME_HDR_SIZE));
+    rec->frame[0] = (uint8_t)len;
+    rec->frame[1] = (uint8_t)(len >> 8);
+    rec->rx_us = sample_us;
+}
+
+/*
+ * Serves one lockstep run and returns its steps as capture records. Each
+ * step is acked as soon as it is in hand; the scheduler runs on a virtual
+ * clock taken from the frames themselves, so replaying the records after
+ * the sim closes the link gives exactly what stepping it between acks would.
+ */
+static struct record *lockstep_receive(const char *path, uint32_t lead_us, size_t *count)
+{
+    int fd = lockstep_connect(path);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct record *recs = NULL;
+    size_t n = 0, cap = 0;
+    uint8_t buf[LOCKSTEP_HDR_SIZE + LOCKSTEP_IMU_SIZE + 1];
+    ssize_t got;
+    while ((got = recv(fd, buf, sizeof(buf), 0)) > 0) {
+        uint32_t seq = get_le32(buf + 4);
+        if (got != (ssize_t)(LOCKSTEP_HDR_SIZE + LOCKSTEP_IMU_SIZE) ||
+            get_le32(buf) != LOCKSTEP_FRAME_MAGIC ||
+            get_le32(buf + 16) != LOCKSTEP_IMU_SIZE || seq != (uint32_t)n) {
+            fprintf(stderr, "%s: bad lockstep frame after %zu steps\n", path, n);
+            free(recs);
+            recs = NULL;
+            break;
+        }
+        uint64_t sim_ns = (uint64_t)get_le32(buf + 8) | ((uint64_t)get_le32(buf + 12) << 32);
+
+        if (n == cap) {
+            cap = cap ? cap * 2 : 1024;
+            recs = realloc(recs, cap * sizeof(*recs));
+        }
+        lockstep_frame(buf + LOCKSTEP_HDR_SIZE, (uint32_t)(sim_ns / 1000U), lead_us,
+                       &recs[n++]);
+
+        uint8_t ack[8];
+        put_le32(ack, LOCKSTEP_ACK_MAGIC);
+        put_le32(ack + 4, seq);
+        if (send(fd, ack, sizeof(ack), MSG_NOSIGNAL) != (ssize_t)sizeof(ack)) {
+            break;
+        }
+    }
+    close(fd);
+    *count = n;
+    return recs;
+}
+
+/* ── Statistics ───────────────────────────────────────────────────────────── */
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_i32(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t mono_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--tick-us N] [--isr-us I] CAPTURE\n"
+            "       %s [--tick-us N] [--isr-us I] --synth COUNT [--rate-hz R]\n"
+            "          [--lead-us L] [--jitter-us J] [--seed S] [--imus N] [--ranges N]\n"
+            "          [--write CAPTURE]\n"
+            "       %s [--tick-us N] [--isr-us I] --lockstep SOCKET [--lead-us L]\n"
+            "          [--write CAPTURE]\n",
+            argv0, argv0, argv0);
+}
+
+/* ── Main ─────────────────────────────────────────────────────────────────── */
+
+int main(int argc, char **argv)
+{
+    const char *capture = NULL, *write_path = NULL, *lockstep = NULL;
+    size_t synth = 0;
+    uint32_t tick_us = 1, isr_us = 0, rate_hz = 100, lead_us = 5000, jitter_us = 0, seed = 1;
+    uint32_t imus = 1, ranges = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_val = (i + 1 < argc);
+        if (strcmp(a, "--tick-us") == 0 && has_val) {
+            tick_us = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--isr-us") == 0 && has_val) {
+            isr_us = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--synth") == 0 && has_val) {
+            synth = (size_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--rate-hz") == 0 && has_val) {
+            rate_hz = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--lead-us") == 0 && has_val) {
+            lead_us = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--jitter-us") == 0 && has_val) {
+            jitter_us = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--seed") == 0 && has_val) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--imus") == 0 && has_val) {
+            imus = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--ranges") == 0 && has_val) {
+            ranges = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--lockstep") == 0 && has_val) {
+            lockstep = argv[++i];
+        } else if (strcmp(a, "--write") == 0 && has_val) {
+            write_path = argv[++i];
+        } else if (a[0] != '-' && capture == NULL) {
+            capture = a;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if ((capture != NULL) + (synth != 0) + (lockstep != NULL) != 1 || tick_us == 0 ||
+        rate_hz == 0 || imus > 4 || ranges > 4) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    size_t n = 0;
+    struct record *recs = lockstep ? lockstep_receive(lockstep, lead_us, &n)
+                        : capture  ? load_capture(capture, &n)
+                                   : synthesize(synth, rate_hz, lead_us, jitter_us, seed,
+                                                imus, ranges);
+    if (recs == NULL || n == 0) {
+        n = synth;
+    }
+    if (recs == NULL || n == 0) {
+        fprintf(stderr, "no frames\n");
+        return 2;
+    }
+    if (write_path && !write_capture(write_path, recs, n)) {
+        return 2;
+    }
+
+    static struct hil_pool pool;
+    struct host h = { .tick_us = tick_us, .isr_us = isr_us, .pool = &pool };
+    const struct hil_sched_port port = {
+        .ctx      = &h,
+        .now_us   = host_now_us,
+        .alarm_at = host_alarm_at,
+        .deliver  = host_deliver,
+    };
+    static struct hil_sched sched;
+    hil_sched_init(&sched, &port, &pool);
+
+    uint64_t *frame_ns = malloc(n * sizeof(uint64_t));
+    uint64_t occ_sum = 0;
+    uint32_t occ_max = 0;
+    uint32_t occ_hist[HIL_RING_LEN + 1] = { 0 };
+
+    for (size_t i = 0; i < n; i++) {
+        /* Fire every alarm expiry that precedes this frame's arrival. */
+        while (h.timer_pending && hil_ts_due(h.timer_deadline + h.isr_us, recs[i].rx_us)) {
+            host_fire(&h, &sched);
+        }
+        h.now = recs[i].rx_us;
+
+        uint64_t t0 = mono_ns();
+        (void)hil_sched_on_frame(&sched, recs[i].frame, NULL, NULL);
+        frame_ns[i] = mono_ns() - t0;
+
+        uint32_t occ = hil_sched_ring_count(&sched);
+        occ_sum += occ;
+        occ_max = occ > occ_max ? occ : occ_max;
+        occ_hist[occ]++;
+    }
+    while (h.timer_pending) {
+        host_fire(&h, &sched);
+    }
+
+    /* ── Report ──────────────────────────────────────────────────────────── */
+    const struct hil_sched_stats *st = &sched.stats;
+    printf("frames        %" PRIu32 "  queued %" PRIu32 "  sync %" PRIu32
+           "  bad_len %" PRIu32 "  decode_fail %" PRIu32 "  no_slot %" PRIu32 "\n",
+           st->frames, st->queued, st->sync, st->bad_len, st->decode_fail, st->no_slot);
+    printf("ring          evicted %" PRIu32 "  injected %" PRIu32 "  coalesced %" PRIu32
+           "  empty_fire %" PRIu32 "  arm_fail %" PRIu32 "\n",
+           st->evicted, st->injected, st->coalesced, st->empty_fire, st->arm_fail);
+
+    qsort(frame_ns, n, sizeof(uint64_t), cmp_u64);
+    uint64_t ns_sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        ns_sum += frame_ns[i];
+    }
+    printf("on_frame ns   min %" PRIu64 "  mean %" PRIu64 "  p50 %" PRIu64
+           "  p99 %" PRIu64 "  max %" PRIu64 "\n",
+           frame_ns[0], ns_sum / n, frame_ns[n / 2], frame_ns[(n * 99) / 100],
+           frame_ns[n - 1]);
+
+    printf("occupancy     mean %.2f  max %" PRIu32 " / %u\n",
+           (double)occ_sum / (double)n, occ_max, HIL_RING_CAPACITY);
+    printf("occupancy hist");
+    for (uint32_t k = 0; k <= occ_max; k++) {
+        if (occ_hist[k]) {
+            printf("  %" PRIu32 ":%" PRIu32, k, occ_hist[k]);
+        }
+    }
+    printf("\n");
+
+    if (h.inject_n > 0) {
+        qsort(h.inject_err, h.inject_n, sizeof(int32_t), cmp_i32);
+        int64_t err_sum = 0;
+        for (size_t i = 0; i < h.inject_n; i++) {
+            err_sum += h.inject_err[i];
+        }
+        printf("inject err us min %" PRId32 "  mean %.2f  p99 %" PRId32
+               "  max %" PRId32 "\n",
+               h.inject_err[0], (double)err_sum / (double)h.inject_n,
+               h.inject_err[(h.inject_n * 99) / 100], h.inject_err[h.inject_n - 1]);
+    }
+
+    printf("records       imu %" PRIu64 "  range %" PRIu64 "  (instances delivered)\n",
+           h.records[HIL_REC_IMU], h.records[HIL_REC_RANGE]);
+
+    if (st->injected > 0) {
+        printf("lateness us   p50 %" PRIu32 "  p99 %" PRIu32 "  max %" PRIu32 "\n",
+               hil_sched_late_pct(&st->late, 50), hil_sched_late_pct(&st->late, 99),
+               st->late.max_us);
+    }
+
+    /* Every reference must have come back once the ring has drained. */
+    uint32_t leaked = hil_pool_in_use(&pool);
+    if (leaked != 0) {
+        printf("pool          %" PRIu32 " slot(s) still referenced\n", leaked);
+    }
+
+    free(frame_ns);
+    free(h.inject_err);
+    free(recs);
+    return (st->decode_fail || st->bad_len || st->no_slot || leaked) ? 1 : 0;
+}
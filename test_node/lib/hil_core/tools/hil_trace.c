@@ -0,0 +1,161 @@
+/**
+ * @file hil_trace.c
+ * @brief Decodes the binary hot-path trace the test node dumps on its console.
+ *
+ * The trace drain thread prints one "#T <hex>" line per batch of records
+ * (see hil_core/trace.h for the format).  Pipe the serial log through this
+ * tool, or point it at a saved log; every other line is ignored.
+ *
+ * Usage
+ * ─────
+ *   hil_trace [--delta] [--only NAME] [LOG]
+ *
+ *   --delta  Also print the µs since the previous record of the same ring.
+ *   --only   Print only events named NAME (e.g. inject, i2c_read).
+ *
+ * Example
+ * ───────
+ *   python -m serial.tools.miniterm /dev/ttyACM0 115200 | tee run.log
+ *   hil_trace --delta run.log
+ *
+ * Output
+ * ──────
+ *   <ts µs> [+<delta>] <ring> <event> <arguments rendered by the event's format>
+ *
+ * A "-- N record(s) dropped --" line marks where a ring overflowed.
+ */
+
+#include "hil_core/trace.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_RINGS 256
+
+/* ── Parsing ──────────────────────────────────────────────────────────────── */
+
+static int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static size_t parse_hex(const char *s, uint8_t *out, size_t cap)
+{
+    size_t n = 0;
+    while (n < cap) {
+        int hi = hex_nibble(s[0]);
+        int lo = (hi < 0) ? -1 : hex_nibble(s[1]);
+        if (lo < 0) {
+            break;
+        }
+        out[n++] = (uint8_t)((hi << 4) | lo);
+        s += 2;
+    }
+    return n;
+}
+
+/* ── Rendering ────────────────────────────────────────────────────────────── */
+
+static void print_rec(const struct hil_trace_rec *r, uint8_t ring, int64_t delta)
+{
+    printf("%10" PRIu32 " ", r->ts);
+    if (delta >= 0) {
+        printf("+%-8" PRId64 " ", delta);
+    }
+    printf("%u %-10s ", ring, hil_trace_name(r->id));
+
+    const char *fmt = hil_trace_format(r->id);
+    if (fmt != NULL) {
+        /* Every format takes (a0, a1, a2) as 32-bit ints. */
+        printf(fmt, (unsigned)r->a0, (unsigned)r->a1, (unsigned)r->a2);
+    } else {
+        printf("id=%u a0=%u a1=%" PRIu32 " a2=%" PRIu32, r->id, r->a0, r->a1, r->a2);
+    }
+    putchar('\n');
+}
+
+/* ── Main ─────────────────────────────────────────────────────────────────── */
+
+int main(int argc, char **argv)
+{
+    bool delta = false;
+    const char *only = NULL;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--delta") == 0) {
+            delta = true;
+        } else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [--delta] [--only NAME] [LOG]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    FILE *f = path ? fopen(path, "r") : stdin;
+    if (f == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    static uint32_t last_dropped[MAX_RINGS];
+    static uint32_t last_ts[MAX_RINGS];
+    static bool seen[MAX_RINGS];
+    uint64_t records = 0, lost = 0;
+    uint32_t bad = 0;
+
+    static char line[8192];
+    static uint8_t bin[HIL_TRACE_DUMP_SIZE(255)];
+    static struct hil_trace_rec rec[255];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        const char *hex = strstr(line, HIL_TRACE_LINE_PREFIX);
+        if (hex == NULL) {
+            continue;
+        }
+        size_t len = parse_hex(hex + strlen(HIL_TRACE_LINE_PREFIX), bin, sizeof(bin));
+
+        uint8_t ring = 0;
+        uint32_t dropped = 0;
+        int n = hil_trace_dump_decode(bin, len, &ring, &dropped, rec, 255);
+        if (n < 0) {
+            bad++;
+            continue;
+        }
+
+        if (dropped != last_dropped[ring]) {
+            printf("-- %" PRIu32 " record(s) dropped on ring %u --\n",
+                   dropped - last_dropped[ring], ring);
+            lost += dropped - last_dropped[ring];
+            last_dropped[ring] = dropped;
+        }
+        for (int i = 0; i < n; i++) {
+            int64_t d = -1;
+            if (delta) {
+                d = seen[ring] ? (int64_t)(uint32_t)(rec[i].ts - last_ts[ring]) : 0;
+            }
+            seen[ring] = true;
+            last_ts[ring] = rec[i].ts;
+            records++;
+            if (only == NULL || strcmp(only, hil_trace_name(rec[i].id)) == 0) {
+                print_rec(&rec[i], ring, d);
+            }
+        }
+    }
+    if (path) {
+        fclose(f);
+    }
+
+    fprintf(stderr, "%" PRIu64 " record(s), %" PRIu64 " dropped\n", records, lost);
+    if (bad > 0) {
+        fprintf(stderr, "%" PRIu32 " corrupt dump line(s) skipped\n", bad);
+    }
+    return records > 0 ? 0 : 1;
+}
@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) 2021 Marc Reilly - Creative Product Design
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Interrupt-driven bit-banged SPI slave.
+ *
+ * Nothing spins.  A transfer arms the driver and returns (async) or sleeps
+ * on the context (sync); the rest happens in GPIO edge interrupts:
+ *
+ *   CS  → active     frame starts: first bit put on MISO, SCK edge
+ *                    interrupt enabled
+ *   SCK sample edge  one interrupt per bit: sample MOSI, shift, put the
+ *                    next bit on MISO; a finished word goes to the RX
+ *                    buffer and the next TX word is loaded
+ *   CS  → inactive   frame ends: SCK interrupt disabled, transfer completed
+ *                    with the number of words received
+ *
+ * The sample edge is the leading SCK edge for CPHA = 0 and the trailing one
+ * for CPHA = 1.  In both modes the master samples MISO on that same edge,
+ * so driving the next bit right after sampling meets its setup time for
+ * the following edge; only the first bit is driven ahead, at CS.
+ *
+ * MOSI and MISO are accessed through the GPIO port registers (one load /
+ * one store) with CONFIG_SPIS_BITBANG_DIRECT_REGS, otherwise through the
+ * raw port API; either way without per-pin flag handling, so the data
+ * lines are taken as active high.  The per-bit cost is then the EXTI
+ * dispatch plus a few dozen instructions, which bounds SCK at roughly
+ * 1 / (2 × ISR time): give the SCK line an interrupt priority below the
+ * I2C target interrupts so they preempt it, and clock the master to match.
+ */
+
+#define DT_DRV_COMPAT zephyr_spis_bitbang
+
+#include <zephyr/logging/log.h>
+#include <zephyr/drivers/gpio.h>
+LOG_MODULE_REGISTER(spis_bitbang, CONFIG_SPI_LOG_LEVEL);
+
+#include <zephyr/sys/util.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi/rtio.h>
+#include "spi_context.h"
+#include "spis_bitbang.h"
+
+#ifdef CONFIG_SPIS_BITBANG_DIRECT_REGS
+#include <soc.h>
+#endif
+
+struct spis_bitbang_data {
+	struct spi_context ctx;
+	const struct device *dev;
+	struct gpio_callback clk_cb;
+	struct gpio_callback cs_cb;
+	int bits;
+	int dfs;
+
+	/* Transfer mode, latched by spis_bitbang_configure() */
+	bool lsb;
+	bool loop;
+	gpio_flags_t sample_edge;
+
+	/* ISR state */
+	bool armed;             /* a transfer waits for its frame */
+	bool in_frame;          /* CS active and clocking */
+	uint8_t bit;            /* bits done of the current word */
+	uint32_t w;             /* word being shifted out */
+	uint32_t r;             /* word being shifted in */
+	uint32_t out;           /* bit currently on MISO, for loopback */
+
+#ifdef CONFIG_SPIS_BITBANG_STATS
+	uint32_t frame_start;   /* k_cycle_get_32() at CS assert */
+	uint32_t frame_cycles;  /* last frame, CS assert to release */
+#endif
+};
+
+struct spis_bitbang_config {
+	struct gpio_dt_spec clk_gpio;
+	struct gpio_dt_spec mosi_gpio;
+	struct gpio_dt_spec miso_gpio;
+#ifdef CONFIG_SPIS_BITBANG_DIRECT_REGS
+	GPIO_TypeDef *mosi_regs;
+	GPIO_TypeDef *miso_regs;
+#endif
+};
+
+/* ── Data lines ─────────────────────────────────────────────────────────── */
+
+static ALWAYS_INLINE uint32_t spis_bitbang_mosi(const struct spis_bitbang_config *info)
+{
+	if (info->mosi_gpio.port == NULL) {
+		return 0;
+	}
+#ifdef CONFIG_SPIS_BITBANG_DIRECT_REGS
+	return (info->mosi_regs->IDR >> info->mosi_gpio.pin) & 1U;
+#else
+	gpio_port_value_t v = 0;
+
+	(void)gpio_port_get_raw(info->mosi_gpio.port, &v);
+	return (v >> info->mosi_gpio.pin) & 1U;
+#endif
+}
+
+static ALWAYS_INLINE void spis_bitbang_miso(const struct spis_bitbang_config *info, uint32_t d)
+{
+	if (info->miso_gpio.port == NULL) {
+		return;
+	}
+#ifdef CONFIG_SPIS_BITBANG_DIRECT_REGS
+	/* BSRR: low half sets, high half resets — one store, no read-modify-write. */
+	info->miso_regs->BSRR = BIT(info->miso_gpio.pin + (d ? 0U : 16U));
+#else
+	if (d) {
+		(void)gpio_port_set_bits_raw(info->miso_gpio.port, BIT(info->miso_gpio.pin));
+	} else {
+		(void)gpio_port_clear_bits_raw(info->miso_gpio.port, BIT(info->miso_gpio.pin));
+	}
+#endif
+}
+
+/* ── Word handling (ISR) ────────────────────────────────────────────────── */
+
+static ALWAYS_INLINE uint32_t spis_bitbang_tx_word(struct spis_bitbang_data *data)
+{
+	struct spi_context *ctx = &data->ctx;
+
+	if (!spi_context_tx_buf_on(ctx)) {
+		return 0;
+	}
+	switch (data->dfs) {
+	case 4:
+		return *(const uint32_t *)ctx->tx_buf;
+	case 2:
+		return *(const uint16_t *)ctx->tx_buf;
+	default:
+		return *(const uint8_t *)ctx->tx_buf;
+	}
+}
+
+static ALWAYS_INLINE void spis_bitbang_rx_word(struct spis_bitbang_data *data, uint32_t r)
+{
+	struct spi_context *ctx = &data->ctx;
+
+	if (!spi_context_rx_buf_on(ctx)) {
+		return;
+	}
+	switch (data->dfs) {
+	case 4:
+		*(uint32_t *)ctx->rx_buf = r;
+		break;
+	case 2:
+		*(uint16_t *)ctx->rx_buf = (uint16_t)r;
+		break;
+	default:
+		*(uint8_t *)ctx->rx_buf = (uint8_t)r;
+		break;
+	}
+}
+
+/* Bit i (0 = first on the wire) of the current TX word. */
+static ALWAYS_INLINE uint32_t spis_bitbang_out_bit(const struct spis_bitbang_data *data,
+						   uint8_t i)
+{
+	const int shift = data->lsb ? i : (data->bits - 1 - i);
+
+	return (data->w >> shift) & 1U;
+}
+
+static void spis_bitbang_drive(const struct spis_bitbang_config *info,
+			       struct spis_bitbang_data *data)
+{
+	data->out = spis_bitbang_out_bit(data, data->bit);
+	spis_bitbang_miso(info, data->out);
+}
+
+/* ── Edge interrupts ────────────────────────────────────────────────────── */
+
+/* SCK sample edge: one call per bit. */
+static void spis_bitbang_clk_isr(const struct device *port, struct gpio_callback *cb,
+				 gpio_port_pins_t pins)
+{
+	struct spis_bitbang_data *data = CONTAINER_OF(cb, struct spis_bitbang_data, clk_cb);
+	const struct spis_bitbang_config *info = data->dev->config;
+	struct spi_context *ctx = &data->ctx;
+
+	ARG_UNUSED(port);
+	ARG_UNUSED(pins);
+
+	const uint32_t b = data->loop ? data->out : spis_bitbang_mosi(info);
+
+	if (data->lsb) {
+		data->r |= b << data->bit;
+	} else {
+		data->r = (data->r << 1) | b;
+	}
+
+	if (++data->bit == data->bits) {
+		spis_bitbang_rx_word(data, data->r);
+		spi_context_update_tx(ctx, data->dfs, 1);
+		spi_context_update_rx(ctx, data->dfs, 1);
+		data->bit = 0;
+		data->r = 0;
+
+		if (!spi_context_tx_on(ctx) && !spi_context_rx_on(ctx)) {
+			/* Buffers full: ignore the rest of the frame, complete at CS. */
+			(void)gpio_pin_interrupt_configure_dt(&info->clk_gpio, GPIO_INT_DISABLE);
+			data->w = 0;
+			spis_bitbang_drive(info, data);
+			return;
+		}
+		data->w = spis_bitbang_tx_word(data);
+	}
+
+	spis_bitbang_drive(info, data);
+}
+/* CS released: park MISO low and complete the transfer. */
+static void spis_bitbang_frame_end(const struct spis_bitbang_config *info,
+				   struct spis_bitbang_data *data)
+{
+	(void)gpio_pin_interrupt_configure_dt(&info->clk_gpio, GPIO_INT_DISABLE);
+	spis_bitbang_miso(info, 0);
+	data->in_frame = false;
+	data->armed = false;
+#ifdef CONFIG_SPIS_BITBANG_STATS
+	data->frame_cycles = k_cycle_get_32() - data->frame_start;
+#endif
+	spi_context_complete(&data->ctx, data->dev, 0);
+}
+
+/* CS, both edges: frame boundaries. */
+static void spis_bitbang_cs_isr(const struct device *port, struct gpio_callback *cb,
+				gpio_port_pins_t pins)
+{
+	struct spis_bitbang_data *data = CONTAINER_OF(cb, struct spis_bitbang_data, cs_cb);
+	const struct spis_bitbang_config *info = data->dev->config;
+	struct spi_context *ctx = &data->ctx;
+
+	ARG_UNUSED(port);
+	ARG_UNUSED(pins);
+
+	if (gpio_pin_get_dt(ctx->cs_gpios) > 0) {
+		if (!data->armed || data->in_frame) {
+			return;     /* no transfer pending: the frame is not ours */
+		}
+		data->in_frame = true;
+#ifdef CONFIG_SPIS_BITBANG_STATS
+		data->frame_start = k_cycle_get_32();
+#endif
+		data->bit = 0;
+		data->r = 0;
+		data->w = spis_bitbang_tx_word(data);
+		spis_bitbang_drive(info, data);
+		(void)gpio_pin_interrupt_configure_dt(&info->clk_gpio, data->sample_edge);
+		return;
+	}
+
+	if (data->in_frame) {
+		spis_bitbang_frame_end(info, data);
+	}
+}
+
+/* ── Transfers ──────────────────────────────────────────────────────────── */
+
+static int spis_bitbang_configure(const struct spis_bitbang_config *info,
+			    struct spis_bitbang_data *data,
+			    const struct spi_config *config)
+{
+	if (config->operation & SPI_HALF_DUPLEX) {
+		LOG_ERR("Half Duplex not supported");
+		return -ENOTSUP;
+	}
+
+	if (config->operation & SPI_OP_MODE_MASTER) {
+		LOG_ERR("Master mode not supported");
+		return -ENOTSUP;
+	}
+
+	if (config->operation & (SPI_LINES_DUAL | SPI_LINES_QUAD | SPI_LINES_OCTAL)) {
+		LOG_ERR("Unsupported configuration");
+		return -ENOTSUP;
+	}
+
+	const int bits = SPI_WORD_SIZE_GET(config->operation);
+
+	if (bits > 32) {
+		LOG_ERR("Word sizes > 32 bits not supported");
+		return -ENOTSUP;
+	}
+
+	data->bits = bits;
+	data->dfs = ((data->bits - 1) / 8) + 1;
+
+	/* As there is no uint24_t, it is assumed uint32_t will be used as the buffer base type. */
+	if (data->dfs == 3) {
+		data->dfs = 4;
+	}
+
+	data->lsb = (config->operation & SPI_TRANSFER_LSB) != 0;
+	data->loop = (SPI_MODE_GET(config->operation) & SPI_MODE_LOOP) != 0;
+
+	/* Leading edge for CPHA = 0, trailing for CPHA = 1: rising iff CPOL == CPHA. */
+	const bool cpol = (SPI_MODE_GET(config->operation) & SPI_MODE_CPOL) != 0;
+	const bool cpha = (SPI_MODE_GET(config->operation) & SPI_MODE_CPHA) != 0;
+
+	data->sample_edge = (cpol == cpha) ? GPIO_INT_EDGE_RISING : GPIO_INT_EDGE_FALLING;
+	data->ctx.config = config;
+
+	return 0;
+}
+
+static int spis_bitbang_transceive_common(const struct device *dev,
+					  const struct spi_config *spi_cfg,
+					  const struct spi_buf_set *tx_bufs,
+					  const struct spi_buf_set *rx_bufs,
+					  bool asynchronous,
+					  spi_callback_t cb,
+					  void *userdata)
+{
+	const struct spis_bitbang_config *info = dev->config;
+	struct spis_bitbang_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+	int rc;
+
+	spi_context_lock(ctx, asynchronous, cb, userdata, spi_cfg);
+
+	rc = spis_bitbang_configure(info, data, spi_cfg);
+	if (rc < 0) {
+		spi_context_release(ctx, rc);
+		return rc;
+	}
+
+	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, data->dfs);
+
+	/* The next CS assertion starts the frame (spis_bitbang_cs_isr). */
+	unsigned int key = irq_lock();
+
+	data->in_frame = false;
+	data->armed = true;
+	irq_unlock(key);
+
+	rc = spi_context_wait_for_completion(ctx);
+	spi_context_release(ctx, rc);
+
+	return rc;
+}
+
+static int spis_bitbang_transceive(const struct device *dev,
+			      const struct spi_config *spi_cfg,
+			      const struct spi_buf_set *tx_bufs,
+			      const struct spi_buf_set *rx_bufs)
+{
+	return spis_bitbang_transceive_common(dev, spi_cfg, tx_bufs, rx_bufs,
+					      false, NULL, NULL);
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static int spis_bitbang_transceive_async(const struct device *dev,
+				    const struct spi_config *spi_cfg,
+				    const struct spi_buf_set *tx_bufs,
+				    const struct spi_buf_set *rx_bufs,
+				    spi_callback_t cb,
+				    void *userdata)
+{
+	return spis_bitbang_transceive_common(dev, spi_cfg, tx_bufs, rx_bufs,
+					      true, cb, userdata);
+}
+#endif
+
+int spis_bitbang_release(const struct device *dev,
+			  const struct spi_config *config)
+{
+	struct spis_bitbang_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+
+	spi_context_unlock_unconditionally(ctx);
+	return 0;
+}
+
+/* ── Init ───────────────────────────────────────────────────────────────── */
+
+int spis_bitbang_init(const struct device *dev)
+{
+	const struct spis_bitbang_config *config = dev->config;
+	struct spis_bitbang_data *data = dev->data;
+	int rc;
+
+	data->dev = dev;
+
+	if (!gpio_is_ready_dt(&config->clk_gpio)) {
+		LOG_ERR("GPIO port for clk pin is not ready");
+		return -ENODEV;
+	}
+	rc = gpio_pin_configure_dt(&config->clk_gpio, GPIO_INPUT);
+	if (rc < 0) {
+		LOG_ERR("Couldn't configure clk pin; (%d)", rc);
+		return rc;
+	}
+
+	if (config->mosi_gpio.port != NULL) {
+		if (!gpio_is_ready_dt(&config->mosi_gpio)) {
+			LOG_ERR("GPIO port for mosi pin is not ready");
+			return -ENODEV;
+		}
+		rc = gpio_pin_configure_dt(&config->mosi_gpio, GPIO_INPUT);
+		if (rc < 0) {
+			LOG_ERR("Couldn't configure mosi pin; (%d)", rc);
+			return rc;
+		}
+	}
+
+	if (config->miso_gpio.port != NULL) {
+		if (!gpio_is_ready_dt(&config->miso_gpio)) {
+			LOG_ERR("GPIO port for miso pin is not ready");
+			return -ENODEV;
+		}
+		rc = gpio_pin_configure_dt(&config->miso_gpio, GPIO_OUTPUT_INACTIVE);
+		if (rc < 0) {
+			LOG_ERR("Couldn't configure miso pin; (%d)", rc);
+			return rc;
+		}
+	}
+
+	if (data->ctx.num_cs_gpios == 0) {
+		LOG_ERR("CS pin is needed");
+		return -EINVAL;
+	}
+	if (data->ctx.num_cs_gpios > 1) {
+		LOG_WRN("More than 1 CS in slave context is not permitted. Configuring only first CS GPIO.");
+	}
+	if (!gpio_is_ready_dt(data->ctx.cs_gpios))
+	{
+		LOG_ERR("CS GPIO not ready");
+		return -ENODEV;
+	}
+	rc = gpio_pin_configure_dt(data->ctx.cs_gpios, GPIO_INPUT);
+	if (rc < 0) {
+		LOG_ERR("Failed to configure CS pins: %d", rc);
+		return rc;
+	}
+
+	/* SCK interrupts only run inside a frame; CS edges are always watched. */
+	gpio_init_callback(&data->clk_cb, spis_bitbang_clk_isr, BIT(config->clk_gpio.pin));
+	rc = gpio_add_callback(config->clk_gpio.port, &data->clk_cb);
+	if (rc == 0) {
+		rc = gpio_pin_interrupt_configure_dt(&config->clk_gpio, GPIO_INT_DISABLE);
+	}
+	if (rc < 0) {
+		LOG_ERR("Couldn't set up clk interrupt; (%d)", rc);
+		return rc;
+	}
+
+	gpio_init_callback(&data->cs_cb, spis_bitbang_cs_isr, BIT(data->ctx.cs_gpios->pin));
+	rc = gpio_add_callback(data->ctx.cs_gpios->port, &data->cs_cb);
+	if (rc == 0) {
+		rc = gpio_pin_interrupt_configure_dt(data->ctx.cs_gpios, GPIO_INT_EDGE_BOTH);
+	}
+	if (rc < 0) {
+		LOG_ERR("Couldn't set up CS interrupt; (%d)", rc);
+		return rc;
+	}
+
+	spi_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+#ifdef CONFIG_SPIS_BITBANG_STATS
+uint32_t spis_bitbang_last_frame_cycles(const struct device *dev)
+{
+	const struct spis_bitbang_data *data = dev->data;
+
+	return data->frame_cycles;
+}
+#endif
+
+static DEVICE_API(spi, spis_bitbang_api) = {
+	.transceive = spis_bitbang_transceive,
+	.release = spis_bitbang_release,
+#ifdef CONFIG_SPI_ASYNC
+	.transceive_async = spis_bitbang_transceive_async,
+#endif /* CONFIG_SPI_ASYNC */
+#ifdef CONFIG_SPI_RTIO
+	.iodev_submit = spi_rtio_iodev_default_submit,
+#endif
+};
+
+#ifdef CONFIG_SPIS_BITBANG_DIRECT_REGS
+/* Port register block of an optional data line, from its GPIO controller node. */
+#define SPIS_PORT_REGS(inst, prop)						\
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, prop),				\
+		    ((GPIO_TypeDef *)DT_REG_ADDR(DT_INST_GPIO_CTLR(inst, prop))),	\
+		    (NULL))
+#define SPIS_DIRECT_REGS_INIT(inst)						\
+		.mosi_regs = SPIS_PORT_REGS(inst, mosi_gpios),			\
+		.miso_regs = SPIS_PORT_REGS(inst, miso_gpios),
+#else
+#define SPIS_DIRECT_REGS_INIT(inst)
+#endif
+
+#define SPIS_DEFINE(inst)						\
+	static struct spis_bitbang_config spis_bitbang_config_##inst = {	\
+		.clk_gpio = GPIO_DT_SPEC_INST_GET(inst, clk_gpios),	\
+		.mosi_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, mosi_gpios, {0}),	\
+		.miso_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, miso_gpios, {0}),	\
+		SPIS_DIRECT_REGS_INIT(inst)					\
+	};								\
+									\
+	static struct spis_bitbang_data spis_bitbang_data_##inst = {	\
+		SPI_CONTEXT_INIT_LOCK(spis_bitbang_data_##inst, ctx),	\
+		SPI_CONTEXT_INIT_SYNC(spis_bitbang_data_##inst, ctx),	\
+		SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(inst), ctx)	\
+	};								\
+									\
+	SPI_DEVICE_DT_INST_DEFINE(inst,					\
+			    spis_bitbang_init,				\
+			    NULL,					\
+			    &spis_bitbang_data_##inst,			\
+			    &spis_bitbang_config_##inst,			\
+			    POST_KERNEL,				\
+			    CONFIG_SPI_INIT_PRIORITY,			\
+			    &spis_bitbang_api);
+
+DT_INST_FOREACH_STATUS_OKAY(SPIS_DEFINE)
@@ -0,0 +1,24 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Extras of the bit-banged SPI slave beyond the Zephyr SPI API.
+ */
+
+#ifndef SPIS_BITBANG_H_
+#define SPIS_BITBANG_H_
+
+#include <zephyr/device.h>
+#include <stdint.h>
+
+#ifdef CONFIG_SPIS_BITBANG_STATS
+/*
+ * Cycles (k_cycle_get_32) the last frame took from CS assert to CS release.
+ * With the number of bits it carried this gives the SCK rate the driver
+ * actually kept up with.
+ */
+uint32_t spis_bitbang_last_frame_cycles(const struct device *dev);
+#endif
+
+#endif /* SPIS_BITBANG_H_ */
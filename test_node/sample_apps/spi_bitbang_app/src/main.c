@@ -4,6 +4,56 @@
 #define LEN_TRANSCEIVE 12
 #define SPIBB_NODE	DT_NODELABEL(spibb0)
 
+#ifdef CONFIG_APP_SPIS_BENCH
+#include <string.h>
+#include <zephyr/kernel.h>
+#include "spis_bitbang.h"
+
+#define BENCH_FRAMES 64
+
+/* Serve frames forever; report errors and the effective SCK per batch. */
+static int bench(const struct device *dev, const struct spi_config *config,
+		 const struct spi_buf_set *tx_buf, const struct spi_buf_set *rx_buf,
+		 uint8_t *read_buf)
+{
+	const uint64_t hz = sys_clock_hw_cycles_per_sec();
+
+	printk("bench: master must send byte i = i + 4, %d bytes per frame\n", LEN_TRANSCEIVE);
+
+	for (;;) {
+		uint32_t errors = 0, short_frames = 0;
+		uint32_t min_khz = UINT32_MAX, max_khz = 0;
+
+		for (int f = 0; f < BENCH_FRAMES; f++) {
+			memset(read_buf, 0, LEN_TRANSCEIVE);
+
+			const int frames = spi_transceive(dev, config, tx_buf, rx_buf);
+
+			if (frames < 0) {
+				printk("bench: transceive failed (%d)\n", frames);
+				return 1;
+			}
+			if (frames < LEN_TRANSCEIVE) {
+				short_frames++;
+			}
+			for (int i = 0; i < LEN_TRANSCEIVE; i++) {
+				errors += read_buf[i] != (uint8_t)(i + 4);
+			}
+
+			/* CS-to-CS time bounds SCK from below: setup and hold are included. */
+			const uint32_t cycles = spis_bitbang_last_frame_cycles(dev);
+			const uint32_t khz = cycles ? (uint32_t)((uint64_t)frames * 8U * hz / cycles / 1000U) : 0;
+
+			min_khz = MIN(min_khz, khz);
+			max_khz = MAX(max_khz, khz);
+		}
+		printk("bench: %d frames, %u byte errors, %u short, SCK >= %u..%u kHz\n",
+		       BENCH_FRAMES, errors, short_frames, min_khz, max_khz);
+	}
+	return 0;
+}
+#endif /* CONFIG_APP_SPIS_BENCH */
+
 int main(void)
 {
 	printk("hello world!");
@@ -30,6 +80,10 @@ int main(void)
 	// populate the write buffer
     for (int i = 0; i < LEN_TRANSCEIVE; i++) write_buf[i] = i + 4;
 
+#ifdef CONFIG_APP_SPIS_BENCH
+	return bench(dev, &config, &tx_buf, &rx_buf, read_buf);
+#endif
+
     // transceive
 	printk("Transceiving\n");
     int transceive_res = spi_transceive(dev, &config, &tx_buf, &rx_buf);